@@ -1,152 +1,338 @@
-/**
- * This simple program is meant to test the effect of alignment on the speed.
- */
-
-#include <chrono>
-#include <cmath>
-#include <filesystem>
-#include <fstream>
+// This benchmark program measures the effect of alignment on the speed of
+// every function and every implementation supported by the processor. It
+// shifts the input, then the output, by 0 to 63 bytes from a cache-line
+// boundary, and places both buffers so that they end right before an
+// inaccessible page, as the inputs found at arbitrary offsets of network
+// buffers do. It prints, for each function and implementation, the slowest
+// and the fastest placements and their spread, to find the kernels that
+// suffer from loads split across cache lines or from their masked tails.
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
+#include <new>
+#include <string>
 #include <vector>
 
+#if defined(__unix__) || defined(__APPLE__)
+  #include <sys/mman.h>
+  #include <unistd.h>
+  #define SIMDUTF_ALIGNMENT_GUARD_PAGE 1
+#endif
+
 #include "simdutf.h"
 
-uint64_t nano() {
-  return std::chrono::duration_cast<::std::chrono::nanoseconds>(
-             std::chrono::steady_clock::now().time_since_epoch())
-      .count();
-}
+#include "kernels.h"
+
+namespace {
+
+using simdutf::benchmarks::fit_size;
+using simdutf::benchmarks::input_kind;
+using simdutf::benchmarks::kernel;
+using simdutf::benchmarks::kernels;
+using simdutf::benchmarks::parse_size;
+using simdutf::benchmarks::selection;
+using simdutf::benchmarks::selection_option;
+
+constexpr size_t cache_line = 64;
 
-template <typename PROCEDURE>
-double bench(PROCEDURE f, uint64_t threshold = 200'000'000) {
-  uint64_t start = nano();
-  uint64_t finish = start;
-  size_t times{0};
-  for (; finish - start < threshold; times++) {
-    size_t output_size = f();
-    if (output_size == 0) {
-      throw std::runtime_error("bad input?");
+// Buffers whose usable bytes end at a page boundary, followed by an
+// inaccessible page when the system lets us protect one: a kernel that reads
+// or writes past the end of its buffers then crashes.
+class guarded_buffer {
+public:
+  explicit guarded_buffer(size_t size) {
+#ifdef SIMDUTF_ALIGNMENT_GUARD_PAGE
+    page = size_t(sysconf(_SC_PAGESIZE));
+    usable = (size + page - 1) / page * page;
+    void *memory = mmap(nullptr, usable + page, PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (memory == MAP_FAILED) {
+      throw std::bad_alloc();
     }
-    finish = nano();
+    base = static_cast<char *>(memory);
+    guarded = mprotect(base + usable, page, PROT_NONE) == 0;
+#else
+    usable = (size + page - 1) / page * page;
+    fallback.resize(usable + page);
+    base = fallback.data() +
+           (page - reinterpret_cast<uintptr_t>(fallback.data()) % page) % page;
+#endif
   }
-  return double(finish - start) / times;
+  ~guarded_buffer() {
+#ifdef SIMDUTF_ALIGNMENT_GUARD_PAGE
+    munmap(base, usable + page);
+#endif
+  }
+  guarded_buffer(const guarded_buffer &) = delete;
+  guarded_buffer &operator=(const guarded_buffer &) = delete;
+
+  char *end() const { return base + usable; }
+  bool is_guarded() const { return guarded; }
+
+private:
+  size_t page = 4096;
+  size_t usable = 0;
+  char *base = nullptr;
+  bool guarded = false;
+#ifndef SIMDUTF_ALIGNMENT_GUARD_PAGE
+  std::vector<char> fallback;
+#endif
+};
+
+// The first cache-line boundary of the buffer.
+char *align(std::vector<char> &buffer) {
+  const uintptr_t address = reinterpret_cast<uintptr_t>(buffer.data());
+  return buffer.data() + (cache_line - address % cache_line) % cache_line;
 }
 
-void run_from_utf8(const std::vector<char> &input_data) {
-  std::cout << "# aligning input" << std::endl;
-  std::cout << "# input size = " << input_data.size() << " bytes" << std::endl;
-  std::vector<char> tmp_buffer(input_data);
-  tmp_buffer.resize(tmp_buffer.size() + 512);
-  std::vector<char16_t> buffer(
-      simdutf::utf16_length_from_utf8(input_data.data(), input_data.size()));
-  size_t utf8count = simdutf::count_utf8(input_data.data(), input_data.size());
-  // Let us warm up:
-  bench(
-      [&tmp_buffer, &input_data, &buffer]() -> size_t {
-        return simdutf::convert_utf8_to_utf16le(
-            tmp_buffer.data(), input_data.size(), buffer.data());
-      },
-      2'000'000'000);
-  // warmed up
-  double best_speed = 0;
-  double worst_speed = 1e300;
-
-  for (size_t offset = 0; offset < 512; offset += 1) {
-    memcpy(tmp_buffer.data() + offset, input_data.data(), input_data.size());
-
-    std::cout << offset << ",\t";
-    auto size_procedure = [&tmp_buffer, &input_data, offset,
-                           &buffer]() -> size_t {
-      return simdutf::convert_utf8_to_utf16le(tmp_buffer.data() + offset,
-                                              input_data.size(), buffer.data());
-    };
-    double speed = utf8count / bench(size_procedure);
-    if (speed > best_speed) {
-      best_speed = speed;
+double measure(const kernel &func, const simdutf::implementation &impl,
+               const char *input, size_t size, char *output,
+               double min_time_ns) {
+  return simdutf::benchmarks::best_time_ns(
+      [&] { return func.run(impl, input, size, output); }, min_time_ns);
+}
+
+struct sweep {
+  double worst = 0; // GB/s
+  size_t worst_offset = 0;
+  double best = 0;
+  size_t best_offset = 0;
+
+  void add(size_t offset, double gb_per_s) {
+    if (worst == 0 || gb_per_s < worst) {
+      worst = gb_per_s;
+      worst_offset = offset;
     }
-    if (speed < worst_speed) {
-      worst_speed = speed;
+    if (gb_per_s > best) {
+      best = gb_per_s;
+      best_offset = offset;
     }
-
-    std::cout << speed << "\n";
   }
-  std::cout << "# worst speed " << worst_speed << std::endl;
-  std::cout << "# best speed " << best_speed << std::endl;
-  std::cout << "# difference (percent) " << (best_speed / worst_speed - 1) * 100
-            << std::endl;
+  bool empty() const { return best == 0; }
+  double spread() const { return (best / worst - 1) * 100; }
+};
+
+void print_help(const char *program) {
+  printf("Usage: %s [options] [<filename>]\n", program);
+  printf(R"txt(
+Measures every function and every implementation supported by this
+processor with the input, then the output, shifted by 0 to 63 bytes from a
+cache-line boundary, and with both buffers ending right before a page
+boundary. Prints, for each function and implementation, the throughput of
+the aligned buffers, the slowest and the fastest offsets and their spread,
+and the throughput at the end of a page, as CSV (or JSON).
+
+Options:
+  --size <size>              input size (default 16K), with the suffixes K,
+                             M and G
+  --max-offset <n>           largest offset (default 63)
+  --min-time-ms <ms>         time spent per placement (default 10)
+  --function <name>          only this function (may be repeated)
+  --implementation <name>    only this implementation (may be repeated)
+  --points                   print every placement instead of the summary
+  --json                     print JSON lines instead of CSV
+  --list                     list the functions
+  --help                     show this help
+
+The input is synthetic, mostly ASCII, text, or the content of the file,
+repeated as needed. The UTF-16 inputs and the UTF-16 and UTF-32 outputs move
+by whole code units. On POSIX systems, the page after the buffers is made
+inaccessible, so that reading or writing past their end crashes.
+)txt");
 }
 
-void run_from_utf8_output(const std::vector<char> &input_data) {
-  std::cout << "# aligning output" << std::endl;
-  std::cout << "# input size = " << input_data.size() << " bytes" << std::endl;
-
-  std::vector<char16_t> buffer(
-      simdutf::utf16_length_from_utf8(input_data.data(), input_data.size()) +
-      512);
-  size_t utf8count = simdutf::count_utf8(input_data.data(), input_data.size());
-  // Let us warm up:
-  bench(
-      [&input_data, &buffer]() -> size_t {
-        return simdutf::convert_utf8_to_utf16le(
-            input_data.data(), input_data.size(), buffer.data());
-      },
-      2'000'000'000);
-  // warmed up
-  double best_speed = 0;
-  double worst_speed = 1e300;
-
-  for (size_t offset = 0; offset < 512; offset += 1) {
-
-    std::cout << offset << ",\t";
-    auto size_procedure = [&input_data, offset, &buffer]() -> size_t {
-      return simdutf::convert_utf8_to_utf16le(
-          input_data.data(), input_data.size(), buffer.data() + offset);
-    };
-    double speed = utf8count / bench(size_procedure);
-    if (speed > best_speed) {
-      best_speed = speed;
+} // namespace
+
+int main(int argc, char *argv[]) {
+  size_t size = 16 * 1024;
+  size_t max_offset = cache_line - 1;
+  double min_time_ns = 10e6;
+  bool points = false;
+  bool json = false;
+  selection selected;
+
+  for (int i = 1; i < argc; ++i) {
+    const selection_option option = simdutf::benchmarks::parse_selection_option(
+        argc, argv, i, kernels, selected);
+    if (option == selection_option::listed) {
+      return EXIT_SUCCESS;
+    } else if (option == selection_option::parsed) {
+      continue;
     }
-    if (speed < worst_speed) {
-      worst_speed = speed;
+    if (strcmp(argv[i], "--size") == 0 && i + 1 < argc) {
+      size = std::max<size_t>(4, parse_size(argv[++i]));
+    } else if (strcmp(argv[i], "--max-offset") == 0 && i + 1 < argc) {
+      max_offset = std::stoull(argv[++i]);
+    } else if (strcmp(argv[i], "--min-time-ms") == 0 && i + 1 < argc) {
+      min_time_ns = std::stod(argv[++i]) * 1e6;
+    } else if (strcmp(argv[i], "--points") == 0) {
+      points = true;
+    } else if (strcmp(argv[i], "--json") == 0) {
+      json = true;
+    } else if (strcmp(argv[i], "--help") == 0 || strcmp(argv[i], "-h") == 0) {
+      print_help(argv[0]);
+      return EXIT_SUCCESS;
+    } else {
+      print_help(argv[0]);
+      return EXIT_FAILURE;
     }
-
-    std::cout << speed << "\n";
   }
-  std::cout << "# worst speed " << worst_speed << std::endl;
-  std::cout << "# best speed " << best_speed << std::endl;
-  std::cout << "# difference (percent) " << (best_speed / worst_speed - 1) * 100
-            << std::endl;
-}
+  if (!simdutf::benchmarks::check_functions(kernels, selected)) {
+    return EXIT_FAILURE;
+  }
 
-int main(int argc, char **argv) {
-  printf("# current system detected as %.*s.\n",
-         int(simdutf::get_active_implementation()->name().size()),
-         simdutf::get_active_implementation()->name().data());
-  if (argc < 2) {
-    std::cerr << "Please provide a file argument." << std::endl;
+  std::vector<char> file;
+  if (selected.filename != nullptr &&
+      !simdutf::benchmarks::load_utf8_input(selected.filename, file)) {
     return EXIT_FAILURE;
   }
-  const char *filename = argv[1];
-  printf("# loading file %s\n", filename);
-  std::filesystem::path path(filename);
-  std::ifstream file;
-  file.exceptions(std::ifstream::failbit | std::ifstream::badbit);
-  file.open(path);
-  std::vector<char> input_data;
-  input_data.assign(std::istreambuf_iterator<char>(file),
-                    std::istreambuf_iterator<char>());
-  auto detected_encoding =
-      simdutf::autodetect_encoding(input_data.data(), input_data.size());
-  printf("# input detected as %.*s.\n",
-         int(simdutf::to_string(detected_encoding).size()),
-         simdutf::to_string(detected_encoding).data());
-  if (detected_encoding == simdutf::encoding_type::UTF8) {
-    run_from_utf8_output(input_data);
-    std::cout << "----" << std::endl;
-
-    run_from_utf8(input_data);
-  } else {
-    printf("We only support UTF-8 inputs.\n");
+
+  const std::array<std::vector<char>, 4> inputs =
+      simdutf::benchmarks::make_inputs(file, size);
+  const size_t output_capacity = 4 * size + 64;
+  std::vector<char> input_storage(size + max_offset + 2 * cache_line);
+  std::vector<char> output_storage(output_capacity + max_offset +
+                                   2 * cache_line);
+  char *const aligned_input = align(input_storage);
+  char *const aligned_output = align(output_storage);
+  guarded_buffer input_page(size);
+  guarded_buffer output_page(output_capacity);
+  if (!input_page.is_guarded() || !output_page.is_guarded()) {
+    std::cerr << "# the pages after the buffers are accessible" << std::endl;
+  }
+
+  if (!points && !json) {
+    printf("function,implementation,size,aligned_gb_per_s,"
+           "input_worst_gb_per_s,input_worst_offset,input_best_gb_per_s,"
+           "input_spread,output_worst_gb_per_s,output_worst_offset,"
+           "output_best_gb_per_s,output_spread,page_end_gb_per_s\n");
+  } else if (points && !json) {
+    printf("function,implementation,size,placement,offset,gb_per_s\n");
+  }
+  for (const kernel &func : kernels) {
+    if (!selected.runs(func.name)) {
+      continue;
+    }
+    const std::vector<char> &input = inputs[size_t(func.kind)];
+    const size_t length = fit_size(func.kind, input, size);
+    const size_t input_step = func.kind == input_kind::utf16 ? 2 : 1;
+    for (const simdutf::implementation *impl :
+         simdutf::get_available_implementations()) {
+      if (!selected.runs(*impl)) {
+        continue;
+      }
+      const std::string impl_name{impl->name()};
+      auto report = [&](const char *placement, size_t offset, double ns) {
+        const double gb_per_s = double(length) / ns;
+        if (!points) {
+          return gb_per_s;
+        }
+        if (json) {
+          printf("{\"function\": \"%s\", \"implementation\": \"%s\", "
+                 "\"size\": %zu, \"placement\": \"%s\", \"offset\": %zu, "
+                 "\"gb_per_s\": %.3f}\n",
+                 func.name, impl_name.c_str(), length, placement, offset,
+                 gb_per_s);
+        } else {
+          printf("%s,%s,%zu,%s,%zu,%.3f\n", func.name, impl_name.c_str(),
+                 length, placement, offset, gb_per_s);
+        }
+        fflush(stdout);
+        return gb_per_s;
+      };
+
+      // the expected result, and the size of the output
+      std::memcpy(aligned_input, input.data(), length);
+      const size_t expected =
+          func.run(*impl, aligned_input, length, aligned_output);
+      const size_t output_bytes = expected * func.output_unit;
+
+      sweep input_sweep;
+      double aligned = 0;
+      for (size_t offset = 0; offset <= max_offset; offset += input_step) {
+        std::memcpy(aligned_input + offset, input.data(), length);
+        const double gb_per_s =
+            report("input", offset,
+                   measure(func, *impl, aligned_input + offset, length,
+                           aligned_output, min_time_ns));
+        if (offset == 0) {
+          aligned = gb_per_s;
+        }
+        input_sweep.add(offset, gb_per_s);
+      }
+
+      sweep output_sweep;
+      if (func.output_unit != 0) {
+        std::memcpy(aligned_input, input.data(), length);
+        for (size_t offset = 0; offset <= max_offset;
+             offset += func.output_unit) {
+          output_sweep.add(offset, report("output", offset,
+                                          measure(func, *impl, aligned_input,
+                                                  length,
+                                                  aligned_output + offset,
+                                                  min_time_ns)));
+        }
+      }
+
+      char *const page_input = input_page.end() - length;
+      char *const page_output = func.output_unit != 0
+                                    ? output_page.end() - output_bytes
+                                    : aligned_output;
+      std::memcpy(page_input, input.data(), length);
+      if (func.run(*impl, page_input, length, page_output) != expected) {
+        std::cerr << func.name << " on " << impl_name
+                  << " gives another result at the end of a page"
+                  << std::endl;
+      }
+      const double page_end =
+          report("page_end", 0,
+                 measure(func, *impl, page_input, length, page_output,
+                         min_time_ns));
+      if (points) {
+        continue;
+      }
+
+      if (json) {
+        printf("{\"function\": \"%s\", \"implementation\": \"%s\", "
+               "\"size\": %zu, \"aligned_gb_per_s\": %.3f, "
+               "\"input_worst_gb_per_s\": %.3f, \"input_worst_offset\": %zu, "
+               "\"input_best_gb_per_s\": %.3f, \"input_spread\": %.1f, ",
+               func.name, impl_name.c_str(), length, aligned,
+               input_sweep.worst, input_sweep.worst_offset, input_sweep.best,
+               input_sweep.spread());
+        if (output_sweep.empty()) {
+          printf("\"output_worst_gb_per_s\": null, "
+                 "\"output_worst_offset\": null, "
+                 "\"output_best_gb_per_s\": null, \"output_spread\": null, ");
+        } else {
+          printf("\"output_worst_gb_per_s\": %.3f, "
+                 "\"output_worst_offset\": %zu, "
+                 "\"output_best_gb_per_s\": %.3f, \"output_spread\": %.1f, ",
+                 output_sweep.worst, output_sweep.worst_offset,
+                 output_sweep.best, output_sweep.spread());
+        }
+        printf("\"page_end_gb_per_s\": %.3f}\n", page_end);
+      } else {
+        printf("%s,%s,%zu,%.3f,%.3f,%zu,%.3f,%.1f,", func.name,
+               impl_name.c_str(), length, aligned, input_sweep.worst,
+               input_sweep.worst_offset, input_sweep.best,
+               input_sweep.spread());
+        if (output_sweep.empty()) {
+          printf(",,,,");
+        } else {
+          printf("%.3f,%zu,%.3f,%.1f,", output_sweep.worst,
+                 output_sweep.worst_offset, output_sweep.best,
+                 output_sweep.spread());
+        }
+        printf("%.3f\n", page_end);
+      }
+      fflush(stdout);
+    }
   }
   return EXIT_SUCCESS;
 }
@@ -0,0 +1,135 @@
+// Generators of base64 inputs as found in practice, for benchmarking the
+// decoders on something else than a single dense line.
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "simdutf.h"
+
+namespace base64_workloads {
+
+struct workload {
+  const char *name;
+  const char *description;
+  // the default number of bytes of binary data per input
+  size_t default_payload;
+};
+
+inline const workload workloads[] = {
+    {"mime", "MIME bodies, lines of 76 characters ending with CRLF", 64 * 1024},
+    {"pem", "the bodies of PEM blocks, lines of 64 characters ending with LF",
+     1536},
+    {"indented",
+     "base64 embedded in XML or YAML, lines of 72 characters indented by 4 "
+     "spaces",
+     8 * 1024},
+    {"jwt", "the segments of JSON web tokens, URL-safe and without padding",
+     0},
+    {"dataurl", "the payload of data: URLs, a single padded line", 16 * 1024},
+};
+
+inline const workload *find(const std::string &name) {
+  for (const workload &w : workloads) {
+    if (name == w.name) {
+      return &w;
+    }
+  }
+  return nullptr;
+}
+
+inline bool is_url_safe(const std::string &name) { return name == "jwt"; }
+
+namespace internal {
+
+inline std::vector<char> random_bytes(std::mt19937 &gen, size_t size) {
+  std::uniform_int_distribution<int> byte(0, 255);
+  std::vector<char> data(size);
+  for (char &c : data) {
+    c = char(byte(gen));
+  }
+  return data;
+}
+
+inline std::vector<char> encode(const std::vector<char> &binary,
+                                simdutf::base64_options options) {
+  std::vector<char> text(
+      simdutf::base64_length_from_binary(binary.size(), options));
+  text.resize(simdutf::binary_to_base64(binary.data(), binary.size(),
+                                        text.data(), options));
+  return text;
+}
+
+// Cuts the text in lines of the given length, each one starting with the
+// indentation and ending with the line break.
+inline std::vector<char> wrap(const std::vector<char> &text,
+                              size_t line_length, const std::string &indent,
+                              const std::string &line_break) {
+  std::vector<char> wrapped;
+  wrapped.reserve(text.size() +
+                  (text.size() / line_length + 1) *
+                      (indent.size() + line_break.size()));
+  for (size_t i = 0; i < text.size(); i += line_length) {
+    const size_t end = std::min(text.size(), i + line_length);
+    wrapped.insert(wrapped.end(), indent.begin(), indent.end());
+    wrapped.insert(wrapped.end(), text.begin() + i, text.begin() + end);
+    wrapped.insert(wrapped.end(), line_break.begin(), line_break.end());
+  }
+  return wrapped;
+}
+
+} // namespace internal
+
+/**
+ * Generates the inputs of the named workload, count inputs of payload bytes
+ * of binary data each (the default of the workload when payload is zero).
+ * The JSON web tokens ignore the payload: each token gives three inputs, a
+ * header, a claims set of 100 to 1000 bytes and an RS256 or HS256 signature.
+ * The same arguments always give the same inputs.
+ */
+inline std::vector<std::vector<char>>
+generate(const std::string &name, size_t count, size_t payload = 0) {
+  const workload *w = find(name);
+  if (w == nullptr) {
+    throw std::invalid_argument("unknown workload: " + name);
+  }
+  if (payload == 0) {
+    payload = w->default_payload;
+  }
+  std::mt19937 gen(1234);
+  std::vector<std::vector<char>> inputs;
+  for (size_t i = 0; i < count; i++) {
+    if (name == "jwt") {
+      const std::string header = R"({"alg":"RS256","typ":"JWT","kid":"k1"})";
+      const std::vector<char> header_bytes(header.begin(), header.end());
+      std::uniform_int_distribution<size_t> claims(100, 1000);
+      std::uniform_int_distribution<int> algorithm(0, 1);
+      inputs.push_back(internal::encode(header_bytes, simdutf::base64_url));
+      inputs.push_back(internal::encode(
+          internal::random_bytes(gen, claims(gen)), simdutf::base64_url));
+      inputs.push_back(internal::encode(
+          internal::random_bytes(gen, algorithm(gen) ? 256 : 32),
+          simdutf::base64_url));
+      continue;
+    }
+    const std::vector<char> text = internal::encode(
+        internal::random_bytes(gen, payload), simdutf::base64_default);
+    if (name == "mime") {
+      inputs.push_back(internal::wrap(text, 76, "", "\r\n"));
+    } else if (name == "pem") {
+      inputs.push_back(internal::wrap(text, 64, "", "\n"));
+    } else if (name == "indented") {
+      inputs.push_back(internal::wrap(text, 72, "    ", "\n"));
+    } else {
+      inputs.push_back(text);
+    }
+  }
+  return inputs;
+}
+
+} // namespace base64_workloads
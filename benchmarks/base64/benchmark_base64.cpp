@@ -16,6 +16,7 @@
 #include "simdutf.h"
 
 #include "arm_base64_spaces.h"
+#include "base64_workloads.h"
 
 #include "event_counter.h"
 
@@ -153,6 +154,15 @@ void show_help() {
   printf("  -b, --bench-bun    Bun benchmark\n");
   printf("  -L, --lengths      Benchmark only base64 length functions (maximal "
          "& exact)\n");
+  printf("  -w, --workload     Generate the inputs instead of reading "
+         "files:\n");
+  for (const auto &w : base64_workloads::workloads) {
+    printf("                       %-9s %s\n", w.name, w.description);
+  }
+  printf("  --count N          Number of generated inputs (default: about "
+         "4 MiB of data,\n"
+         "                     1000 tokens for jwt)\n");
+  printf("  --payload N        Bytes of binary data per generated input\n");
 
   printf(" See https://github.com/lemire/base64data for test data.\n");
 }
@@ -286,6 +296,8 @@ class Application {
   size_t max_size;
   BenchmarkMode benchmark_mode;
   NameMatcher name_matcher;
+  // the alphabet of the decoded inputs
+  simdutf::base64_options options;
 
   std::vector<char> buffer1;
   std::vector<char> buffer2;
@@ -295,8 +307,9 @@ class Application {
 
 public:
   Application(std::vector<std::vector<char>> data, BenchmarkMode bm,
-              NameMatcher nm)
-      : data(data), benchmark_mode(bm), name_matcher{nm} {
+              NameMatcher nm,
+              simdutf::base64_options options = simdutf::base64_default)
+      : data(data), benchmark_mode(bm), name_matcher{nm}, options(options) {
     if (not data.empty()) {
       volume = std::accumulate(
           data.begin(), data.end(), size_t(0),
@@ -395,6 +408,15 @@ private:
     }
   }
 
+  [[noreturn]] void report_decode_error(const std::vector<char> &source,
+                                        int error, size_t position) {
+    std::cerr << "Error: at position " << position << " out of "
+              << source.size() << std::endl;
+    throw std::runtime_error("Error: is input valid base64? " +
+                             std::to_string(error) + " at position " +
+                             std::to_string(position));
+  }
+
   template <typename Fn> void summarize(const std::string &name, Fn closure) {
     if (not can_run(name)) {
       return;
@@ -534,7 +556,12 @@ private:
 
     const bool spaces =
         benchmark_mode != BenchmarkMode::list ? contains_spaces(data) : false;
-    if (spaces) {
+    // libbase64 and OpenSSL only know the standard alphabet
+    const bool url = (options & simdutf::base64_url) != 0;
+    if (url) {
+      printf("# the base64 data is URL-safe, so we skip libbase64 and "
+             "openssl\n");
+    } else if (spaces) {
       printf("# the base64 data contains spaces, so we cannot use straight "
              "libbase64::base64_decode directly\n");
     } else {
@@ -553,45 +580,47 @@ private:
       });
     }
 
-    summarize("libbase64_space_decode", [this]() {
-      for (const std::vector<char> &source : data) {
+    if (!url) {
+      summarize("libbase64_space_decode", [this]() {
+        for (const std::vector<char> &source : data) {
 
-        size_t outlen;
-        bool ok = libbase64_space_decode(source.data(), source.size(),
-                                         buffer1.data(), &outlen);
-        if (!ok) {
-          std::cerr << "Error: "
-                    << " failed to decode base64 " << std::endl;
-          throw std::runtime_error("Error: failed to decode base64 ");
+          size_t outlen;
+          bool ok = libbase64_space_decode(source.data(), source.size(),
+                                           buffer1.data(), &outlen);
+          if (!ok) {
+            std::cerr << "Error: "
+                      << " failed to decode base64 " << std::endl;
+            throw std::runtime_error("Error: failed to decode base64 ");
+          }
         }
-      }
-    });
+      });
 
 #if SIMDUTF_IS_ARM64
-    // NEON: copy input into buffer2, compact whitespace in-place, then decode
-    // the cleaned base64 with a whitespace-unaware decoder (libbase64).
-    summarize("arm_neon_strip+libbase64", [this]() {
-      for (const std::vector<char> &source : data) {
-        size_t outlen;
-        bool ok = arm_base64_spaces::space_decode_inplace(
-            source.data(), source.size(), buffer2.data(), buffer1.data(),
-            &outlen);
-        if (!ok) {
-          std::cerr << "Error: "
-                    << " failed to decode base64 " << std::endl;
-          throw std::runtime_error("Error: failed to decode base64 ");
+      // NEON: copy input into buffer2, compact whitespace in-place, then decode
+      // the cleaned base64 with a whitespace-unaware decoder (libbase64).
+      summarize("arm_neon_strip+libbase64", [this]() {
+        for (const std::vector<char> &source : data) {
+          size_t outlen;
+          bool ok = arm_base64_spaces::space_decode_inplace(
+              source.data(), source.size(), buffer2.data(), buffer1.data(),
+              &outlen);
+          if (!ok) {
+            std::cerr << "Error: "
+                      << " failed to decode base64 " << std::endl;
+            throw std::runtime_error("Error: failed to decode base64 ");
+          }
         }
-      }
-    });
+      });
 #endif
 
-    summarize("openssl3.3.x", [this]() {
-      for (const std::vector<char> &source : data) {
-        int result = openssl3::base64_decode(buffer1.data(), buffer1.size(),
-                                             source.data(), source.size());
-        (void)result;
-      }
-    });
+      summarize("openssl3.3.x", [this]() {
+        for (const std::vector<char> &source : data) {
+          int result = openssl3::base64_decode(buffer1.data(), buffer1.size(),
+                                               source.data(), source.size());
+          (void)result;
+        }
+      });
+    }
 
     summarize("node", [this]() {
       for (const std::vector<char> &source : data) {
@@ -609,8 +638,8 @@ private:
 
       summarize(concatenate("simdutf::", e->name()), [this, &e]() {
         for (const std::vector<char> &source : data) {
-          auto err =
-              e->base64_to_binary(source.data(), source.size(), buffer1.data());
+          auto err = e->base64_to_binary(source.data(), source.size(),
+                                         buffer1.data(), options);
           if (err.error) {
             std::cerr << "Error: at position " << err.count << " out of "
                       << source.size() << std::endl;
@@ -630,7 +659,8 @@ private:
                   for (const std::vector<char> &source : data) {
                     auto err = e->base64_to_binary(
                         source.data(), source.size(), buffer1.data(),
-                        simdutf::base64_default_accept_garbage);
+                        simdutf::base64_options(
+                            options | simdutf::base64_default_accept_garbage));
                     if (err.error) {
                       std::cerr << "Error: at position " << err.count
                                 << " out of " << source.size() << std::endl;
@@ -646,6 +676,32 @@ private:
                   }
                 });
 
+      // the error and both positions, as the JavaScript runtimes need them
+      summarize(concatenate("simdutf::", e->name()) + " (details)",
+                [this, &e]() {
+                  for (const std::vector<char> &source : data) {
+                    auto r = e->base64_to_binary_details(
+                        source.data(), source.size(), buffer1.data(), options);
+                    if (r.error) {
+                      report_decode_error(source, r.error, r.input_count);
+                    }
+                  }
+                });
+
+      // decodes in chunks into a buffer of bounded size
+      summarize(concatenate("simdutf::base64_to_binary_safe_", e->name()),
+                [this]() {
+                  for (const std::vector<char> &source : data) {
+                    size_t len = buffer1.size();
+                    auto err = simdutf::base64_to_binary_safe(
+                        source.data(), source.size(), buffer1.data(), len,
+                        options);
+                    if (err.error) {
+                      report_decode_error(source, err.error, err.count);
+                    }
+                  }
+                });
+
 #if SIMDUTF_COMPILED_CXX_VERSION >= 20
       summarize(concatenate("simdutf::atomic_base64_to_binary_",
                             simdutf::get_active_implementation()->name()),
@@ -653,7 +709,8 @@ private:
                   for (const std::vector<char> &source : data) {
                     size_t len = buffer1.size();
                     auto err = simdutf::atomic_base64_to_binary_safe(
-                        source.data(), source.size(), buffer1.data(), len);
+                        source.data(), source.size(), buffer1.data(), len,
+                        options);
                     if (err.error) {
                       std::cerr << "Error: at position " << err.count
                                 << " out of " << source.size() << std::endl;
@@ -769,6 +826,9 @@ struct Options {
   BenchmarkMode benchmark_mode;
   MatchMode match_mode;
   std::vector<std::string> fragments;
+  std::string workload;
+  size_t count = 0;
+  size_t payload = 0;
 
   Options()
       : benchmark_mode(BenchmarkMode::roundtrip),
@@ -806,6 +866,16 @@ struct Options {
       } else if (arg == "-l") {
         benchmark_mode = BenchmarkMode::list;
         collect_files = true;
+      } else if (((arg == "-w") || (arg == "--workload")) && i + 1 < argc) {
+        workload = argv[++i];
+        if (base64_workloads::find(workload) == nullptr) {
+          fprintf(stderr, "unknown workload: %s\n", workload.c_str());
+          return ParseResult::Error;
+        }
+      } else if (arg == "--count" && i + 1 < argc) {
+        count = std::stoull(argv[++i]);
+      } else if (arg == "--payload" && i + 1 < argc) {
+        payload = std::stoull(argv[++i]);
       } else if ((arg == "-f") || (arg == "--filter")) {
         collect_files = false;
         match_mode = MatchMode::MatchAllFragments;
@@ -829,7 +899,7 @@ struct Options {
     case BenchmarkMode::decode:
     case BenchmarkMode::encode:
     case BenchmarkMode::lengths:
-      if (files.empty()) {
+      if (files.empty() && workload.empty()) {
         fprintf(stderr, "option %s: no files were given\n",
                 name(benchmark_mode));
         return ParseResult::Error;
@@ -875,7 +945,20 @@ int main(int argc, char **argv) {
   std::vector<std::vector<char>> input;
   if (options.benchmark_mode != BenchmarkMode::bun and
       options.benchmark_mode != BenchmarkMode::list) {
-    printf("# loading files: ");
+    if (!options.workload.empty()) {
+      const auto *w = base64_workloads::find(options.workload);
+      const size_t payload =
+          options.payload != 0 ? options.payload : w->default_payload;
+      size_t count = options.count;
+      if (count == 0) {
+        count = payload == 0 ? 1000 : std::max<size_t>(1, (4 << 20) / payload);
+      }
+      printf("# workload: %s (%s)\n", w->name, w->description);
+      input = base64_workloads::generate(options.workload, count, payload);
+    }
+    if (!options.files.empty()) {
+      printf("# loading files: ");
+    }
     const bool is_decode = options.benchmark_mode == BenchmarkMode::decode;
     for (const auto &arg : options.files) {
       try {
@@ -888,15 +971,21 @@ int main(int argc, char **argv) {
         return EXIT_FAILURE;
       }
     }
-    printf("\n");
-    if (is_decode) {
+    if (!options.files.empty()) {
+      printf("\n");
+    }
+    // the generated inputs are meant to keep their line breaks
+    if (is_decode && options.workload.empty()) {
       check_for_single_line(input);
     }
   }
 
   try {
     Application app(input, options.benchmark_mode,
-                    NameMatcher(options.match_mode, options.fragments));
+                    NameMatcher(options.match_mode, options.fragments),
+                    base64_workloads::is_url_safe(options.workload)
+                        ? simdutf::base64_url
+                        : simdutf::base64_default);
     app.run();
     return EXIT_SUCCESS;
   } catch (const std::exception &e) {
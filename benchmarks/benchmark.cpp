@@ -61,5 +61,12 @@ int main(int argc, char *argv[]) {
   }
 
   info_message();
-  return benchmark.run() ? EXIT_SUCCESS : EXIT_FAILURE;
+  bool success = benchmark.run();
+  if (cmdline.summary) {
+    benchmark.print_comparison(stdout);
+  }
+  if (!cmdline.json_output.empty()) {
+    success = benchmark.write_json(cmdline.json_output) && success;
+  }
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
 }
@@ -0,0 +1,133 @@
+#!/usr/bin/env python3
+"""
+Compares two result files written by `benchmark --json-output` and flags the
+statistically significant regressions, e.g., before upgrading simdutf:
+
+$ benchmark -P convert_utf8_to_utf16le -F file.txt --json-output old.json
+$ benchmark -P convert_utf8_to_utf16le -F file.txt --json-output new.json
+$ python3 benchmarks/compare_results.py old.json new.json
+
+The exit status is 1 when at least one procedure regressed, so that the script
+can gate a change.
+
+A procedure regresses when its median time per call grew by more than
+--threshold percent and when the difference of the medians exceeds --z times
+its standard error. The standard error of each median is estimated from the
+median absolute deviation (MAD) as 1.2533 * 1.4826 * MAD / sqrt(samples).
+Since consecutive batches are not independent and since the machine changes
+between two runs, the relative threshold matters as much as the test: keep it
+above the noise you observe when comparing two runs of the same build.
+"""
+
+import argparse
+import json
+import math
+import sys
+
+SCHEMA = 'simdutf-benchmark'
+SCHEMA_VERSION = 1
+
+
+def load(path):
+    with open(path) as f:
+        document = json.load(f)
+    if document.get('schema') != SCHEMA:
+        raise ValueError('%s is not a simdutf benchmark result file' % path)
+    if document.get('schema_version') != SCHEMA_VERSION:
+        raise ValueError('%s has the schema version %s, expected %d' %
+                         (path, document.get('schema_version'), SCHEMA_VERSION))
+    results = {}
+    for result in document['results']:
+        key = (result['procedure'], result['input'], result['input_size'])
+        results[key] = result
+    return document, results
+
+
+def standard_error(result):
+    sigma = 1.4826 * result['mad_ns']
+    # the timer resolution makes the MAD zero on very stable measures
+    sigma = max(sigma, 0.001 * result['median_ns'])
+    return 1.2533 * sigma / math.sqrt(max(result['samples'], 1))
+
+
+def compare(old, new, threshold, z_threshold):
+    old_time = old['median_ns']
+    new_time = new['median_ns']
+    change = (new_time / old_time - 1) * 100
+    error = math.hypot(standard_error(old), standard_error(new))
+    z = (new_time - old_time) / error
+    if change > threshold and z > z_threshold:
+        verdict = 'REGRESSION'
+    elif change < -threshold and z < -z_threshold:
+        verdict = 'improvement'
+    else:
+        verdict = ''
+    return change, z, verdict
+
+
+def format_counter(old, new, field):
+    if old.get(field) is None or new.get(field) is None:
+        return '-'
+    return '%.3f -> %.3f' % (old[field], new[field])
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=__doc__, formatter_class=argparse.RawTextHelpFormatter)
+    parser.add_argument('old', help='the reference results')
+    parser.add_argument('new', help='the results to check')
+    parser.add_argument('--threshold', type=float, default=5.0,
+                        help='smallest relative slowdown reported, in percent '
+                             '(default: 5)')
+    parser.add_argument('--z', type=float, default=3.0,
+                        help='number of standard errors that the difference '
+                             'must exceed (default: 3)')
+    args = parser.parse_args()
+
+    try:
+        old_document, old_results = load(args.old)
+        new_document, new_results = load(args.new)
+    except (OSError, ValueError, KeyError) as e:
+        print(e, file=sys.stderr)
+        return 2
+
+    for field in ('simdutf_version', 'implementation', 'mode'):
+        if old_document.get(field) != new_document.get(field):
+            print('%s: %s -> %s' % (field, old_document.get(field),
+                                    new_document.get(field)))
+    if old_document.get('mode') != new_document.get('mode'):
+        print('warning: the results were not measured in the same mode')
+
+    rows = [('procedure', 'input', 'size', 'old GB/s', 'new GB/s', 'change',
+             'z', 'ins/byte', '')]
+    regressions = 0
+    for key in sorted(old_results.keys() & new_results.keys()):
+        old = old_results[key]
+        new = new_results[key]
+        change, z, verdict = compare(old, new, args.threshold, args.z)
+        regressions += verdict == 'REGRESSION'
+        rows.append((key[0], key[1], str(key[2]), '%.3f' % old['gb_per_s'],
+                     '%.3f' % new['gb_per_s'], '%+.1f %%' % change,
+                     '%+.1f' % z,
+                     format_counter(old, new, 'instructions_per_byte'),
+                     verdict))
+
+    widths = [max(len(row[i]) for row in rows) for i in range(len(rows[0]))]
+    for row in rows:
+        print('  '.join(cell.ljust(width)
+                        for cell, width in zip(row, widths)).rstrip())
+
+    for key in sorted(old_results.keys() - new_results.keys()):
+        print('only in %s: %s on %s' % (args.old, key[0], key[1]))
+    for key in sorted(new_results.keys() - old_results.keys()):
+        print('only in %s: %s on %s' % (args.new, key[0], key[1]))
+
+    if regressions:
+        print('%d regression(s) (slower by more than %.1f %% and %.1f '
+              'standard errors)' % (regressions, args.threshold, args.z))
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
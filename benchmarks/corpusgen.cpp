@@ -0,0 +1,50 @@
+// Writes a generated multilingual UTF-8 corpus (see src/corpus.h) to a file,
+// so that the same text can be given to every benchmark program and to
+// other tools:
+//
+//   corpusgen size=16M,ascii=70,latin=15,cjk=10,emoji=5,errors=3 mix.txt
+//
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+#include "corpus.h"
+
+int main(int argc, char *argv[]) {
+  if (argc != 3) {
+    std::cerr << "Usage: " << argv[0] << " <spec> <output file>\n"
+              << "The spec is a list of key=value separated by commas, with "
+                 "the keys\n"
+              << "size, ascii, latin, cjk, emoji, supplementary, run, errors, "
+                 "error-at,\n"
+              << "error-kind and seed.\n";
+    return EXIT_FAILURE;
+  }
+  try {
+    const simdutf::benchmarks::corpus_spec spec =
+        simdutf::benchmarks::corpus_spec::parse(argv[1]);
+    std::vector<size_t> errors;
+    const std::vector<uint8_t> data =
+        simdutf::benchmarks::generate_corpus(spec, &errors);
+    std::ofstream output(argv[2], std::ios::binary);
+    output.write(reinterpret_cast<const char *>(data.data()),
+                 std::streamsize(data.size()));
+    if (!output) {
+      std::cerr << "Cannot write " << argv[2] << "\n";
+      return EXIT_FAILURE;
+    }
+    printf("%s\n", spec.to_string().c_str());
+    printf("invalid sequences at:");
+    for (const size_t position : errors) {
+      printf(" %zu", position);
+    }
+    printf("%s\n", errors.empty() ? " none" : "");
+  } catch (const std::exception &e) {
+    std::cerr << e.what() << "\n";
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,299 @@
+// This benchmark program measures the functions that report the position of
+// the first error (the _with_errors functions) on invalid UTF-8, for every
+// implementation supported by the processor. The fast kernels validate whole
+// blocks and, when a block is invalid, go back to find the exact position of
+// the error with scalar code: the program compares the time to reach an
+// error with the time to process the valid text that precedes it, so that
+// the cost of the error path can be measured and optimized.
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "simdutf.h"
+
+#include "corpus.h"
+#include "kernels.h"
+
+namespace {
+
+using simdutf::benchmarks::best_time_ns;
+using simdutf::benchmarks::corpus_spec;
+using simdutf::benchmarks::generate_corpus;
+using simdutf::benchmarks::parse_size;
+using simdutf::benchmarks::selection;
+using simdutf::benchmarks::selection_option;
+
+struct error_kernel {
+  const char *name;
+  simdutf::result (*run)(const simdutf::implementation &impl,
+                         const char *input, size_t size, char *output);
+};
+
+const error_kernel error_kernels[] = {
+    {"validate_utf8_with_errors",
+     [](const simdutf::implementation &impl, const char *input, size_t size,
+        char *) { return impl.validate_utf8_with_errors(input, size); }},
+    {"convert_utf8_to_utf16le_with_errors",
+     [](const simdutf::implementation &impl, const char *input, size_t size,
+        char *output) {
+       return impl.convert_utf8_to_utf16le_with_errors(
+           input, size, reinterpret_cast<char16_t *>(output));
+     }},
+    {"convert_utf8_to_utf32_with_errors",
+     [](const simdutf::implementation &impl, const char *input, size_t size,
+        char *output) {
+       return impl.convert_utf8_to_utf32_with_errors(
+           input, size, reinterpret_cast<char32_t *>(output));
+     }},
+};
+
+// Processes the whole input as a decoder that replaces the invalid sequences
+// does: after each error, it skips the invalid byte and the continuation
+// bytes that follow, and resumes. Returns the number of errors.
+size_t run_through(const error_kernel &func,
+                   const simdutf::implementation &impl, const char *input,
+                   size_t size, char *output) {
+  size_t errors = 0;
+  size_t position = 0;
+  while (position < size) {
+    const simdutf::result r =
+        func.run(impl, input + position, size - position, output);
+    if (r.error == simdutf::error_code::SUCCESS) {
+      break;
+    }
+    errors++;
+    position += r.count + 1;
+    while (position < size && (uint8_t(input[position]) & 0xc0) == 0x80) {
+      position++;
+    }
+  }
+  return errors;
+}
+
+struct named_position {
+  const char *name;
+  double fraction; // of the input size
+};
+
+const named_position positions[] = {
+    {"start", 0},
+    {"quarter", 0.25},
+    {"middle", 0.5},
+    {"three-quarters", 0.75},
+    {"end", 1},
+};
+
+struct row {
+  const char *function;
+  std::string implementation;
+  size_t size;
+  std::string scenario;
+  size_t errors;
+  size_t reached;  // bytes before the first error, or the whole input
+  double ns;       // per call, or per pass over the input
+  double valid_ns; // the same bytes, without the error
+};
+
+void print_row(const row &r, bool json) {
+  const double gb_per_s = r.ns > 0 ? double(r.reached) / r.ns : 0;
+  if (json) {
+    printf("{\"function\": \"%s\", \"implementation\": \"%s\", "
+           "\"size\": %zu, \"scenario\": \"%s\", \"errors\": %zu, "
+           "\"reached\": %zu, \"ns\": %.1f, \"gb_per_s\": %.3f, "
+           "\"valid_ns\": %.1f, \"overhead_ns\": %.1f}\n",
+           r.function, r.implementation.c_str(), r.size, r.scenario.c_str(),
+           r.errors, r.reached, r.ns, gb_per_s, r.valid_ns,
+           r.ns - r.valid_ns);
+  } else {
+    printf("%s,%s,%zu,%s,%zu,%zu,%.1f,%.3f,%.1f,%.1f\n", r.function,
+           r.implementation.c_str(), r.size, r.scenario.c_str(), r.errors,
+           r.reached, r.ns, gb_per_s, r.valid_ns, r.ns - r.valid_ns);
+  }
+  fflush(stdout);
+}
+
+void print_help(const char *program) {
+  printf("Usage: %s [options]\n", program);
+  printf(R"txt(
+Measures the _with_errors functions on generated UTF-8 text (see the --corpus
+option of the benchmark program) with a single invalid sequence at the start,
+a quarter, the middle, three quarters and the end of the input, and with
+invalid sequences spread evenly at several densities.
+
+For a single error, a call stops at the error: the program reports the bytes
+before the error (reached), the time of the call, the time of the same call
+on the valid text up to the error (valid_ns) and the difference, which is the
+cost of the error path. For the densities, the whole input is processed,
+resuming after each error as a decoder that replaces the invalid sequences
+does, and compared with one call on the valid input.
+
+Options:
+  --corpus <spec>            the valid text (default
+                             size=64K,ascii=70,latin=10,cjk=15,emoji=5), any
+                             error in the description is ignored
+  --error-kind <n>           the kind of the single error, 0 to 5 (default 0,
+                             see error-kind in the corpus description)
+  --errors <n>               a density, as errors per input (may be repeated,
+                             default 4, 32 and 256)
+  --min-time-ms <ms>         time spent per measure (default 20)
+  --function <name>          only this function (may be repeated)
+  --implementation <name>    only this implementation (may be repeated)
+  --json                     print JSON lines instead of CSV
+  --list                     list the functions
+  --help                     show this help
+)txt");
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+  std::string description = "size=64K,ascii=70,latin=10,cjk=15,emoji=5";
+  size_t error_kind = 0;
+  std::set<size_t> densities;
+  double min_time_ns = 20e6;
+  bool json = false;
+  selection selected;
+
+  try {
+    for (int i = 1; i < argc; ++i) {
+      const selection_option option =
+          simdutf::benchmarks::parse_selection_option(
+              argc, argv, i, error_kernels, selected, false);
+      if (option == selection_option::listed) {
+        return EXIT_SUCCESS;
+      } else if (option == selection_option::parsed) {
+        continue;
+      }
+      if (strcmp(argv[i], "--corpus") == 0 && i + 1 < argc) {
+        description = argv[++i];
+      } else if (strcmp(argv[i], "--error-kind") == 0 && i + 1 < argc) {
+        error_kind = std::stoull(argv[++i]);
+      } else if (strcmp(argv[i], "--errors") == 0 && i + 1 < argc) {
+        densities.insert(std::max<size_t>(1, parse_size(argv[++i])));
+      } else if (strcmp(argv[i], "--min-time-ms") == 0 && i + 1 < argc) {
+        min_time_ns = std::stod(argv[++i]) * 1e6;
+      } else if (strcmp(argv[i], "--json") == 0) {
+        json = true;
+      } else if (strcmp(argv[i], "--help") == 0 ||
+                 strcmp(argv[i], "-h") == 0) {
+        print_help(argv[0]);
+        return EXIT_SUCCESS;
+      } else {
+        print_help(argv[0]);
+        return EXIT_FAILURE;
+      }
+    }
+  } catch (const std::exception &e) {
+    std::cerr << e.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (!simdutf::benchmarks::check_functions(error_kernels, selected)) {
+    return EXIT_FAILURE;
+  }
+  if (densities.empty()) {
+    densities = {4, 32, 256};
+  }
+
+  corpus_spec valid_spec;
+  try {
+    valid_spec = corpus_spec::parse(description + ",error-kind=" +
+                                    std::to_string(error_kind));
+  } catch (const std::exception &e) {
+    std::cerr << e.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+  valid_spec.error_positions.clear();
+  valid_spec.errors = 0;
+  const std::vector<uint8_t> valid_bytes = generate_corpus(valid_spec);
+  const std::vector<char> valid(valid_bytes.begin(), valid_bytes.end());
+  const size_t size = valid.size();
+  std::vector<char> output(4 * size + 64);
+
+  // The inputs with one error, each one with the position of the error.
+  std::vector<std::pair<std::string, std::vector<char>>> single;
+  for (const named_position &where : positions) {
+    corpus_spec spec = valid_spec;
+    // leave room for the longest invalid sequence at the end
+    spec.error_positions.push_back(
+        std::min(size_t(where.fraction * double(size)), size - 8));
+    std::vector<size_t> errors_at;
+    const std::vector<uint8_t> bytes = generate_corpus(spec, &errors_at);
+    if (errors_at.empty()) {
+      continue;
+    }
+    single.emplace_back(where.name, std::vector<char>(bytes.begin(),
+                                                      bytes.end()));
+  }
+  std::vector<std::pair<size_t, std::vector<char>>> dense;
+  for (const size_t errors : densities) {
+    corpus_spec spec = valid_spec;
+    spec.errors = errors;
+    const std::vector<uint8_t> bytes = generate_corpus(spec);
+    dense.emplace_back(errors,
+                       std::vector<char>(bytes.begin(), bytes.end()));
+  }
+
+  if (!json) {
+    printf("function,implementation,size,scenario,errors,reached,ns,gb_per_s,"
+           "valid_ns,overhead_ns\n");
+  }
+  for (const error_kernel &func : error_kernels) {
+    if (!selected.runs(func.name)) {
+      continue;
+    }
+    for (const simdutf::implementation *impl :
+         simdutf::get_available_implementations()) {
+      if (!selected.runs(*impl)) {
+        continue;
+      }
+      const std::string impl_name{impl->name()};
+      auto time_call = [&](const char *input, size_t length) {
+        return best_time_ns(
+            [&] { return func.run(*impl, input, length, output.data()).count; },
+            min_time_ns);
+      };
+
+      const double valid_ns = time_call(valid.data(), size);
+      print_row({func.name, impl_name, size, "valid", 0, size, valid_ns,
+                 valid_ns},
+                json);
+      for (const auto &input : single) {
+        const simdutf::result r =
+            func.run(*impl, input.second.data(), size, output.data());
+        if (r.error == simdutf::error_code::SUCCESS) {
+          std::cerr << func.name << " on " << impl_name
+                    << " found no error at the " << input.first << std::endl;
+          continue;
+        }
+        print_row({func.name, impl_name, size, input.first, 1, r.count,
+                   time_call(input.second.data(), size),
+                   time_call(valid.data(), r.count)},
+                  json);
+      }
+      for (const auto &input : dense) {
+        const size_t errors = run_through(func, *impl, input.second.data(),
+                                          size, output.data());
+        const double ns = best_time_ns(
+            [&] {
+              return run_through(func, *impl, input.second.data(), size,
+                                 output.data());
+            },
+            min_time_ns);
+        print_row({func.name, impl_name, size,
+                   "density-" + std::to_string(input.first), errors, size, ns,
+                   valid_ns},
+                  json);
+      }
+    }
+  }
+  return EXIT_SUCCESS;
+}
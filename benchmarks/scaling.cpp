@@ -0,0 +1,338 @@
+// This benchmark program measures how the throughput of each function grows
+// with the number of threads, each thread being pinned to its own core and
+// working on its own buffers, larger than the caches. The aggregate
+// throughput stops growing once the memory bandwidth is saturated: the knee
+// of the curve tells how many worker threads are worth running per function.
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+  #include <pthread.h>
+  #include <sched.h>
+#endif
+
+#include "simdutf.h"
+
+#include "kernels.h"
+
+namespace {
+
+using simdutf::benchmarks::fit_size;
+using simdutf::benchmarks::kernel;
+using simdutf::benchmarks::kernels;
+using simdutf::benchmarks::parse_size;
+using simdutf::benchmarks::selection;
+using simdutf::benchmarks::selection_option;
+
+// The processors this program may run on, in the order they are used.
+std::vector<int> allowed_cpus() {
+  std::vector<int> cpus;
+#if defined(__linux__)
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+    for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+      if (CPU_ISSET(cpu, &set)) {
+        cpus.push_back(cpu);
+      }
+    }
+  }
+#endif
+  if (cpus.empty()) {
+    const unsigned count = std::max(1u, std::thread::hardware_concurrency());
+    for (unsigned cpu = 0; cpu < count; cpu++) {
+      cpus.push_back(int(cpu));
+    }
+  }
+  return cpus;
+}
+
+// Pins the calling thread, returns false when it is not supported.
+bool pin_to(int cpu) {
+#if defined(__linux__)
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(cpu, &set);
+  return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+  (void)cpu;
+  return false;
+#endif
+}
+
+std::vector<size_t> parse_list(const char *text) {
+  std::vector<size_t> values;
+  const std::string list{text};
+  size_t start = 0;
+  while (start < list.size()) {
+    size_t end = list.find(',', start);
+    if (end == std::string::npos) {
+      end = list.size();
+    }
+    values.push_back(std::stoull(list.substr(start, end - start)));
+    start = end + 1;
+  }
+  return values;
+}
+
+std::atomic<bool> pinning_failed{false};
+
+// Runs the function on the given number of threads for about min_time_ns and
+// returns the throughput of each thread in GB/s. Every thread copies the
+// input into its own buffer, so that the memory is local to its node.
+std::vector<double> run_threads(const kernel &func,
+                                const simdutf::implementation &impl,
+                                const std::vector<char> &input, size_t size,
+                                const std::vector<int> &cpus, size_t threads,
+                                double min_time_ns) {
+  std::atomic<size_t> ready{0};
+  std::atomic<bool> go{false};
+  std::atomic<bool> stop{false};
+  std::vector<double> throughputs(threads);
+  std::vector<std::thread> workers;
+  for (size_t t = 0; t < threads; t++) {
+    workers.emplace_back([&, t] {
+      if (!pin_to(cpus[t % cpus.size()])) {
+        pinning_failed = true;
+      }
+      std::vector<char> local(input.begin(), input.begin() + size);
+      std::vector<char> output(4 * size + 64, 0);
+      volatile size_t sink = func.run(impl, local.data(), size, output.data());
+      ready++;
+      while (!go) {
+        std::this_thread::yield();
+      }
+      size_t calls = 0;
+      const auto start = std::chrono::steady_clock::now();
+      do {
+        sink = sink + func.run(impl, local.data(), size, output.data());
+        calls++;
+      } while (!stop);
+      const std::chrono::duration<double, std::nano> elapsed =
+          std::chrono::steady_clock::now() - start;
+      throughputs[t] = double(calls) * double(size) / elapsed.count();
+    });
+  }
+  while (ready < threads) {
+    std::this_thread::yield();
+  }
+  go = true;
+  std::this_thread::sleep_for(
+      std::chrono::nanoseconds(static_cast<long long>(min_time_ns)));
+  stop = true;
+  for (std::thread &worker : workers) {
+    worker.join();
+  }
+  return throughputs;
+}
+
+void print_help(const char *program) {
+  printf("Usage: %s [options] [<filename>]\n", program);
+  printf(R"txt(
+Runs every function on 1, 2, ... threads pinned to distinct processors, each
+thread working on its own buffers, and reports the aggregate throughput, the
+throughput per thread, the efficiency (relative to as many single threads)
+and the knee: the fewest threads that reach a given share of the best
+aggregate throughput.
+
+Options:
+  --size <size>              input per thread (default 16M); accepts the
+                             suffixes K, M and G
+  --threads <n,n,...>        thread counts (default 1 to the number of
+                             processors)
+  --cpus <n,n,...>           processors to pin the threads to, in order
+                             (default all the allowed ones, by number)
+  --min-time-ms <ms>         time spent per thread count (default 200)
+  --knee <fraction>          share of the best throughput that defines the
+                             knee (default 0.9)
+  --function <name>          only this function (may be repeated)
+  --implementation <name>    use this implementation (default: the active one)
+  --json                     print one JSON object per function
+  --list                     list the functions
+  --help                     show this help
+
+The input is synthetic, mostly ASCII, text, or the content of the file,
+repeated as needed. Each thread needs about 6 times --size bytes. To measure
+physical cores rather than hardware threads, list one processor per core
+with --cpus.
+)txt");
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+  size_t size = size_t(16) * 1024 * 1024;
+  std::vector<size_t> thread_counts;
+  std::vector<int> cpus = allowed_cpus();
+  double min_time_ns = 200e6;
+  double knee_share = 0.9;
+  bool json = false;
+  selection selected;
+
+  try {
+    for (int i = 1; i < argc; ++i) {
+      const selection_option option =
+          simdutf::benchmarks::parse_selection_option(argc, argv, i, kernels,
+                                                      selected);
+      if (option == selection_option::listed) {
+        return EXIT_SUCCESS;
+      } else if (option == selection_option::parsed) {
+        continue;
+      }
+      if (strcmp(argv[i], "--size") == 0 && i + 1 < argc) {
+        size = std::max<size_t>(4, parse_size(argv[++i]));
+      } else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+        thread_counts = parse_list(argv[++i]);
+      } else if (strcmp(argv[i], "--cpus") == 0 && i + 1 < argc) {
+        cpus.clear();
+        for (const size_t cpu : parse_list(argv[++i])) {
+          cpus.push_back(int(cpu));
+        }
+      } else if (strcmp(argv[i], "--min-time-ms") == 0 && i + 1 < argc) {
+        min_time_ns = std::stod(argv[++i]) * 1e6;
+      } else if (strcmp(argv[i], "--knee") == 0 && i + 1 < argc) {
+        knee_share = std::stod(argv[++i]);
+      } else if (strcmp(argv[i], "--json") == 0) {
+        json = true;
+      } else if (strcmp(argv[i], "--help") == 0 ||
+                 strcmp(argv[i], "-h") == 0) {
+        print_help(argv[0]);
+        return EXIT_SUCCESS;
+      } else {
+        print_help(argv[0]);
+        return EXIT_FAILURE;
+      }
+    }
+  } catch (const std::exception &) {
+    print_help(argv[0]);
+    return EXIT_FAILURE;
+  }
+  if (selected.implementations.size() > 1) {
+    print_help(argv[0]); // a single implementation
+    return EXIT_FAILURE;
+  }
+  if (!simdutf::benchmarks::check_functions(kernels, selected)) {
+    return EXIT_FAILURE;
+  }
+  if (cpus.empty()) {
+    std::cerr << "No processor to run on" << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (thread_counts.empty()) {
+    for (size_t threads = 1; threads <= cpus.size(); threads++) {
+      thread_counts.push_back(threads);
+    }
+  }
+  thread_counts.erase(std::remove(thread_counts.begin(), thread_counts.end(),
+                                  size_t(0)),
+                      thread_counts.end());
+  std::sort(thread_counts.begin(), thread_counts.end());
+  thread_counts.erase(std::unique(thread_counts.begin(), thread_counts.end()),
+                      thread_counts.end());
+  if (thread_counts.empty()) {
+    print_help(argv[0]);
+    return EXIT_FAILURE;
+  }
+  if (thread_counts.back() > cpus.size()) {
+    std::cerr << "warning: more threads than processors ("
+              << thread_counts.back() << " > " << cpus.size()
+              << "), some threads share a processor" << std::endl;
+  }
+
+  const simdutf::implementation *impl =
+      simdutf::get_active_implementation();
+  if (!selected.implementations.empty()) {
+    impl = simdutf::get_available_implementations()
+        [*selected.implementations.begin()];
+  }
+  if (impl == nullptr || !selected.runs(*impl)) {
+    std::cerr << "Unsupported implementation: "
+              << *selected.implementations.begin() << std::endl;
+    return EXIT_FAILURE;
+  }
+  const std::string impl_name{impl->name()};
+
+  std::vector<char> file;
+  if (selected.filename != nullptr &&
+      !simdutf::benchmarks::load_utf8_input(selected.filename, file)) {
+    return EXIT_FAILURE;
+  }
+  const std::array<std::vector<char>, 4> inputs =
+      simdutf::benchmarks::make_inputs(file, size);
+
+  for (const kernel &func : kernels) {
+    if (!selected.runs(func.name)) {
+      continue;
+    }
+    const std::vector<char> &input = inputs[size_t(func.kind)];
+    const size_t input_size = fit_size(func.kind, input, size);
+    std::vector<double> aggregates;
+    std::vector<double> efficiencies;
+    double single = 0;
+    for (const size_t threads : thread_counts) {
+      const std::vector<double> throughputs = run_threads(
+          func, *impl, input, input_size, cpus, threads, min_time_ns);
+      double aggregate = 0;
+      for (const double throughput : throughputs) {
+        aggregate += throughput;
+      }
+      if (single == 0) {
+        // the efficiency is relative to the smallest thread count
+        single = aggregate / double(threads);
+      }
+      aggregates.push_back(aggregate);
+      efficiencies.push_back(aggregate / double(threads) / single);
+    }
+    const double peak = *std::max_element(aggregates.begin(), aggregates.end());
+    size_t knee = 0;
+    while (aggregates[knee] < knee_share * peak) {
+      knee++;
+    }
+
+    if (json) {
+      printf("{\"function\": \"%s\", \"implementation\": \"%s\", "
+             "\"size_per_thread\": %zu, \"threads\": [",
+             func.name, impl_name.c_str(), input_size);
+      for (size_t i = 0; i < thread_counts.size(); i++) {
+        printf("%s%zu", i == 0 ? "" : ", ", thread_counts[i]);
+      }
+      printf("], \"gb_per_s\": [");
+      for (size_t i = 0; i < aggregates.size(); i++) {
+        printf("%s%.3f", i == 0 ? "" : ", ", aggregates[i]);
+      }
+      printf("], \"efficiency\": [");
+      for (size_t i = 0; i < efficiencies.size(); i++) {
+        printf("%s%.3f", i == 0 ? "" : ", ", efficiencies[i]);
+      }
+      printf("], \"peak_gb_per_s\": %.3f, \"knee_threads\": %zu}\n", peak,
+             thread_counts[knee]);
+    } else {
+      printf("%s (%s), %zu bytes per thread\n", func.name, impl_name.c_str(),
+             input_size);
+      printf("%8s %12s %12s %11s\n", "threads", "GB/s", "GB/s/thread",
+             "efficiency");
+      for (size_t i = 0; i < thread_counts.size(); i++) {
+        printf("%8zu %12.3f %12.3f %9.1f %%\n", thread_counts[i],
+               aggregates[i], aggregates[i] / double(thread_counts[i]),
+               efficiencies[i] * 100);
+      }
+      printf("knee: %zu thread(s) reach %.0f %% of the peak of %.3f GB/s\n\n",
+             thread_counts[knee], knee_share * 100, peak);
+    }
+    fflush(stdout);
+  }
+  if (pinning_failed) {
+    std::cerr << "warning: the threads could not be pinned" << std::endl;
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,197 @@
+// This benchmark program sweeps the input size, from a single byte to
+// hundreds of megabytes, for every implementation supported by the processor,
+// so that the throughput curves cover the L1, L2, last-level cache and
+// memory regimes. It prints one CSV line (or JSON object) per function,
+// implementation and size, to find the crossovers between implementations
+// and to set batching thresholds.
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "simdutf.h"
+
+#include "event_counter.h"
+#include "kernels.h"
+
+namespace {
+
+using simdutf::benchmarks::fit_size;
+using simdutf::benchmarks::kernel;
+using simdutf::benchmarks::kernels;
+using simdutf::benchmarks::parse_size;
+using simdutf::benchmarks::selection;
+using simdutf::benchmarks::selection_option;
+
+struct sweep_point {
+  double ns;     // best time per call
+  double error;  // (average - best) / average
+  double cycles; // per call, when has_events
+  double instructions;
+  bool has_events; // whether the performance counters are available
+};
+
+event_collector collector;
+
+// Keeps the best batch of calls (see best_time_ns), with its counters.
+sweep_point measure(const kernel &func, const simdutf::implementation &impl,
+                    const char *input, size_t size, char *output,
+                    double min_time_ns) {
+  event_aggregate aggregate{};
+  simdutf::benchmarks::best_time_ns(
+      [&] { return func.run(impl, input, size, output); }, min_time_ns,
+      &collector, &aggregate);
+  return sweep_point{aggregate.best.elapsed_ns(),
+                     (aggregate.elapsed_ns() - aggregate.best.elapsed_ns()) /
+                         aggregate.elapsed_ns(),
+                     aggregate.best.cycles(), aggregate.best.instructions(),
+                     collector.has_events()};
+}
+
+void print_help(const char *program) {
+  printf("Usage: %s [options] [<filename>]\n", program);
+  printf(R"txt(
+Sweeps the input size for every function and every implementation supported
+by this processor, and prints the throughput curves as CSV (or JSON).
+
+Options:
+  --min-size <size>          smallest input (default 1)
+  --max-size <size>          largest input (default 64M); the sizes accept
+                             the suffixes K, M and G
+  --steps-per-octave <n>     sizes per doubling (default 2)
+  --min-time-ms <ms>         time spent per point (default 20)
+  --function <name>          only this function (may be repeated)
+  --implementation <name>    only this implementation (may be repeated)
+  --json                     print JSON lines instead of CSV
+  --list                     list the functions
+  --help                     show this help
+
+The input is synthetic, mostly ASCII, text, or the content of the file,
+repeated as needed. The functions on Latin 1, ASCII and binary inputs run on
+ASCII. The memory use is about 8 times the largest size.
+)txt");
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+  size_t min_size = 1;
+  size_t max_size = size_t(64) * 1024 * 1024;
+  size_t steps_per_octave = 2;
+  double min_time_ns = 20e6;
+  bool json = false;
+  selection selected;
+
+  for (int i = 1; i < argc; ++i) {
+    const selection_option option = simdutf::benchmarks::parse_selection_option(
+        argc, argv, i, kernels, selected);
+    if (option == selection_option::listed) {
+      return EXIT_SUCCESS;
+    } else if (option == selection_option::parsed) {
+      continue;
+    }
+    if (strcmp(argv[i], "--min-size") == 0 && i + 1 < argc) {
+      min_size = std::max<size_t>(1, parse_size(argv[++i]));
+    } else if (strcmp(argv[i], "--max-size") == 0 && i + 1 < argc) {
+      max_size = parse_size(argv[++i]);
+    } else if (strcmp(argv[i], "--steps-per-octave") == 0 && i + 1 < argc) {
+      steps_per_octave = std::max<size_t>(1, std::stoull(argv[++i]));
+    } else if (strcmp(argv[i], "--min-time-ms") == 0 && i + 1 < argc) {
+      min_time_ns = std::stod(argv[++i]) * 1e6;
+    } else if (strcmp(argv[i], "--json") == 0) {
+      json = true;
+    } else if (strcmp(argv[i], "--help") == 0 || strcmp(argv[i], "-h") == 0) {
+      print_help(argv[0]);
+      return EXIT_SUCCESS;
+    } else {
+      print_help(argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+  if (!simdutf::benchmarks::check_functions(kernels, selected)) {
+    return EXIT_FAILURE;
+  }
+
+  std::vector<char> file;
+  if (selected.filename != nullptr &&
+      !simdutf::benchmarks::load_utf8_input(selected.filename, file)) {
+    return EXIT_FAILURE;
+  }
+
+  // The inputs of each kind, of at least max_size bytes.
+  const std::array<std::vector<char>, 4> inputs =
+      simdutf::benchmarks::make_inputs(file, max_size);
+  std::vector<char> output(4 * max_size + 64);
+  // touch the output once, so that the first points do not pay the page
+  // faults
+  std::fill(output.begin(), output.end(), 0);
+
+  std::vector<size_t> sizes;
+  for (double size = double(min_size); size <= double(max_size);
+       size *= std::pow(2.0, 1.0 / double(steps_per_octave))) {
+    const size_t rounded = size_t(std::llround(size));
+    if (sizes.empty() || rounded != sizes.back()) {
+      sizes.push_back(rounded);
+    }
+  }
+
+  if (!json) {
+    printf("function,implementation,size,ns,gb_per_s,error,cycles_per_byte,"
+           "instructions_per_byte\n");
+  }
+  for (const kernel &func : kernels) {
+    if (!selected.runs(func.name)) {
+      continue;
+    }
+    const std::vector<char> &input = inputs[size_t(func.kind)];
+    for (const simdutf::implementation *impl :
+         simdutf::get_available_implementations()) {
+      if (!selected.runs(*impl)) {
+        continue;
+      }
+      const std::string impl_name{impl->name()};
+      size_t previous = 0;
+      for (const size_t target : sizes) {
+        const size_t size = fit_size(func.kind, input, target);
+        if (size == 0 || size == previous) {
+          continue;
+        }
+        previous = size;
+        const sweep_point point = measure(func, *impl, input.data(), size,
+                                          output.data(), min_time_ns);
+        // without performance counters, the counts are left empty in CSV
+        // and null in JSON
+        char cycles_per_byte[32] = "";
+        char instructions_per_byte[32] = "";
+        if (point.has_events) {
+          snprintf(cycles_per_byte, sizeof(cycles_per_byte), "%.3f",
+                   point.cycles / double(size));
+          snprintf(instructions_per_byte, sizeof(instructions_per_byte),
+                   "%.3f", point.instructions / double(size));
+        }
+        if (json) {
+          printf("{\"function\": \"%s\", \"implementation\": \"%s\", "
+                 "\"size\": %zu, \"ns\": %.1f, \"gb_per_s\": %.3f, "
+                 "\"error\": %.3f, \"cycles_per_byte\": %s, "
+                 "\"instructions_per_byte\": %s}\n",
+                 func.name, impl_name.c_str(), size, point.ns,
+                 double(size) / point.ns, point.error,
+                 point.has_events ? cycles_per_byte : "null",
+                 point.has_events ? instructions_per_byte : "null");
+        } else {
+          printf("%s,%s,%zu,%.1f,%.3f,%.3f,%s,%s\n", func.name,
+                 impl_name.c_str(), size, point.ns, double(size) / point.ns,
+                 point.error, cycles_per_byte, instructions_per_byte);
+        }
+        fflush(stdout);
+      }
+    }
+  }
+  return EXIT_SUCCESS;
+}
@@ -2,10 +2,12 @@
 #include "simdutf.h"
 
 #include <cassert>
+#include <algorithm>
 #include <array>
 #include <cstdlib>
 #include <iostream>
 #include <chrono>
+#include <numeric>
 #include <thread>
 #include <string>
 #include <vector>
@@ -170,6 +172,15 @@ Benchmark::Benchmark(std::vector<input::Testcase> &&testcases)
   register_function("convert_latin1_to_utf8",
                     &Benchmark::run_convert_latin1_to_utf8,
                     simdutf::encoding_type::Latin1);
+  register_function("convert_latin1_to_utf8_nt",
+                    &Benchmark::run_convert_latin1_to_utf8_nt,
+                    simdutf::encoding_type::Latin1);
+  register_function("convert_latin1_to_utf8_cache_victim",
+                    &Benchmark::run_convert_latin1_to_utf8_cache_victim,
+                    simdutf::encoding_type::Latin1);
+  register_function("convert_latin1_to_utf8_nt_cache_victim",
+                    &Benchmark::run_convert_latin1_to_utf8_nt_cache_victim,
+                    simdutf::encoding_type::Latin1);
   register_function("convert_latin1_to_utf16le",
                     &Benchmark::run_convert_latin1_to_utf16le,
                     simdutf::encoding_type::Latin1);
@@ -193,6 +204,15 @@ Benchmark::Benchmark(std::vector<input::Testcase> &&testcases)
   register_function("convert_utf8_to_utf16le_with_errors",
                     &Benchmark::run_convert_utf8_to_utf16le_with_errors,
                     simdutf::encoding_type::UTF8);
+  register_function("convert_utf8_to_utf16le_nt",
+                    &Benchmark::run_convert_utf8_to_utf16le_nt,
+                    simdutf::encoding_type::UTF8);
+  register_function("convert_utf8_to_utf16le_cache_victim",
+                    &Benchmark::run_convert_utf8_to_utf16le_cache_victim,
+                    simdutf::encoding_type::UTF8);
+  register_function("convert_utf8_to_utf16le_nt_cache_victim",
+                    &Benchmark::run_convert_utf8_to_utf16le_nt_cache_victim,
+                    simdutf::encoding_type::UTF8);
   register_function(
       "convert_utf8_to_utf16le_with_dynamic_allocation",
       &Benchmark::run_convert_utf8_to_utf16le_with_dynamic_allocation,
@@ -337,6 +357,18 @@ Benchmark::Benchmark(std::vector<input::Testcase> &&testcases)
   register_function("convert_utf32_to_latin1+icu",
                     &Benchmark::run_convert_utf32_to_latin1_icu,
                     simdutf::encoding_type::UTF32_LE);
+  register_function("convert_utf8_to_utf32+icu",
+                    &Benchmark::run_convert_utf8_to_utf32_icu,
+                    simdutf::encoding_type::UTF8);
+  register_function("convert_utf32_to_utf8+icu",
+                    &Benchmark::run_convert_utf32_to_utf8_icu,
+                    simdutf::encoding_type::UTF32_LE);
+  register_function("convert_utf16_to_utf32+icu",
+                    &Benchmark::run_convert_utf16_to_utf32_icu,
+                    simdutf::encoding_type::UTF16_LE);
+  register_function("convert_utf32_to_utf16+icu",
+                    &Benchmark::run_convert_utf32_to_utf16_icu,
+                    simdutf::encoding_type::UTF32_LE);
 #endif
 #ifdef ICONV_AVAILABLE
   register_function("convert_latin1_to_utf8+iconv",
@@ -363,6 +395,18 @@ Benchmark::Benchmark(std::vector<input::Testcase> &&testcases)
   register_function("convert_utf32_to_latin1+iconv",
                     &Benchmark::run_convert_utf32_to_latin1_iconv,
                     simdutf::encoding_type::UTF32_LE);
+  register_function("convert_utf8_to_utf32+iconv",
+                    &Benchmark::run_convert_utf8_to_utf32_iconv,
+                    simdutf::encoding_type::UTF8);
+  register_function("convert_utf32_to_utf8+iconv",
+                    &Benchmark::run_convert_utf32_to_utf8_iconv,
+                    simdutf::encoding_type::UTF32_LE);
+  register_function("convert_utf16_to_utf32+iconv",
+                    &Benchmark::run_convert_utf16_to_utf32_iconv,
+                    simdutf::encoding_type::UTF16_LE);
+  register_function("convert_utf32_to_utf16+iconv",
+                    &Benchmark::run_convert_utf32_to_utf16_iconv,
+                    simdutf::encoding_type::UTF32_LE);
 #endif
 #ifdef INOUE2008
   register_function("convert_valid_utf8_to_utf16+inoue2008",
@@ -374,13 +418,13 @@ Benchmark::Benchmark(std::vector<input::Testcase> &&testcases)
                     &Benchmark::run_convert_utf8_to_utf16_u8u16,
                     simdutf::encoding_type::UTF8);
   register_function("convert_utf16_to_utf8+utf8lut",
-                    &Benchmark::run_convert_valid_utf8_to_utf16_utf8lut,
+                    &Benchmark::run_convert_utf16_to_utf8_utf8lut,
                     simdutf::encoding_type::UTF16_LE);
   register_function("convert_valid_utf16_to_utf8+utf8lut",
                     &Benchmark::run_convert_valid_utf16_to_utf8_utf8lut,
                     simdutf::encoding_type::UTF16_LE);
   register_function("convert_utf8_to_utf16+utf8lut",
-                    &Benchmark::run_convert_valid_utf8_to_utf16_utf8lut,
+                    &Benchmark::run_convert_utf8_to_utf16_utf8lut,
                     simdutf::encoding_type::UTF8);
   register_function("convert_utf8_to_utf32+utf8lut",
                     &Benchmark::run_convert_utf8_to_utf32_utf8lut,
@@ -389,13 +433,13 @@ Benchmark::Benchmark(std::vector<input::Testcase> &&testcases)
                     &Benchmark::run_convert_valid_utf8_to_utf16_utf8lut,
                     simdutf::encoding_type::UTF8);
   register_function("convert_utf32_to_utf8+utf8lut",
-                    &Benchmark::run_convert_valid_utf32_to_utf8_utf8lut,
+                    &Benchmark::run_convert_utf32_to_utf8_utf8lut,
                     simdutf::encoding_type::UTF32_LE);
   register_function("convert_valid_utf32_to_utf8+utf8lut",
                     &Benchmark::run_convert_valid_utf32_to_utf8_utf8lut,
-                    simdutf::encoding_type::UTF32_BE);
+                    simdutf::encoding_type::UTF32_LE);
   register_function("convert_valid_utf8_to_utf32+utf8lut",
-                    &Benchmark::run_convert_utf8_to_utf32_utf8lut,
+                    &Benchmark::run_convert_valid_utf8_to_utf32_utf8lut,
                     simdutf::encoding_type::UTF8);
   register_function("convert_utf8_to_utf16+utf8sse4",
                     &Benchmark::run_convert_utf8_to_utf16_utf8sse4,
@@ -413,6 +457,9 @@ Benchmark::Benchmark(std::vector<input::Testcase> &&testcases)
   register_function("convert_utf8_to_utf32+hoehrmann",
                     &Benchmark::run_convert_utf8_to_utf32_hoehrmann,
                     simdutf::encoding_type::UTF8);
+  register_function("validate_utf8+hoehrmann",
+                    &Benchmark::run_validate_utf8_hoehrmann,
+                    simdutf::encoding_type::UTF8);
 
   register_function("convert_utf8_to_utf16+llvm",
                     &Benchmark::run_convert_utf8_to_utf16_llvm,
@@ -432,6 +479,8 @@ Benchmark::Benchmark(std::vector<input::Testcase> &&testcases)
   register_function("convert_utf16_to_utf32+llvm",
                     &Benchmark::run_convert_utf16_to_utf32_llvm,
                     simdutf::encoding_type::UTF16_LE);
+  register_function("validate_utf8+llvm", &Benchmark::run_validate_utf8_llvm,
+                    simdutf::encoding_type::UTF8);
 
   register_function("convert_utf8_to_utf16+utfcpp",
                     &Benchmark::run_convert_utf8_to_utf16_utfcpp,
@@ -445,6 +494,9 @@ Benchmark::Benchmark(std::vector<input::Testcase> &&testcases)
   register_function("convert_utf32_to_utf8+utfcpp",
                     &Benchmark::run_convert_utf32_to_utf8_utfcpp,
                     simdutf::encoding_type::UTF32_LE);
+  register_function("validate_utf8+utfcpp",
+                    &Benchmark::run_validate_utf8_utfcpp,
+                    simdutf::encoding_type::UTF8);
 
   register_function("utf8_length_from_latin1+node",
                     &Benchmark::run_utf8_length_from_latin1_node,
@@ -469,9 +521,19 @@ Benchmark Benchmark::create(const CommandLine &cmdline) {
       testcases.emplace_back(
           Testcase{cmdline.procedures, iterations, random_utf8{size}});
     }
+
+    for (const std::string &description : cmdline.corpora) {
+      testcases.emplace_back(Testcase{cmdline.procedures, iterations,
+                                      corpus_spec::parse(description)});
+    }
   }
 
-  return Benchmark{std::move(testcases)};
+  Benchmark benchmark{std::move(testcases)};
+  benchmark.latency.enabled = cmdline.latency;
+  benchmark.latency.flush_caches = cmdline.flush_caches;
+  benchmark.frequency.enabled = cmdline.frequency;
+  benchmark.frequency.victim_rounds = cmdline.victim_rounds;
+  return benchmark;
 }
 
 void Benchmark::list_procedures(ListingMode lm) const {
@@ -852,6 +914,103 @@ void Benchmark::run_convert_latin1_to_utf8(
   print_summary(result, size, char_count);
 }
 
+// The _nt functions run on the active implementation: the guard makes it
+// the benchmarked one.
+void Benchmark::run_convert_latin1_to_utf8_nt(
+    const simdutf::implementation &implementation, size_t iterations) {
+  simdutf::scoped_implementation guard(&implementation);
+  const char *data = reinterpret_cast<const char *>(input_data.data());
+  const size_t size = input_data.size();
+  std::unique_ptr<char[]> output_buffer{new char[size * 2]};
+  volatile size_t sink{0};
+  auto proc = [data, size, &output_buffer, &sink]() {
+    sink = simdutf::convert_latin1_to_utf8_nt(data, size, output_buffer.get());
+  };
+  count_events(proc, iterations); // warming up!
+  const auto result = count_events(proc, iterations);
+  if ((sink == 0) && (size != 0) && (iterations > 0)) {
+    std::cerr << "The output is zero which might indicate an error.\n";
+  }
+  size_t char_count = size;
+  print_summary(result, size, char_count);
+}
+
+void Benchmark::run_convert_latin1_to_utf8_cache_victim(
+    const simdutf::implementation &implementation, size_t iterations) {
+  const char *data = reinterpret_cast<const char *>(input_data.data());
+  const size_t size = input_data.size();
+  std::unique_ptr<char[]> output_buffer{new char[size * 2]};
+  run_with_cache_victim(
+      [&implementation, data, size, &output_buffer]() {
+        return implementation.convert_latin1_to_utf8(data, size,
+                                                     output_buffer.get());
+      },
+      iterations);
+}
+
+void Benchmark::run_convert_latin1_to_utf8_nt_cache_victim(
+    const simdutf::implementation &implementation, size_t iterations) {
+  simdutf::scoped_implementation guard(&implementation);
+  const char *data = reinterpret_cast<const char *>(input_data.data());
+  const size_t size = input_data.size();
+  std::unique_ptr<char[]> output_buffer{new char[size * 2]};
+  run_with_cache_victim(
+      [data, size, &output_buffer]() {
+        return simdutf::convert_latin1_to_utf8_nt(data, size,
+                                                  output_buffer.get());
+      },
+      iterations);
+}
+
+// Walks a working set of randomly linked cache lines after each conversion:
+// the time per line grows with the part of the working set that the output
+// of the conversion evicted from the last-level cache. This stands for a
+// competing workload sharing the cache. The conversion and the walk are
+// timed apart: the throughput is that of the conversion, and the walk is
+// reported alone and right after a conversion (see count_with_victim).
+template <typename Convert>
+void Benchmark::run_with_cache_victim(Convert convert, size_t iterations) {
+  // The working set should fit in the last-level cache.
+  constexpr size_t victim_size = 4 * 1024 * 1024;
+  struct alignas(64) cache_line {
+    size_t next;
+  };
+  const size_t line_count = victim_size / sizeof(cache_line);
+  std::vector<cache_line> lines(line_count);
+  std::vector<size_t> order(line_count);
+  std::iota(order.begin(), order.end(), 0);
+  std::shuffle(order.begin(), order.end(), std::mt19937(seed));
+  for (size_t i = 0; i < line_count; i++) {
+    lines[order[i]].next = order[(i + 1) % line_count];
+  }
+  volatile size_t sink{0};
+  auto proc = [&convert, &sink]() { sink = convert(); };
+  auto walk = [&lines, line_count, &sink]() {
+    const auto start = std::chrono::steady_clock::now();
+    size_t index = 0;
+    for (size_t i = 0; i < line_count; i++) {
+      index = lines[index].next;
+    }
+    const auto end = std::chrono::steady_clock::now();
+    sink = sink + index;
+    return std::chrono::duration<double, std::nano>(end - start).count();
+  };
+  const size_t size = input_data.size();
+  if (latency.enabled) {
+    // the latencies are those of the conversion alone
+    print_summary(count_events(proc, iterations), size, size);
+    return;
+  }
+  count_with_victim(proc, walk, iterations); // warming up!
+  const auto result = count_with_victim(proc, walk, iterations);
+  print_summary(result, size, size);
+  const benchmark_result &measured = results.back();
+  printf("cache victim: %8.3f ns per cache line alone, %8.3f ns after a call "
+         "(%zu KiB working set)\n",
+         measured.victim_alone_ns / double(line_count),
+         measured.victim_after_ns / double(line_count), victim_size / 1024);
+}
+
 void Benchmark::run_convert_latin1_to_utf16le(
     const simdutf::implementation &implementation, size_t iterations) {
   const char *data = reinterpret_cast<const char *>(input_data.data());
@@ -1137,6 +1296,52 @@ void Benchmark::run_convert_utf8_to_utf16le(
   print_summary(result, size, char_count);
 }
 
+void Benchmark::run_convert_utf8_to_utf16le_nt(
+    const simdutf::implementation &implementation, size_t iterations) {
+  simdutf::scoped_implementation guard(&implementation);
+  const char *data = reinterpret_cast<const char *>(input_data.data());
+  const size_t size = input_data.size();
+  std::unique_ptr<char16_t[]> output_buffer{new char16_t[size]};
+  volatile size_t sink{0};
+  auto proc = [data, size, &output_buffer, &sink]() {
+    sink = simdutf::convert_utf8_to_utf16le_nt(data, size, output_buffer.get());
+  };
+  count_events(proc, iterations); // warming up!
+  const auto result = count_events(proc, iterations);
+  if ((sink == 0) && (size != 0) && (iterations > 0)) {
+    std::cerr << "The output is zero which might indicate an error.\n";
+  }
+  size_t char_count = get_active_implementation()->count_utf8(data, size);
+  print_summary(result, size, char_count);
+}
+
+void Benchmark::run_convert_utf8_to_utf16le_cache_victim(
+    const simdutf::implementation &implementation, size_t iterations) {
+  const char *data = reinterpret_cast<const char *>(input_data.data());
+  const size_t size = input_data.size();
+  std::unique_ptr<char16_t[]> output_buffer{new char16_t[size]};
+  run_with_cache_victim(
+      [&implementation, data, size, &output_buffer]() {
+        return implementation.convert_utf8_to_utf16le(data, size,
+                                                      output_buffer.get());
+      },
+      iterations);
+}
+
+void Benchmark::run_convert_utf8_to_utf16le_nt_cache_victim(
+    const simdutf::implementation &implementation, size_t iterations) {
+  simdutf::scoped_implementation guard(&implementation);
+  const char *data = reinterpret_cast<const char *>(input_data.data());
+  const size_t size = input_data.size();
+  std::unique_ptr<char16_t[]> output_buffer{new char16_t[size]};
+  run_with_cache_victim(
+      [data, size, &output_buffer]() {
+        return simdutf::convert_utf8_to_utf16le_nt(data, size,
+                                                   output_buffer.get());
+      },
+      iterations);
+}
+
 void Benchmark::run_convert_utf8_to_utf16le_with_errors(
     const simdutf::implementation &implementation, size_t iterations) {
   const char *data = reinterpret_cast<const char *>(input_data.data());
@@ -1732,6 +1937,80 @@ void Benchmark::run_convert_utf32_to_latin1_icu(size_t iterations) {
   print_summary(result, input_data.size(), char_count);
 }
 
+void Benchmark::run_icu_conversion(const char *to, const char *from,
+                                   const char *data, size_t size,
+                                   size_t output_bytes, size_t char_count,
+                                   size_t iterations) {
+  UErrorCode status = U_ZERO_ERROR;
+  UConverter *target_converter = ucnv_open(to, &status);
+  UConverter *source_converter = ucnv_open(from, &status);
+  if (U_FAILURE(status)) {
+    fprintf(stderr, "[icu] cannot initialize the %s to %s converter\n", from,
+            to);
+    ucnv_close(target_converter);
+    ucnv_close(source_converter);
+    return;
+  }
+  std::unique_ptr<char[]> output_buffer{new char[output_bytes + 1]};
+  volatile size_t sink{0};
+
+  auto proc = [target_converter, source_converter, data, size, output_bytes,
+               &output_buffer, &sink]() {
+    UErrorCode error = U_ZERO_ERROR;
+    char *target = output_buffer.get();
+    const char *source = data;
+    ucnv_convertEx(target_converter, source_converter, &target,
+                   output_buffer.get() + output_bytes, &source, data + size,
+                   nullptr, nullptr, nullptr, nullptr, true, true, &error);
+    sink = U_SUCCESS(error) ? size_t(target - output_buffer.get()) : 0;
+  };
+  count_events(proc, iterations); // warming up!
+  const auto result = count_events(proc, iterations);
+  ucnv_close(target_converter);
+  ucnv_close(source_converter);
+  if ((sink == 0) && (size != 0) && (iterations > 0)) {
+    std::cerr << "The output is zero which might indicate an error.\n";
+  }
+  print_summary(result, size, char_count);
+}
+
+void Benchmark::run_convert_utf8_to_utf32_icu(size_t iterations) {
+  const char *data = reinterpret_cast<const char *>(input_data.data());
+  const size_t size = input_data.size();
+  run_icu_conversion("UTF-32LE", "UTF-8", data, size, 4 * size,
+                     get_active_implementation()->count_utf8(data, size),
+                     iterations);
+}
+
+void Benchmark::run_convert_utf32_to_utf8_icu(size_t iterations) {
+  const size_t bom = BOM::bom_byte_size(
+      BOM::check_bom(input_data.data(), input_data.size()));
+  const char *data = reinterpret_cast<const char *>(input_data.data() + bom);
+  const size_t size = (input_data.size() - bom) & ~size_t(3);
+  run_icu_conversion("UTF-8", "UTF-32LE", data, size, size, size / 4,
+                     iterations);
+}
+
+void Benchmark::run_convert_utf16_to_utf32_icu(size_t iterations) {
+  const size_t bom = BOM::bom_byte_size(
+      BOM::check_bom(input_data.data(), input_data.size()));
+  const char *data = reinterpret_cast<const char *>(input_data.data() + bom);
+  const size_t size = (input_data.size() - bom) & ~size_t(1);
+  run_icu_conversion("UTF-32LE", "UTF-16LE", data, size, 2 * size,
+                     get_active_implementation()->count_utf16le(
+                         reinterpret_cast<const char16_t *>(data), size / 2),
+                     iterations);
+}
+
+void Benchmark::run_convert_utf32_to_utf16_icu(size_t iterations) {
+  const size_t bom = BOM::bom_byte_size(
+      BOM::check_bom(input_data.data(), input_data.size()));
+  const char *data = reinterpret_cast<const char *>(input_data.data() + bom);
+  const size_t size = (input_data.size() - bom) & ~size_t(3);
+  run_icu_conversion("UTF-16LE", "UTF-32LE", data, size, size, size / 4,
+                     iterations);
+}
+
 #endif
 
 #ifdef ICONV_AVAILABLE
@@ -2084,6 +2363,81 @@ void Benchmark::run_convert_utf32_to_latin1_iconv(size_t iterations) {
   size_t char_count = size;
   print_summary(result, input_data.size(), char_count);
 }
+
+void Benchmark::run_iconv_conversion(const char *to, const char *from,
+                                     const char *data, size_t size,
+                                     size_t output_bytes, size_t char_count,
+                                     size_t iterations) {
+  iconv_t cv = iconv_open(to, from);
+  if (cv == (iconv_t)(-1)) {
+    fprintf(stderr, "[iconv] cannot initialize the %s to %s converter\n",
+            from, to);
+    return;
+  }
+  std::unique_ptr<char[]> output_buffer{new char[output_bytes + 1]};
+  volatile size_t sink{0};
+
+  auto proc = [&cv, data, size, output_bytes, &output_buffer, &sink]() {
+    size_t inbytes = size;
+    size_t outbytes = output_bytes;
+  #ifdef WINICONV_CONST
+    WINICONV_CONST char *inptr = const_cast<WINICONV_CONST char *>(data);
+  #else
+    char *inptr = const_cast<char *>(data);
+  #endif
+    char *outptr = output_buffer.get();
+    size_t result = iconv(cv, &inptr, &inbytes, &outptr, &outbytes);
+    if (result == static_cast<size_t>(-1)) {
+      sink = 0;
+    } else {
+      sink = output_bytes - outbytes;
+    }
+  };
+  count_events(proc, iterations); // warming up!
+  const auto result = count_events(proc, iterations);
+  iconv_close(cv);
+  if ((sink == 0) && (size != 0) && (iterations > 0)) {
+    std::cerr << "The output is zero which might indicate an error.\n";
+  }
+  print_summary(result, size, char_count);
+}
+
+void Benchmark::run_convert_utf8_to_utf32_iconv(size_t iterations) {
+  const char *data = reinterpret_cast<const char *>(input_data.data());
+  const size_t size = input_data.size();
+  run_iconv_conversion("UTF-32LE", "UTF-8", data, size, 4 * size,
+                       get_active_implementation()->count_utf8(data, size),
+                       iterations);
+}
+
+void Benchmark::run_convert_utf32_to_utf8_iconv(size_t iterations) {
+  const size_t bom = BOM::bom_byte_size(
+      BOM::check_bom(input_data.data(), input_data.size()));
+  const char *data = reinterpret_cast<const char *>(input_data.data() + bom);
+  const size_t size = (input_data.size() - bom) & ~size_t(3);
+  run_iconv_conversion("UTF-8", "UTF-32LE", data, size, size, size / 4,
+                       iterations);
+}
+
+void Benchmark::run_convert_utf16_to_utf32_iconv(size_t iterations) {
+  const size_t bom = BOM::bom_byte_size(
+      BOM::check_bom(input_data.data(), input_data.size()));
+  const char *data = reinterpret_cast<const char *>(input_data.data() + bom);
+  const size_t size = (input_data.size() - bom) & ~size_t(1);
+  run_iconv_conversion("UTF-32LE", "UTF-16LE", data, size, 2 * size,
+                       get_active_implementation()->count_utf16le(
+                           reinterpret_cast<const char16_t *>(data), size / 2),
+                       iterations);
+}
+
+void Benchmark::run_convert_utf32_to_utf16_iconv(size_t iterations) {
+  const size_t bom = BOM::bom_byte_size(
+      BOM::check_bom(input_data.data(), input_data.size()));
+  const char *data = reinterpret_cast<const char *>(input_data.data() + bom);
+  const size_t size = (input_data.size() - bom) & ~size_t(3);
+  run_iconv_conversion("UTF-16LE", "UTF-32LE", data, size, size, size / 4,
+                       iterations);
+}
 #endif
 
 #ifdef INOUE2008
@@ -2141,6 +2495,28 @@ void Benchmark::run_convert_utf8_to_utf16_hoehrmann(size_t iterations) {
  * Bjoern Hoehrmann
  * http://bjoern.hoehrmann.de/utf-8/decoder/dfa/
  */
+void Benchmark::run_validate_utf8_hoehrmann(size_t iterations) {
+  uint8_t const *data = input_data.data();
+  const size_t size = input_data.size();
+  volatile bool sink{false};
+  auto proc = [data, size, &sink]() {
+    uint32_t state = hoehrmann::utf8_accept;
+    uint32_t code_point = 0;
+    for (size_t i = 0; i < size && state != hoehrmann::utf8_reject; i++) {
+      hoehrmann::decode(&state, &code_point, data[i]);
+    }
+    sink = (state == hoehrmann::utf8_accept);
+  };
+  count_events(proc, iterations); // warming up!
+  const auto result = count_events(proc, iterations);
+  if ((sink == false) && (iterations > 0)) {
+    std::cerr << "The input was declared invalid.\n";
+  }
+  size_t char_count = get_active_implementation()->count_utf8(
+      reinterpret_cast<const char *>(data), size);
+  print_summary(result, size, char_count);
+}
+
 void Benchmark::run_convert_utf8_to_utf32_hoehrmann(size_t iterations) {
   uint8_t const *data = input_data.data();
   const size_t size = input_data.size();
@@ -3701,6 +4077,23 @@ void Benchmark::run_convert_utf32_to_utf8_llvm(size_t iterations) {
   print_summary(result, input_data.size(), char_count);
 }
 
+void Benchmark::run_validate_utf8_llvm(size_t iterations) {
+  const char *data = reinterpret_cast<const char *>(input_data.data());
+  const size_t size = input_data.size();
+  volatile bool sink{false};
+  auto proc = [data, size, &sink]() {
+    const llvm::UTF8 *source = reinterpret_cast<const llvm::UTF8 *>(data);
+    sink = llvm::isLegalUTF8String(&source, source + size);
+  };
+  count_events(proc, iterations); // warming up!
+  const auto result = count_events(proc, iterations);
+  if ((sink == false) && (iterations > 0)) {
+    std::cerr << "The input was declared invalid.\n";
+  }
+  size_t char_count = get_active_implementation()->count_utf8(data, size);
+  print_summary(result, size, char_count);
+}
+
 void Benchmark::run_convert_utf16_to_utf32_llvm(size_t iterations) {
   const simdutf::encoding_type bom =
       BOM::check_bom(input_data.data(), input_data.size());
@@ -3767,7 +4160,7 @@ void Benchmark::run_convert_utf32_to_utf16_llvm(size_t iterations) {
   // Note: a single 32-bit word can produce a surrogate pair, i.e. two
   //       16-bit code units. We are making a safe assumption that each 32-
   //       bit word will yield two 16-bit code units.
-  std::unique_ptr<char[]> output_buffer{new char[size * 2]};
+  std::unique_ptr<char16_t[]> output_buffer{new char16_t[size * 2]};
 
   volatile size_t sink{0};
 
@@ -3898,6 +4291,22 @@ void Benchmark::run_convert_utf8_to_utf32_utfcpp(size_t iterations) {
   print_summary(result, size, char_count);
 }
 
+void Benchmark::run_validate_utf8_utfcpp(size_t iterations) {
+  const char *data = reinterpret_cast<const char *>(input_data.data());
+  const size_t size = input_data.size();
+  volatile bool sink{false};
+  auto proc = [data, size, &sink]() {
+    sink = utf8::is_valid(data, data + size);
+  };
+  count_events(proc, iterations); // warming up!
+  const auto result = count_events(proc, iterations);
+  if ((sink == false) && (iterations > 0)) {
+    std::cerr << "The input was declared invalid.\n";
+  }
+  size_t char_count = get_active_implementation()->count_utf8(data, size);
+  print_summary(result, size, char_count);
+}
+
 void Benchmark::run_convert_utf32_to_utf8_utfcpp(size_t iterations) {
   const simdutf::encoding_type bom =
       BOM::check_bom(input_data.data(), input_data.size());
@@ -3916,7 +4325,7 @@ void Benchmark::run_convert_utf32_to_utf8_utfcpp(size_t iterations) {
   auto proc = [data, size, &sink]() {
     try {
       std::string str;
-      utf8::utf16to8(data, data + size, std::back_inserter(str));
+      utf8::utf32to8(data, data + size / 4, std::back_inserter(str));
       sink = str.size();
     } catch (const char *msg) {
       std::cout << msg << std::endl;
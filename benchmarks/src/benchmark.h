@@ -137,6 +137,13 @@ private:
   void run_convert_latin1_to_utf8(const simdutf::implementation &implementation,
                                   size_t iterations);
   void
+  run_convert_latin1_to_utf8_nt(const simdutf::implementation &implementation,
+                                size_t iterations);
+  void run_convert_latin1_to_utf8_cache_victim(
+      const simdutf::implementation &implementation, size_t iterations);
+  void run_convert_latin1_to_utf8_nt_cache_victim(
+      const simdutf::implementation &implementation, size_t iterations);
+  void
   run_convert_latin1_to_utf16le(const simdutf::implementation &implementation,
                                 size_t iterations);
   void
@@ -151,6 +158,13 @@ private:
                               size_t iterations);
   void run_convert_utf8_to_utf16le_with_errors(
       const simdutf::implementation &implementation, size_t iterations);
+  void
+  run_convert_utf8_to_utf16le_nt(const simdutf::implementation &implementation,
+                                 size_t iterations);
+  void run_convert_utf8_to_utf16le_cache_victim(
+      const simdutf::implementation &implementation, size_t iterations);
+  void run_convert_utf8_to_utf16le_nt_cache_victim(
+      const simdutf::implementation &implementation, size_t iterations);
   void run_convert_utf8_to_utf32(const simdutf::implementation &implementation,
                                  size_t iterations);
   void run_convert_utf8_to_utf32_with_errors(
@@ -209,6 +223,9 @@ private:
   run_convert_valid_utf32_to_utf8(const simdutf::implementation &implementation,
                                   size_t iterations);
 
+  template <typename Convert>
+  void run_with_cache_victim(Convert convert, size_t iterations);
+
   template <endianness byte_order>
   void run_convert_utf32_to_utf16(const simdutf::implementation &implementation,
                                   size_t iterations);
@@ -234,6 +251,17 @@ private:
   void run_convert_utf16_to_utf8_icu(size_t iterations);
   void run_convert_utf16_to_latin1_icu(size_t iterations);
   void run_convert_utf32_to_latin1_icu(size_t iterations);
+  void run_convert_utf8_to_utf32_icu(size_t iterations);
+  void run_convert_utf32_to_utf8_icu(size_t iterations);
+  void run_convert_utf16_to_utf32_icu(size_t iterations);
+  void run_convert_utf32_to_utf16_icu(size_t iterations);
+  /**
+   * Converts the input between two ICU converters, opened once, with
+   * ucnv_convertEx.
+   */
+  void run_icu_conversion(const char *to, const char *from, const char *data,
+                          size_t size, size_t output_bytes, size_t char_count,
+                          size_t iterations);
 #endif
 #if ICONV_AVAILABLE
   void run_convert_latin1_to_utf8_iconv(size_t iterations);
@@ -244,6 +272,16 @@ private:
   void run_convert_utf16_to_utf8_iconv(size_t iterations);
   void run_convert_utf16_to_latin1_iconv(size_t iterations);
   void run_convert_utf32_to_latin1_iconv(size_t iterations);
+  void run_convert_utf8_to_utf32_iconv(size_t iterations);
+  void run_convert_utf32_to_utf8_iconv(size_t iterations);
+  void run_convert_utf16_to_utf32_iconv(size_t iterations);
+  void run_convert_utf32_to_utf16_iconv(size_t iterations);
+  /**
+   * Converts the input with an iconv descriptor, opened once.
+   */
+  void run_iconv_conversion(const char *to, const char *from,
+                            const char *data, size_t size, size_t output_bytes,
+                            size_t char_count, size_t iterations);
 #endif
 #ifdef INOUE2008
   /**
@@ -296,6 +334,7 @@ private:
 #endif
   void run_convert_utf8_to_utf16_hoehrmann(size_t iterations);
   void run_convert_utf8_to_utf32_hoehrmann(size_t iterations);
+  void run_validate_utf8_hoehrmann(size_t iterations);
   /**
    * LLVM relies on code from the Unicode Consortium
    * https://en.wikipedia.org/wiki/Unicode_Consortium
@@ -306,6 +345,7 @@ private:
   void run_convert_utf32_to_utf8_llvm(size_t iterations);
   void run_convert_utf32_to_utf16_llvm(size_t iterations);
   void run_convert_utf16_to_utf32_llvm(size_t iterations);
+  void run_validate_utf8_llvm(size_t iterations);
   /**
    * Nemanja Trifunovic, UTF8-CPP: UTF-8 with C++ in a Portable Way
    * https://github.com/nemtrif/utfcpp/releases/tag/v3.2.2
@@ -314,6 +354,7 @@ private:
   void run_convert_utf16_to_utf8_utfcpp(size_t iterations);
   void run_convert_utf8_to_utf32_utfcpp(size_t iterations);
   void run_convert_utf32_to_utf8_utfcpp(size_t iterations);
+  void run_validate_utf8_utfcpp(size_t iterations);
 };
 
 } // namespace simdutf::benchmarks
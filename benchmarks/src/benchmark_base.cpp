@@ -1,11 +1,60 @@
 #include "benchmark_base.h"
 #include "tests/helpers/random_utf8.h"
 #include "simdutf.h"
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cmath>
 #include <fstream>
 #include <iostream>
 
 namespace simdutf::benchmarks {
 
+namespace {
+// reorders the values
+double median(std::vector<double> &values) {
+  std::sort(values.begin(), values.end());
+  const size_t middle = values.size() / 2;
+  return values.size() % 2 == 1 ? values[middle]
+                                : (values[middle - 1] + values[middle]) / 2;
+}
+
+std::string json_string(const std::string &value) {
+  std::string result = "\"";
+  for (const char c : value) {
+    if (c == '"' || c == '\\') {
+      result += '\\';
+      result += c;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      char escaped[8];
+      snprintf(escaped, sizeof(escaped), "\\u%04x", unsigned(c));
+      result += escaped;
+    } else {
+      result += c;
+    }
+  }
+  return result + "\"";
+}
+
+// A chain of dependent multiplications and shifts, which no compiler turns
+// into vector code.
+uint64_t victim_work(uint64_t x, size_t rounds) {
+  for (size_t i = 0; i < rounds; i++) {
+    x = (x ^ (x >> 29)) * 0xbf58476d1ce4e5b9;
+  }
+  return x;
+}
+
+// JSON has no infinity nor NaN
+void print_json_number(FILE *file, double value, bool available = true) {
+  if (available && std::isfinite(value)) {
+    fprintf(file, "%.6g", value);
+  } else {
+    fputs("null", file);
+  }
+}
+} // namespace
+
 BenchmarkBase::BenchmarkBase(std::vector<input::Testcase> &&testcases)
     : testcases{std::move(testcases)} {}
 
@@ -22,6 +71,16 @@ void BenchmarkBase::run(const input::Testcase &testcase) {
   prepare_input(testcase);
   auto detected_encoding =
       simdutf::autodetect_encoding(input_data.data(), input_data.size());
+  if (std::holds_alternative<corpus_spec>(testcase.input)) {
+    // the generated text is UTF-8, even with its invalid sequences
+    detected_encoding = simdutf::encoding_type::UTF8;
+    printf("corpus: %s, invalid sequences at:",
+           std::get<corpus_spec>(testcase.input).to_string().c_str());
+    for (const size_t position : corpus_errors) {
+      printf(" %zu", position);
+    }
+    printf("%s\n", corpus_errors.empty() ? " none" : "");
+  }
   printf("input detected as %.*s\n",
          int(simdutf::to_string(detected_encoding).size()),
          simdutf::to_string(detected_encoding).data());
@@ -60,6 +119,19 @@ void BenchmarkBase::run(const std::string &procedure_name,
   printf("%s, input size: %zu, iterations: %zu", procedure_name.c_str(),
          size_t(input_data.size()), size_t(testcase.iterations));
 
+  current_procedure = procedure_name;
+  current_iterations = testcase.iterations;
+  if (std::holds_alternative<input::File>(testcase.input)) {
+    current_input = std::get<input::File>(testcase.input).path.string();
+  } else if (std::holds_alternative<corpus_spec>(testcase.input)) {
+    current_input =
+        "corpus:" + std::get<corpus_spec>(testcase.input).to_string();
+  } else {
+    current_input = "random-utf8:" +
+                    std::to_string(
+                        std::get<input::random_utf8>(testcase.input).size);
+  }
+
   if (std::holds_alternative<input::File>(testcase.input)) {
     const input::File &file{std::get<input::File>(testcase.input)};
     // You'd think that the following would work, but no, not always:
@@ -72,13 +144,181 @@ void BenchmarkBase::run(const std::string &procedure_name,
   } else
     putchar('\n');
 
+  first_call_pending = true;
   run(procedure_name, testcase.iterations);
 }
 
+/**
+ * Writes the results in the following format, which the comparison script
+ * (benchmarks/compare_results.py) reads. The fields are only ever added to,
+ * and schema_version changes when the meaning of a field changes.
+ *
+ * {
+ *   "schema": "simdutf-benchmark",
+ *   "schema_version": 1,
+ *   "simdutf_version": "9.1.0",
+ *   "implementation": "icelake",
+ *   "mode": "throughput", // or "latency", "latency-flushed-caches",
+ *                         // "frequency"
+ *   "results": [
+ *     {
+ *       "procedure": "convert_utf8_to_utf16le+icelake",
+ *       "input": "file.txt", // or "random-utf8:<size>", "corpus:<spec>"
+ *       "input_size": 81685, "iterations": 30000, "samples": 30000,
+ *       "median_ns": 4352.1, "mad_ns": 21.4, "best_ns": 4301,
+ *       "mean_ns": 4388.2, "gb_per_s": 18.77, "gc_per_s": 12.01,
+ *       "instructions_per_byte": 1.31, // null without performance counters
+ *       "cycles_per_byte": 0.22, "ghz": 3.9, // null likewise
+ *       // null outside of the frequency mode, the ratio is also null
+ *       // without the reference cycles counter
+ *       "frequency_ratio": 0.93,
+ *       // one run of the victim, alone and right after a call: null
+ *       // outside of the frequency mode, except for the _cache_victim
+ *       // procedures, whose victim is their working set walk
+ *       "victim_alone_ns": 512.3, "victim_after_ns": 540.1
+ *     }
+ *   ]
+ * }
+ */
+bool BenchmarkBase::write_json(const std::filesystem::path &path) const {
+  FILE *file = fopen(path.string().c_str(), "w");
+  if (file == nullptr) {
+    fprintf(stderr, "Cannot write %s\n", path.string().c_str());
+    return false;
+  }
+  fprintf(file, "{\n");
+  fprintf(file, "  \"schema\": \"simdutf-benchmark\",\n");
+  fprintf(file, "  \"schema_version\": 1,\n");
+  fprintf(file, "  \"simdutf_version\": \"%s\",\n", SIMDUTF_VERSION);
+  const std::string implementation{
+      simdutf::get_active_implementation()->name()};
+  fprintf(file, "  \"implementation\": %s,\n",
+          json_string(implementation).c_str());
+  const char *mode = frequency.enabled      ? "frequency"
+                     : !latency.enabled     ? "throughput"
+                     : latency.flush_caches ? "latency-flushed-caches"
+                                            : "latency";
+  fprintf(file, "  \"mode\": \"%s\",\n", mode);
+  fprintf(file, "  \"results\": [");
+  for (size_t i = 0; i < results.size(); i++) {
+    const benchmark_result &result = results[i];
+    fprintf(file, "%s\n    {\n", i == 0 ? "" : ",");
+    fprintf(file, "      \"procedure\": %s,\n",
+            json_string(result.procedure).c_str());
+    fprintf(file, "      \"input\": %s,\n", json_string(result.input).c_str());
+    fprintf(file, "      \"input_size\": %zu,\n", result.input_size);
+    fprintf(file, "      \"iterations\": %zu,\n", result.iterations);
+    fprintf(file, "      \"samples\": %zu,\n", result.samples);
+    const std::pair<const char *, double> times[] = {
+        {"median_ns", result.median_ns}, {"mad_ns", result.mad_ns},
+        {"best_ns", result.best_ns},     {"mean_ns", result.mean_ns},
+        {"gb_per_s", result.gb_per_s},   {"gc_per_s", result.gc_per_s}};
+    for (const auto &time : times) {
+      fprintf(file, "      \"%s\": ", time.first);
+      print_json_number(file, time.second);
+      fprintf(file, ",\n");
+    }
+    fprintf(file, "      \"instructions_per_byte\": ");
+    print_json_number(file, result.instructions_per_byte, result.has_events);
+    fprintf(file, ",\n      \"cycles_per_byte\": ");
+    print_json_number(file, result.cycles_per_byte, result.has_events);
+    fprintf(file, ",\n      \"ghz\": ");
+    print_json_number(file, result.ghz, result.has_events);
+    fprintf(file, ",\n      \"frequency_ratio\": ");
+    print_json_number(file, result.frequency_ratio,
+                      result.has_frequency && result.has_reference_cycles);
+    fprintf(file, ",\n      \"victim_alone_ns\": ");
+    print_json_number(file, result.victim_alone_ns, result.has_victim);
+    fprintf(file, ",\n      \"victim_after_ns\": ");
+    print_json_number(file, result.victim_after_ns, result.has_victim);
+    fprintf(file, "\n    }");
+  }
+  fprintf(file, "%s]\n}\n", results.empty() ? "" : "\n  ");
+  const bool written = ferror(file) == 0;
+  return (fclose(file) == 0) && written;
+}
+
+/**
+ * Prints the throughput (GB/s at the median) of every library side by side:
+ * for each input, one row per operation and one column per simdutf kernel or
+ * competitor. The operation is the procedure name before the '+', where
+ * utf16le reads utf16 since the competitors take little-endian UTF-16. The
+ * fastest entry of each row is starred.
+ */
+void BenchmarkBase::print_comparison(FILE *file) const {
+  std::set<std::string> libraries;
+  // input -> operation -> library -> GB/s
+  std::map<std::string, std::map<std::string, std::map<std::string, double>>>
+      inputs;
+  size_t label_width = std::string("operation").size();
+  for (const benchmark_result &result : results) {
+    const size_t plus = result.procedure.find('+');
+    if (plus == std::string::npos) {
+      continue;
+    }
+    std::string operation = result.procedure.substr(0, plus);
+    for (size_t pos = operation.find("utf16le"); pos != std::string::npos;
+         pos = operation.find("utf16le", pos)) {
+      operation.erase(pos + 5, 2);
+    }
+    const std::string library = result.procedure.substr(plus + 1);
+    libraries.insert(library);
+    label_width = std::max(label_width, operation.size());
+    inputs[result.input][operation][library] = result.gb_per_s;
+  }
+  for (const auto &input : inputs) {
+    fprintf(file, "\nGB/s at the median, input: %s\n", input.first.c_str());
+    fprintf(file, "%-*s", int(label_width), "operation");
+    for (const std::string &library : libraries) {
+      fprintf(file, " %10s", library.c_str());
+    }
+    fputc('\n', file);
+    for (const auto &row : input.second) {
+      fprintf(file, "%-*s", int(label_width), row.first.c_str());
+      double best = 0;
+      for (const auto &entry : row.second) {
+        best = std::max(best, entry.second);
+      }
+      for (const std::string &library : libraries) {
+        const auto entry = row.second.find(library);
+        if (entry == row.second.end()) {
+          fprintf(file, " %10s", "-");
+        } else {
+          fprintf(file, " %9.2f%c", entry->second,
+                  entry->second == best ? '*' : ' ');
+        }
+      }
+      fputc('\n', file);
+    }
+  }
+}
+
+double BenchmarkBase::time_victim() {
+  const auto start = std::chrono::steady_clock::now();
+  victim_sink = victim_work(victim_sink, frequency.victim_rounds);
+  const auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(end - start).count();
+}
+
+void BenchmarkBase::flush_caches() {
+  // Writing over a buffer larger than the last-level caches evicts the
+  // input and the output of the procedure.
+  constexpr size_t flush_size = 64 * 1024 * 1024;
+  if (cache_flush_buffer.size() != flush_size) {
+    cache_flush_buffer.resize(flush_size);
+  }
+  for (size_t i = 0; i < flush_size; i += 64) {
+    cache_flush_buffer[i]++;
+  }
+}
+
 void BenchmarkBase::prepare_input(const input::Testcase &testcase) {
   if (std::holds_alternative<input::File>(testcase.input)) {
     const input::File &file{std::get<input::File>(testcase.input)};
     load_file(file.path);
+  } else if (std::holds_alternative<corpus_spec>(testcase.input)) {
+    input_data =
+        generate_corpus(std::get<corpus_spec>(testcase.input), &corpus_errors);
   } else {
     uint32_t seed{1234};
     const input::random_utf8 &random{
@@ -101,12 +341,12 @@ void BenchmarkBase::load_file(const std::filesystem::path &path) {
                     std::istreambuf_iterator<char>());
 }
 void BenchmarkBase::print_summary(const event_aggregate &all, size_t data_size,
-                                  size_t character_count) const {
+                                  size_t character_count) {
   print_summary(all, double(data_size), double(character_count));
 }
 
 void BenchmarkBase::print_summary(const event_aggregate &all, double data_size,
-                                  double character_count) const {
+                                  double character_count) {
   const double best_time = all.best.elapsed_ns();
   const double avg_time = all.total.elapsed_ns() / all.iterations;
   const double gbs = data_size / best_time;
@@ -114,6 +354,48 @@ void BenchmarkBase::print_summary(const event_aggregate &all, double data_size,
   const double byte_per_char = data_size / character_count;
   const double error_margin = (avg_time / best_time - 1) * 100;
 
+  benchmark_result result;
+  result.procedure = current_procedure;
+  result.input = current_input;
+  result.input_size = size_t(data_size);
+  result.iterations = current_iterations;
+  result.samples = samples_ns.size();
+  if (!samples_ns.empty()) {
+    std::vector<double> deviations = samples_ns;
+    result.median_ns = median(deviations);
+    for (double &deviation : deviations) {
+      deviation = std::fabs(deviation - result.median_ns);
+    }
+    result.mad_ns = median(deviations);
+  }
+  result.best_ns = best_time;
+  result.mean_ns = avg_time;
+  result.gb_per_s = data_size / result.median_ns;
+  result.gc_per_s = character_count / result.median_ns;
+  result.has_events = all.has_events;
+  if (all.has_events) {
+    result.instructions_per_byte = all.best.instructions() / data_size;
+    result.cycles_per_byte = all.best.cycles() / data_size;
+    result.ghz = all.best.cycles() / best_time;
+  }
+  if (!victim_alone_ns.empty() && !victim_after_ns.empty()) {
+    result.has_victim = true;
+    result.victim_alone_ns = median(victim_alone_ns);
+    result.victim_after_ns = median(victim_after_ns);
+    victim_alone_ns.clear(); // measured per procedure
+    victim_after_ns.clear();
+  }
+  if (frequency.enabled && result.has_victim) {
+    result.has_frequency = true;
+    result.has_reference_cycles =
+        has_reference_cycles && all.total.reference_cycles() > 0;
+    if (result.has_reference_cycles) {
+      result.frequency_ratio =
+          all.total.cycles() / all.total.reference_cycles();
+    }
+  }
+  results.push_back(result);
+
   if (all.has_events) {
     const double _1GHz = 1000000000.0;
     const double freq = (all.best.cycles() / all.best.elapsed_sec()) / _1GHz;
@@ -137,6 +419,30 @@ void BenchmarkBase::print_summary(const event_aggregate &all, double data_size,
     printf("%8.3f GB/s (%.1f %%) %8.3f Gc/s %8.2f byte/char %8.1f ns\n", gbs,
            error_margin, gcs, byte_per_char, best_time);
   }
+  if (latency.enabled) {
+    printf("latency (ns): first %" PRIu64 ", p50 %" PRIu64 ", p90 %" PRIu64
+           ", p99 %" PRIu64 ", p99.9 %" PRIu64 ", max %" PRIu64
+           " over %zu calls%s\n",
+           first_call_ns, latencies.percentile(50), latencies.percentile(90),
+           latencies.percentile(99), latencies.percentile(99.9),
+           latencies.max(), latencies.count(),
+           latency.flush_caches ? " with flushed caches" : "");
+    return;
+  }
+  if (result.has_frequency) {
+    if (result.has_reference_cycles) {
+      printf("frequency during the calls: %.3f GHz, %.3f of nominal\n",
+             all.total.cycles() / all.total.elapsed_ns(),
+             result.frequency_ratio);
+    } else if (all.has_events) {
+      printf("frequency during the calls: %.3f GHz, no reference cycles\n",
+             all.total.cycles() / all.total.elapsed_ns());
+    }
+    printf("victim: %.1f ns alone, %.1f ns after a call (%+.1f %%)\n",
+           result.victim_alone_ns, result.victim_after_ns,
+           (result.victim_after_ns / result.victim_alone_ns - 1) * 100);
+    return;
+  }
   if (error_margin > 10) {
     printf("WARNING: Measurements are noisy, try increasing iteration count "
            "(-I).\n");
@@ -1,12 +1,15 @@
 #pragma once
 
 #include <set>
+#include <string>
 #include <vector>
 #include <map>
 #include <filesystem>
 #include <variant>
 #include <random>
+#include "corpus.h"
 #include "event_counter.h"
+#include "latency_histogram.h"
 #include "simdutf.h"
 namespace simdutf::benchmarks {
 
@@ -26,10 +29,65 @@ struct random_utf8 {
 struct Testcase {
   std::set<std::string> tested_procedures;
   size_t iterations;
-  std::variant<File, random_utf8> input;
+  std::variant<File, random_utf8, corpus_spec> input;
 };
 } // namespace input
 
+/**
+ * The latency mode (see --latency) times the calls one by one, without
+ * batching the short ones, and reports the percentiles of their duration.
+ * With flush_caches, the caches are evicted before every call.
+ */
+struct latency_options {
+  bool enabled = false;
+  bool flush_caches = false;
+};
+
+/**
+ * The frequency mode (see --frequency) follows every call with a scalar
+ * "victim" workload, standing for the application code around the calls,
+ * and compares its duration with its duration alone. The heavy AVX-512 (and,
+ * on older processors, AVX2) instructions lower the frequency of the core
+ * for a while after they retire, which slows down the victim as well. The
+ * mode also reports the effective frequency during the calls, as the ratio
+ * of the cycles to the reference cycles.
+ */
+struct frequency_options {
+  bool enabled = false;
+  // the rounds of the victim, about four cycles each
+  size_t victim_rounds = 2000;
+};
+
+/**
+ * The measures of one procedure on one input, as written by --json-output
+ * (see write_json for the schema). The times are per call, the median and
+ * the median absolute deviation (MAD) are taken over the measured batches
+ * and the counters come from the fastest batch.
+ */
+struct benchmark_result {
+  std::string procedure;
+  std::string input;
+  size_t input_size = 0;
+  size_t iterations = 0;
+  size_t samples = 0;
+  double median_ns = 0;
+  double mad_ns = 0;
+  double best_ns = 0;
+  double mean_ns = 0;
+  double gb_per_s = 0; // at the median
+  double gc_per_s = 0; // at the median
+  bool has_events = false;
+  double instructions_per_byte = 0;
+  double cycles_per_byte = 0;
+  double ghz = 0;
+  bool has_frequency = false; // in the frequency mode only
+  bool has_victim = false; // in the frequency mode and the _cache_victim ones
+  bool has_reference_cycles = false;
+  double frequency_ratio = 0; // cycles / reference cycles, over all calls
+  double victim_alone_ns = 0; // median
+  double victim_after_ns = 0; // median, right after a call
+};
+
 class BenchmarkBase {
 protected:
   std::vector<uint8_t> input_data;
@@ -38,10 +96,36 @@ protected:
   std::vector<input::Testcase> testcases;
 
   uint32_t seed{1234};
+  // the offsets of the invalid sequences of a generated corpus
+  std::vector<size_t> corpus_errors;
+
+  latency_options latency{};
+  // the durations of the calls of the last count_events, in nanoseconds
+  latency_histogram latencies{};
+  // the duration of the first call of the procedure, when it is cold
+  uint64_t first_call_ns{0};
+  bool first_call_pending{false};
+  std::vector<uint8_t> cache_flush_buffer{};
+
+  frequency_options frequency{};
+  // the durations of the victim of the last count_events, in nanoseconds
+  std::vector<double> victim_alone_ns{};
+  std::vector<double> victim_after_ns{};
+  bool has_reference_cycles{false};
+  volatile uint64_t victim_sink{0};
+
+  // the time per call of every batch of the last count_events
+  std::vector<double> samples_ns{};
+  std::string current_procedure{};
+  std::string current_input{};
+  size_t current_iterations{0};
+  std::vector<benchmark_result> results{};
 
 public:
   BenchmarkBase(std::vector<input::Testcase> &&testcases);
   bool run();
+  bool write_json(const std::filesystem::path &path) const;
+  void print_comparison(FILE *file) const;
   virtual const std::set<std::string> all_procedures() const = 0;
   virtual std::set<simdutf::encoding_type>
   expected_encodings(const std::string &procedure) = 0;
@@ -51,10 +135,24 @@ protected:
 
   template <typename PROCEDURE>
   event_aggregate count_events(PROCEDURE, size_t iterations);
+  template <typename PROCEDURE>
+  event_aggregate count_latencies(PROCEDURE, size_t iterations);
+  template <typename PROCEDURE>
+  event_aggregate count_with_victim(PROCEDURE, size_t iterations);
+  // times the procedure and, apart, the victim right after each call: the
+  // victim returns its duration in nanoseconds
+  template <typename PROCEDURE, typename VICTIM>
+  event_aggregate count_with_victim(PROCEDURE, VICTIM, size_t iterations);
+  void flush_caches();
+  // runs the victim and returns its duration in nanoseconds
+  double time_victim();
+  // measures the victim alone, once the frequency has settled
+  template <typename VICTIM>
+  void measure_victim_alone(VICTIM, size_t iterations);
   void print_summary(const event_aggregate &all, double data_size,
-                     double character_count) const;
+                     double character_count);
   void print_summary(const event_aggregate &all, size_t data_size,
-                     size_t character_count) const;
+                     size_t character_count);
 
   void run(const input::Testcase &testcase);
   void run(const std::string &procedure_name, const input::Testcase &testcase);
@@ -65,8 +163,15 @@ protected:
 template <typename PROCEDURE>
 event_aggregate BenchmarkBase::count_events(PROCEDURE procedure,
                                             size_t iterations) {
+  if (latency.enabled) {
+    return count_latencies(procedure, iterations);
+  }
+  if (frequency.enabled) {
+    return count_with_victim(procedure, iterations);
+  }
   event_collector collector;
   event_aggregate all{};
+  samples_ns.clear();
   // Some inputs are just too small to measure accurately, so we need to scale
   // them up.
   size_t multiplier = 1;
@@ -91,8 +196,80 @@ event_aggregate BenchmarkBase::count_events(PROCEDURE procedure,
     }
     event_count allocate_count = collector.end();
     all << allocate_count / multiplier;
+    samples_ns.push_back(allocate_count.elapsed_ns() / double(multiplier));
+  }
+  all.has_events = collector.has_events();
+  return all;
+}
+
+template <typename PROCEDURE>
+event_aggregate BenchmarkBase::count_latencies(PROCEDURE procedure,
+                                               size_t iterations) {
+  event_aggregate all{};
+  latencies.clear();
+  samples_ns.clear();
+  for (size_t i = 0; i < iterations; i++) {
+    if (latency.flush_caches) {
+      flush_caches();
+    }
+    const auto start = std::chrono::steady_clock::now();
+    procedure();
+    const auto end = std::chrono::steady_clock::now();
+    const uint64_t ns = uint64_t(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+            .count());
+    if (first_call_pending) {
+      first_call_ns = ns;
+      first_call_pending = false;
+    }
+    latencies.record(ns);
+    samples_ns.push_back(double(ns));
+    all << event_count(end - start, {0, 0, 0, 0, 0});
+  }
+  return all;
+}
+
+template <typename PROCEDURE>
+event_aggregate BenchmarkBase::count_with_victim(PROCEDURE procedure,
+                                                 size_t iterations) {
+  return count_with_victim(
+      procedure, [this]() { return time_victim(); }, iterations);
+}
+
+template <typename PROCEDURE, typename VICTIM>
+event_aggregate BenchmarkBase::count_with_victim(PROCEDURE procedure,
+                                                 VICTIM victim,
+                                                 size_t iterations) {
+  measure_victim_alone(victim, iterations);
+  event_collector collector{true};
+  event_aggregate all{};
+  samples_ns.clear();
+  victim_after_ns.clear();
+  for (size_t i = 0; i < iterations; i++) {
+    collector.start();
+    procedure();
+    event_count count = collector.end();
+    all << count;
+    samples_ns.push_back(count.elapsed_ns());
+    victim_after_ns.push_back(victim());
   }
   all.has_events = collector.has_events();
+  has_reference_cycles = collector.has_reference_cycles();
   return all;
 }
+
+template <typename VICTIM>
+void BenchmarkBase::measure_victim_alone(VICTIM victim, size_t iterations) {
+  // Spinning on the victim brings the core back to its scalar frequency,
+  // whatever the previous procedure ran.
+  const auto settled =
+      std::chrono::steady_clock::now() + std::chrono::milliseconds(20);
+  while (std::chrono::steady_clock::now() < settled) {
+    victim();
+  }
+  victim_alone_ns.clear();
+  for (size_t i = 0; i < iterations; i++) {
+    victim_alone_ns.push_back(victim());
+  }
+}
 } // namespace simdutf::benchmarks
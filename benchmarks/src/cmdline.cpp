@@ -1,4 +1,5 @@
 #include "cmdline.h"
+#include "corpus.h"
 
 #include <vector>
 #include <stdexcept>
@@ -68,6 +69,34 @@ CommandLine parse_arguments(int argc, char *argv[]) {
 
       cmdline.iterations.insert(iterations);
 
+      i += 2;
+    } else if (arg == "--latency") {
+      seen_arg_escape = false;
+      target = Target::None;
+      cmdline.latency = true;
+      i += 1;
+    } else if (arg == "--flush-caches") {
+      seen_arg_escape = false;
+      target = Target::None;
+      cmdline.latency = true;
+      cmdline.flush_caches = true;
+      i += 1;
+    } else if (arg == "--frequency") {
+      seen_arg_escape = false;
+      target = Target::None;
+      cmdline.frequency = true;
+      i += 1;
+    } else if (arg == "--victim-rounds") {
+      seen_arg_escape = false;
+      target = Target::None;
+      const std::string &value = arguments.at(i + 1);
+      const long rounds = std::stol(value);
+      if (rounds <= 0) {
+        throw std::invalid_argument("Victim rounds must be greater than zero");
+      }
+      cmdline.frequency = true;
+      cmdline.victim_rounds = size_t(rounds);
+
       i += 2;
     } else if (arg == "--random-utf8") {
       seen_arg_escape = false;
@@ -79,6 +108,24 @@ CommandLine parse_arguments(int argc, char *argv[]) {
       }
       cmdline.random_size.insert(size);
 
+      i += 2;
+    } else if (arg == "--json-output") {
+      seen_arg_escape = false;
+      target = Target::None;
+      cmdline.json_output = arguments.at(i + 1);
+
+      i += 2;
+    } else if (arg == "--summary") {
+      seen_arg_escape = false;
+      target = Target::None;
+      cmdline.summary = true;
+
+      i += 1;
+    } else if (arg == "--corpus") {
+      seen_arg_escape = false;
+      target = Target::None;
+      cmdline.corpora.insert(arguments.at(i + 1));
+
       i += 2;
     } else {
       if (arg == "--") {
@@ -115,7 +162,7 @@ void fixup_and_validate(CommandLine &cmdline) {
   if (cmdline.iterations.empty()) {
     const bool default_needed =
         (!cmdline.procedures.empty() || !cmdline.random_size.empty() ||
-         !cmdline.files.empty());
+         !cmdline.corpora.empty() || !cmdline.files.empty());
     if (default_needed)
       cmdline.iterations.insert(DEFAULT_ITERATIONS);
   }
@@ -124,6 +171,15 @@ void fixup_and_validate(CommandLine &cmdline) {
     if (!std::filesystem::exists(path))
       throw std::runtime_error("File " + path.string() + " does not exist");
   }
+
+  for (const auto &description : cmdline.corpora) {
+    simdutf::benchmarks::corpus_spec::parse(description); // may throw
+  }
+
+  if (cmdline.frequency && cmdline.latency) {
+    throw std::invalid_argument(
+        "The frequency and the latency modes cannot be combined");
+  }
 }
 
 } // namespace
@@ -139,8 +195,9 @@ CommandLine CommandLine::parse_arguments(int argc, char *argv[]) {
 }
 
 bool CommandLine::empty() const {
-  return procedures.empty() && random_size.empty() && files.empty() &&
-         iterations.empty() && (show_procedures == ListingMode::None);
+  return procedures.empty() && random_size.empty() && corpora.empty() &&
+         files.empty() && iterations.empty() &&
+         (show_procedures == ListingMode::None);
 }
 
 void CommandLine::print_help() { print_help(stdout); }
@@ -156,6 +213,19 @@ Usage:
     -P [NAME], --procedure [NAME]   choose procedure(s) to test (may be used many times, a substring match suffices)
     -I --iterations                 number of iterations (default: 3000)
     --random-utf8 [size]            use random UTF8 data of given size
+    --corpus [spec]                 use generated multilingual UTF-8 text (may be used many times), spec is
+                                    a list of key=value: size, ascii, latin, cjk, emoji, supplementary
+                                    (shares of the bytes), run (characters per script run, default 8),
+                                    errors (invalid sequences spread evenly), error-at (offset of an
+                                    invalid sequence, may be repeated), error-kind (0 to 5, the kind of
+                                    the first invalid sequence), seed (default 1234)
+    --latency                       time every call and report latency percentiles (p50, p90, p99, p99.9)
+    --flush-caches                  like --latency, evicting the caches before every call
+    --frequency                     follow every call with a scalar workload and report its slowdown and
+                                    the effective frequency during the calls (cycles / reference cycles)
+    --victim-rounds [N]             like --frequency, with N rounds of the scalar workload (default: 2000)
+    --json-output [PATH]            also write the results to a JSON file (see benchmarks/compare_results.py)
+    --summary                       end with a table of the throughput of every library, side by side
     --show-procedures               list all known procedures in a human-readable way
     -l                              list all known procedures in a machine-friendly format
 
@@ -164,9 +234,29 @@ Examples:
     # test all known UTF8 procedures against 10k random input (in 100 iterations)
     $ benchmark --random-utf8 10240 -I 100
 
+    # UTF-8 to UTF-16 on text that is mostly ASCII with some accents and emoji
+    $ benchmark -P convert_utf8_to_utf16le --corpus size=1M,ascii=85,latin=10,emoji=5
+
+    # the same text with an invalid sequence in the middle
+    $ benchmark -P validate_utf8_with_errors --corpus size=1M,ascii=85,latin=10,emoji=5,error-at=512K
+
+    # compare the results of two versions of simdutf
+    $ benchmark -P convert_utf8_to_utf16le+ -F file.txt --json-output before.json
+    $ benchmark -P convert_utf8_to_utf16le+ -F file.txt --json-output after.json
+    $ python3 benchmarks/compare_results.py before.json after.json
+
+    # simdutf against ICU, iconv and the other libraries on the same text
+    $ benchmark -P convert_utf8_to_utf16 --corpus size=1M,ascii=50,cjk=50 --summary
+
     # test procedures implemented with the haswell kernel against two custom files
     $ benchmark -P haswell -F ~/plain_ascii.txt -F ~/chinese_huge.txt
 
+    # latency percentiles of convert_utf8_to_utf16le with cold caches
+    $ benchmark -P convert_utf8_to_utf16le+ -F file.txt -I 1000 --flush-caches
+
+    # does AVX-512 slow down the code around the calls?
+    $ benchmark -P convert_utf8_to_utf16le+icelake -P convert_utf8_to_utf16le+haswell -F file.txt --frequency
+
     # test two selected procedures against all files matching a pattern (POSIX)
     $ benchmark -P convert_utf8_to_utf16+llvm convert_utf8_to_utf16+u8u16 -F *.utf8.txt
 )txt",
@@ -21,8 +21,15 @@ public:
   ListingMode show_procedures = ListingMode::None;
   std::set<std::string> procedures;
   std::set<size_t> random_size;
+  std::set<std::string> corpora;
   std::set<std::filesystem::path> files;
   std::set<size_t> iterations;
+  bool latency = false;
+  bool flush_caches = false;
+  bool frequency = false;
+  size_t victim_rounds = 2000;
+  std::filesystem::path json_output;
+  bool summary = false;
 
 public:
   CommandLine() = default;
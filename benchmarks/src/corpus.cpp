@@ -0,0 +1,247 @@
+#include "corpus.h"
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+
+namespace simdutf::benchmarks {
+
+namespace {
+
+size_t parse_number(const std::string &key, const std::string &value) {
+  size_t end = 0;
+  unsigned long long number;
+  try {
+    number = std::stoull(value, &end);
+  } catch (const std::exception &) {
+    throw std::invalid_argument("Invalid value '" + value + "' for " + key);
+  }
+  const std::string suffix = value.substr(end);
+  if (suffix == "K" || suffix == "k") {
+    number <<= 10;
+  } else if (suffix == "M" || suffix == "m") {
+    number <<= 20;
+  } else if (suffix == "G" || suffix == "g") {
+    number <<= 30;
+  } else if (!suffix.empty()) {
+    throw std::invalid_argument("Invalid value '" + value + "' for " + key);
+  }
+  return size_t(number);
+}
+
+void append_utf8(std::vector<uint8_t> &data, uint32_t code_point) {
+  if (code_point < 0x80) {
+    data.push_back(uint8_t(code_point));
+  } else if (code_point < 0x800) {
+    data.push_back(uint8_t(0xc0 | (code_point >> 6)));
+    data.push_back(uint8_t(0x80 | (code_point & 0x3f)));
+  } else if (code_point < 0x10000) {
+    data.push_back(uint8_t(0xe0 | (code_point >> 12)));
+    data.push_back(uint8_t(0x80 | ((code_point >> 6) & 0x3f)));
+    data.push_back(uint8_t(0x80 | (code_point & 0x3f)));
+  } else {
+    data.push_back(uint8_t(0xf0 | (code_point >> 18)));
+    data.push_back(uint8_t(0x80 | ((code_point >> 12) & 0x3f)));
+    data.push_back(uint8_t(0x80 | ((code_point >> 6) & 0x3f)));
+    data.push_back(uint8_t(0x80 | (code_point & 0x3f)));
+  }
+}
+
+bool is_continuation(uint8_t byte) { return (byte & 0xc0) == 0x80; }
+
+struct script {
+  uint32_t first;
+  uint32_t last;
+  size_t bytes;
+};
+
+// in the order of the weights of corpus_spec
+constexpr script scripts[] = {
+    {0x20, 0x7e, 1},
+    {0xc0, 0x24f, 2},
+    {0x4e00, 0x9fff, 3},
+    {0x1f300, 0x1f64f, 4},
+    {0x20000, 0x2a6df, 4},
+};
+
+// A stray continuation byte, an overlong encoding, an encoded surrogate, a
+// code point above U+10FFFF, a truncated sequence and a byte that never
+// appears in UTF-8.
+const std::vector<uint8_t> invalid_sequences[] = {
+    {0x80}, {0xc0, 0xaf}, {0xed, 0xa0, 0x80}, {0xf4, 0x90, 0x80, 0x80},
+    {0xe4, 0xb8}, {0xff},
+};
+
+} // namespace
+
+corpus_spec corpus_spec::parse(const std::string &description) {
+  corpus_spec spec;
+  size_t start = 0;
+  while (start < description.size()) {
+    size_t end = description.find(',', start);
+    if (end == std::string::npos) {
+      end = description.size();
+    }
+    const std::string pair = description.substr(start, end - start);
+    start = end + 1;
+    const size_t equal = pair.find('=');
+    if (equal == std::string::npos) {
+      throw std::invalid_argument("Expected key=value in the corpus, got '" +
+                                  pair + "'");
+    }
+    const std::string key = pair.substr(0, equal);
+    const size_t value = parse_number(key, pair.substr(equal + 1));
+    if (key == "size") {
+      spec.size = value;
+    } else if (key == "ascii") {
+      spec.ascii = unsigned(value);
+    } else if (key == "latin") {
+      spec.latin = unsigned(value);
+    } else if (key == "cjk") {
+      spec.cjk = unsigned(value);
+    } else if (key == "emoji") {
+      spec.emoji = unsigned(value);
+    } else if (key == "supplementary") {
+      spec.supplementary = unsigned(value);
+    } else if (key == "run") {
+      if (value == 0) {
+        throw std::invalid_argument("The runs must be at least one character");
+      }
+      spec.run = value;
+    } else if (key == "errors") {
+      spec.errors = value;
+    } else if (key == "error-at") {
+      spec.error_positions.push_back(value);
+    } else if (key == "error-kind") {
+      if (value >= std::size(invalid_sequences)) {
+        throw std::invalid_argument("The error kinds go from 0 to " +
+                                    std::to_string(
+                                        std::size(invalid_sequences) - 1));
+      }
+      spec.error_kind = value;
+    } else if (key == "seed") {
+      spec.seed = uint32_t(value);
+    } else {
+      throw std::invalid_argument("Unknown corpus key '" + key + "'");
+    }
+  }
+  if (spec.size == 0) {
+    throw std::invalid_argument("The corpus needs a size greater than zero");
+  }
+  if (spec.ascii + spec.latin + spec.cjk + spec.emoji + spec.supplementary ==
+      0) {
+    spec.ascii = 100;
+  }
+  return spec;
+}
+
+std::string corpus_spec::to_string() const {
+  std::string result = "size=" + std::to_string(size);
+  const std::pair<const char *, unsigned> weights[] = {
+      {"ascii", ascii},
+      {"latin", latin},
+      {"cjk", cjk},
+      {"emoji", emoji},
+      {"supplementary", supplementary}};
+  for (const auto &weight : weights) {
+    if (weight.second != 0) {
+      result += std::string(",") + weight.first + "=" +
+                std::to_string(weight.second);
+    }
+  }
+  result += ",run=" + std::to_string(run);
+  if (errors != 0) {
+    result += ",errors=" + std::to_string(errors);
+  }
+  for (const size_t position : error_positions) {
+    result += ",error-at=" + std::to_string(position);
+  }
+  if (error_kind != 0) {
+    result += ",error-kind=" + std::to_string(error_kind);
+  }
+  result += ",seed=" + std::to_string(seed);
+  return result;
+}
+
+std::vector<uint8_t> generate_corpus(const corpus_spec &spec,
+                                     std::vector<size_t> *errors_at) {
+  const unsigned shares[] = {spec.ascii, spec.latin, spec.cjk, spec.emoji,
+                             spec.supplementary};
+  // Choosing the scripts in proportion to share / bytes gives each script
+  // its share of the bytes.
+  std::vector<double> weights;
+  for (size_t i = 0; i < std::size(scripts); i++) {
+    weights.push_back(double(shares[i]) / double(scripts[i].bytes));
+  }
+  if (std::all_of(weights.begin(), weights.end(),
+                  [](double weight) { return weight == 0; })) {
+    weights[0] = 1;
+  }
+
+  std::mt19937 gen(spec.seed);
+  std::discrete_distribution<size_t> pick_script(weights.begin(),
+                                                 weights.end());
+  std::geometric_distribution<size_t> extra_length(
+      1.0 / double(std::max<size_t>(spec.run, 1)));
+
+  std::vector<uint8_t> data;
+  data.reserve(spec.size + 4);
+  while (data.size() < spec.size) {
+    const script &current = scripts[pick_script(gen)];
+    std::uniform_int_distribution<uint32_t> pick_character(current.first,
+                                                           current.last);
+    const size_t length = 1 + extra_length(gen);
+    for (size_t i = 0; i < length && data.size() < spec.size; i++) {
+      append_utf8(data, pick_character(gen));
+    }
+  }
+  // drop the character that crosses the end, and pad with ASCII
+  if (data.size() > spec.size) {
+    size_t end = spec.size;
+    while (end > 0 && is_continuation(data[end])) {
+      end--;
+    }
+    data.resize(end);
+    data.resize(spec.size, ' ');
+  }
+
+  std::vector<size_t> positions = spec.error_positions;
+  for (size_t i = 0; i < spec.errors; i++) {
+    positions.push_back(spec.size / (spec.errors + 1) * (i + 1));
+  }
+  std::sort(positions.begin(), positions.end());
+  if (errors_at != nullptr) {
+    errors_at->clear();
+  }
+  size_t free_from = 0; // the bytes before were already overwritten
+  size_t kind = spec.error_kind;
+  for (size_t position : positions) {
+    const std::vector<uint8_t> &invalid =
+        invalid_sequences[kind % std::size(invalid_sequences)];
+    position = std::max(position, free_from);
+    while (position < data.size() && is_continuation(data[position])) {
+      position++;
+    }
+    if (position + invalid.size() > data.size()) {
+      break;
+    }
+    // overwrite whole characters so that no other error appears
+    size_t end = position + invalid.size();
+    while (end < data.size() && is_continuation(data[end])) {
+      end++;
+    }
+    std::copy(invalid.begin(), invalid.end(), data.begin() + position);
+    std::fill(data.begin() + position + invalid.size(), data.begin() + end,
+              ' ');
+    if (errors_at != nullptr) {
+      errors_at->push_back(position);
+    }
+    // an intact byte keeps a truncated sequence from being completed
+    free_from = end + 1;
+    kind++;
+  }
+  return data;
+}
+
+} // namespace simdutf::benchmarks
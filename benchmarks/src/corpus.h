@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace simdutf::benchmarks {
+
+/**
+ * The description of a synthetic UTF-8 corpus (see --corpus).
+ *
+ * The text is made of runs of characters from a single script, as in real
+ * documents, and the weights give the share of the bytes written in each
+ * script. Invalid sequences are then written at the requested byte offsets,
+ * each one being the first error of validate_utf8_with_errors once the
+ * previous ones are fixed.
+ *
+ * The same description always produces the same bytes.
+ */
+struct corpus_spec {
+  size_t size = 0;
+  // shares of the bytes (any scale)
+  unsigned ascii = 0;
+  unsigned latin = 0;         // U+00C0 to U+024F, two bytes
+  unsigned cjk = 0;           // U+4E00 to U+9FFF, three bytes
+  unsigned emoji = 0;         // U+1F300 to U+1F64F, four bytes
+  unsigned supplementary = 0; // U+20000 to U+2A6DF, four bytes
+  // average number of characters of a run
+  size_t run = 8;
+  // byte offsets of the invalid sequences, adjusted to character boundaries
+  std::vector<size_t> error_positions;
+  // when not zero, that many invalid sequences spread evenly
+  size_t errors = 0;
+  // the kind of the first invalid sequence (0 to 5), the next ones rotate
+  // through a stray continuation byte, an overlong encoding, an encoded
+  // surrogate, a code point above U+10FFFF, a truncated sequence and 0xFF
+  size_t error_kind = 0;
+  uint32_t seed = 1234;
+
+  /**
+   * Parses a list of key=value pairs separated by commas, e.g.
+   * "size=1M,ascii=80,latin=15,emoji=5,errors=2". The keys are size, ascii,
+   * latin, cjk, emoji, supplementary, run, errors, error-at (a byte offset,
+   * may be repeated), error-kind and seed. Throws std::invalid_argument when
+   * the description is malformed.
+   */
+  static corpus_spec parse(const std::string &description);
+  std::string to_string() const;
+};
+
+/**
+ * Generates the corpus, exactly spec.size bytes long. The offsets of the
+ * invalid sequences that were written are stored in errors_at when it is not
+ * null, in increasing order.
+ */
+std::vector<uint8_t> generate_corpus(const corpus_spec &spec,
+                                     std::vector<size_t> *errors_at = nullptr);
+
+} // namespace simdutf::benchmarks
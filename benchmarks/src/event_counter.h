@@ -36,6 +36,8 @@ struct event_count {
     CPU_CYCLES,
     INSTRUCTIONS,
     BRANCH_MISSES,
+    // cycles at the nominal frequency, whatever the actual frequency
+    REFERENCE_CYCLES,
   };
 
   double elapsed_sec() const {
@@ -53,6 +55,9 @@ struct event_count {
   double branch_misses() const {
     return static_cast<double>(event_counts[BRANCH_MISSES]);
   }
+  double reference_cycles() const {
+    return static_cast<double>(event_counts[REFERENCE_CYCLES]);
+  }
 
   event_count &operator=(const event_count &other) {
     this->elapsed = other.elapsed;
@@ -105,6 +110,9 @@ struct event_aggregate {
   double elapsed_ns() const { return total.elapsed_ns() / iterations; }
   double cycles() const { return total.cycles() / iterations; }
   double instructions() const { return total.instructions() / iterations; }
+  double reference_cycles() const {
+    return total.reference_cycles() / iterations;
+  }
 };
 
 struct event_collector {
@@ -113,24 +121,40 @@ struct event_collector {
 
 #if defined(__linux__)
   LinuxEvents<PERF_TYPE_HARDWARE> linux_events;
-  event_collector()
+  // A separate group, so that the other counters keep working on the
+  // (virtual) machines that do not count the reference cycles.
+  LinuxEvents<PERF_TYPE_HARDWARE> reference_events;
+  event_collector() : event_collector(false) {}
+  // The reference cycles give the effective frequency (cycles /
+  // reference_cycles times the nominal frequency), at the price of two more
+  // system calls per measure.
+  explicit event_collector(bool with_reference_cycles)
       : linux_events(std::vector<int>{
             PERF_COUNT_HW_CPU_CYCLES,
             PERF_COUNT_HW_INSTRUCTIONS,
-        }) {}
+        }),
+        reference_events(with_reference_cycles
+                             ? std::vector<int>{PERF_COUNT_HW_REF_CPU_CYCLES}
+                             : std::vector<int>{}) {}
   bool has_events() { return linux_events.is_working(); }
+  bool has_reference_cycles() { return reference_events.is_working(); }
 #elif __APPLE__ && __aarch64__
   AppleEvents apple_events;
   performance_counters diff;
   event_collector() : diff(0) { apple_events.setup_performance_counters(); }
+  explicit event_collector(bool) : event_collector() {}
   bool has_events() { return apple_events.setup_performance_counters(); }
+  bool has_reference_cycles() { return false; }
 #else
   event_collector() {}
+  explicit event_collector(bool) {}
   bool has_events() { return false; }
+  bool has_reference_cycles() { return false; }
 #endif
 
   inline void start() {
 #if defined(__linux)
+    reference_events.start();
     linux_events.start();
 #elif __APPLE__ && __aarch64__
     if (has_events()) {
@@ -143,6 +167,7 @@ struct event_collector {
     const auto end_clock = std::chrono::steady_clock::now();
 #if defined(__linux)
     linux_events.end(count.event_counts);
+    reference_events.end(count.event_counts, event_count::REFERENCE_CYCLES);
 #elif __APPLE__ && __aarch64__
     if (has_events()) {
       performance_counters end = apple_events.get_counters();
@@ -0,0 +1,344 @@
+#pragma once
+
+// The functions measured by the standalone benchmark programs (sizesweep,
+// scaling, alignment, errorpath), with the inputs they run on and the
+// options they share.
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "simdutf.h"
+
+#include "event_counter.h"
+
+namespace simdutf::benchmarks {
+
+// The kind of input of a function: the sizes are cut so that the input
+// stays valid (no truncated character, no partial base64 quantum).
+enum class input_kind { utf8, utf16, latin1, base64 };
+
+struct kernel {
+  const char *name;
+  input_kind kind;
+  // returns the number of output code units, when there is an output
+  size_t (*run)(const simdutf::implementation &impl, const char *input,
+                size_t size, char *output);
+  // the bytes of an output code unit, or 0 when nothing is written
+  size_t output_unit = 0;
+};
+
+inline const kernel kernels[] = {
+    {"validate_ascii", input_kind::latin1,
+     [](const simdutf::implementation &impl, const char *input, size_t size,
+        char *) -> size_t { return impl.validate_ascii(input, size); }},
+    {"validate_utf8", input_kind::utf8,
+     [](const simdutf::implementation &impl, const char *input, size_t size,
+        char *) -> size_t { return impl.validate_utf8(input, size); }},
+    {"count_utf8", input_kind::utf8,
+     [](const simdutf::implementation &impl, const char *input, size_t size,
+        char *) { return impl.count_utf8(input, size); }},
+    {"utf16_length_from_utf8", input_kind::utf8,
+     [](const simdutf::implementation &impl, const char *input, size_t size,
+        char *) { return impl.utf16_length_from_utf8(input, size); }},
+    {"convert_utf8_to_utf16le", input_kind::utf8,
+     [](const simdutf::implementation &impl, const char *input, size_t size,
+        char *output) {
+       return impl.convert_utf8_to_utf16le(
+           input, size, reinterpret_cast<char16_t *>(output));
+     },
+     2},
+    {"convert_utf8_to_utf32", input_kind::utf8,
+     [](const simdutf::implementation &impl, const char *input, size_t size,
+        char *output) {
+       return impl.convert_utf8_to_utf32(input, size,
+                                         reinterpret_cast<char32_t *>(output));
+     },
+     4},
+    {"convert_utf8_to_latin1", input_kind::latin1,
+     [](const simdutf::implementation &impl, const char *input, size_t size,
+        char *output) {
+       // the Latin 1 input is ASCII, hence also UTF-8
+       return impl.convert_utf8_to_latin1(input, size, output);
+     },
+     1},
+    {"validate_utf16le", input_kind::utf16,
+     [](const simdutf::implementation &impl, const char *input, size_t size,
+        char *) -> size_t {
+       return impl.validate_utf16le(
+           reinterpret_cast<const char16_t *>(input), size / 2);
+     }},
+    {"convert_utf16le_to_utf8", input_kind::utf16,
+     [](const simdutf::implementation &impl, const char *input, size_t size,
+        char *output) {
+       return impl.convert_utf16le_to_utf8(
+           reinterpret_cast<const char16_t *>(input), size / 2, output);
+     },
+     1},
+    {"convert_latin1_to_utf8", input_kind::latin1,
+     [](const simdutf::implementation &impl, const char *input, size_t size,
+        char *output) {
+       return impl.convert_latin1_to_utf8(input, size, output);
+     },
+     1},
+    {"base64_to_binary", input_kind::base64,
+     [](const simdutf::implementation &impl, const char *input, size_t size,
+        char *output) {
+       return impl.base64_to_binary(input, size, output).count;
+     },
+     1},
+    {"binary_to_base64", input_kind::latin1,
+     [](const simdutf::implementation &impl, const char *input, size_t size,
+        char *output) { return impl.binary_to_base64(input, size, output); },
+     1},
+};
+
+// Mostly ASCII text with some accented letters, Greek, CJK and emoji, or the
+// content of a file, repeated up to the given size.
+inline std::vector<char> make_utf8(const std::vector<char> &file, size_t size) {
+  static const char *const pieces[] = {
+      "The quick brown fox jumps over the lazy dog. ",
+      "d\xc3\xa9j\xc3\xa0 vu, caf\xc3\xa9 cr\xc3\xa8me. ",
+      "\xce\xb1\xce\xb2\xce\xb3\xce\xb4 ",
+      "\xe4\xb8\xad\xe6\x96\x87\xe5\xad\x97 ",
+      "\xf0\x9f\x98\x80 ",
+  };
+  std::vector<char> data;
+  data.reserve(size + 64);
+  for (size_t i = 0; data.size() < size; i++) {
+    if (!file.empty()) {
+      data.insert(data.end(), file.begin(), file.end());
+    } else {
+      const char *piece = pieces[i % 7 < 3 ? 0 : (i % 7) - 2];
+      data.insert(data.end(), piece, piece + std::strlen(piece));
+    }
+  }
+  return data;
+}
+
+// The largest size, at most the given one, that keeps the input valid.
+inline size_t fit_size(input_kind kind, const std::vector<char> &data,
+                       size_t size) {
+  switch (kind) {
+  case input_kind::utf8:
+    while (size > 0 && size < data.size() &&
+           (uint8_t(data[size]) & 0xc0) == 0x80) {
+      size--;
+    }
+    return size;
+  case input_kind::utf16: {
+    size &= ~size_t(1);
+    if (size >= 2) {
+      char16_t last;
+      std::memcpy(&last, data.data() + size - 2, 2);
+      if (last >= 0xd800 && last < 0xdc00) {
+        size -= 2; // a lone high surrogate
+      }
+    }
+    return size;
+  }
+  case input_kind::base64:
+    return size & ~size_t(3);
+  case input_kind::latin1:
+    return size;
+  }
+  return size;
+}
+
+inline size_t parse_size(const char *text) {
+  char *end;
+  double value = std::strtod(text, &end);
+  switch (*end) {
+  case 'k':
+  case 'K':
+    value *= 1024;
+    break;
+  case 'm':
+  case 'M':
+    value *= 1024 * 1024;
+    break;
+  case 'g':
+  case 'G':
+    value *= 1024 * 1024 * 1024;
+    break;
+  default:
+    break;
+  }
+  return size_t(value);
+}
+
+// Times batches of calls, each batch lasting at least ten microseconds,
+// until min_time_ns have elapsed, and returns the best time per call. The
+// call returns a value, which is kept so that the calls are not optimized
+// away. With a collector, the batches are measured by it, and the counts per
+// call of every batch are added to the aggregate when there is one.
+template <typename CALL>
+double best_time_ns(CALL call, double min_time_ns,
+                    event_collector *collector = nullptr,
+                    event_aggregate *aggregate = nullptr) {
+  size_t inner = 1;
+  while (true) {
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < inner; i++) {
+      call();
+    }
+    const std::chrono::duration<double, std::nano> elapsed =
+        std::chrono::steady_clock::now() - start;
+    if (elapsed.count() >= 10000 || inner >= (size_t(1) << 30)) {
+      break;
+    }
+    inner *= 2;
+  }
+  volatile size_t sink = 0;
+  double best = 0;
+  double spent_ns = 0;
+  for (size_t batch = 0; batch < 5 || spent_ns < min_time_ns; batch++) {
+    const auto start = std::chrono::steady_clock::now();
+    if (collector != nullptr) {
+      collector->start();
+    }
+    size_t accumulator = 0;
+    for (size_t i = 0; i < inner; i++) {
+      accumulator += size_t(call());
+    }
+    double elapsed_ns;
+    if (collector != nullptr) {
+      const event_count count = collector->end();
+      elapsed_ns = count.elapsed_ns();
+      if (aggregate != nullptr) {
+        *aggregate << count / inner;
+      }
+    } else {
+      elapsed_ns = std::chrono::duration<double, std::nano>(
+                       std::chrono::steady_clock::now() - start)
+                       .count();
+    }
+    sink = sink + accumulator;
+    spent_ns += elapsed_ns;
+    const double per_call = elapsed_ns / double(inner);
+    if (batch == 0 || per_call < best) {
+      best = per_call;
+    }
+  }
+  return best;
+}
+
+// The inputs of each kind, of at least max_size bytes, made from the given
+// UTF-8 text (see make_utf8).
+inline std::array<std::vector<char>, 4>
+make_inputs(const std::vector<char> &file, size_t max_size) {
+  std::array<std::vector<char>, 4> inputs;
+  inputs[size_t(input_kind::utf8)] = make_utf8(file, max_size);
+  const std::vector<char> &utf8 = inputs[size_t(input_kind::utf8)];
+  std::vector<char16_t> utf16(utf8.size());
+  utf16.resize(simdutf::convert_utf8_to_utf16le(utf8.data(), utf8.size(),
+                                                utf16.data()));
+  while (utf16.size() * 2 < max_size) {
+    utf16.insert(utf16.end(), utf16.begin(), utf16.end());
+  }
+  inputs[size_t(input_kind::utf16)].assign(
+      reinterpret_cast<const char *>(utf16.data()),
+      reinterpret_cast<const char *>(utf16.data() + utf16.size()));
+  utf16 = std::vector<char16_t>();
+  std::vector<char> &latin1 = inputs[size_t(input_kind::latin1)];
+  latin1.resize(max_size);
+  for (size_t i = 0; i < max_size; i++) {
+    latin1[i] = char(' ' + i % 95);
+  }
+  std::vector<char> &base64 = inputs[size_t(input_kind::base64)];
+  base64.resize(simdutf::base64_length_from_binary(max_size));
+  base64.resize(
+      simdutf::binary_to_base64(latin1.data(), max_size, base64.data()));
+  return inputs;
+}
+
+// Reads the content of a file, which must be valid UTF-8. Prints the error
+// and returns false otherwise.
+inline bool load_utf8_input(const char *filename, std::vector<char> &content) {
+  std::ifstream stream(filename, std::ios::binary);
+  if (!stream) {
+    std::cerr << "Cannot read " << filename << std::endl;
+    return false;
+  }
+  content.assign(std::istreambuf_iterator<char>(stream),
+                 std::istreambuf_iterator<char>());
+  if (!simdutf::validate_utf8(content.data(), content.size())) {
+    std::cerr << filename << " is not valid UTF-8" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+// The options shared by the programs: the functions and the implementations
+// to run, all of them when none is given, and the input file.
+struct selection {
+  std::set<std::string> functions;
+  std::set<std::string> implementations;
+  const char *filename = nullptr;
+
+  bool runs(const char *function) const {
+    return functions.empty() || functions.count(function) != 0;
+  }
+  // also checks that the processor supports the implementation
+  bool runs(const simdutf::implementation &impl) const {
+    return impl.supported_by_runtime_system() &&
+           (implementations.empty() ||
+            implementations.count(std::string(impl.name())) != 0);
+  }
+};
+
+enum class selection_option { unknown, parsed, listed };
+
+// Parses the argument argv[i] when it is --function, --implementation or
+// --list, or the input file when takes_file, and moves i past its value.
+// --list prints the names of the functions.
+template <typename FUNCTION, size_t N>
+selection_option parse_selection_option(int argc, char *argv[], int &i,
+                                        const FUNCTION (&functions)[N],
+                                        selection &selected,
+                                        bool takes_file = true) {
+  if (std::strcmp(argv[i], "--function") == 0 && i + 1 < argc) {
+    selected.functions.insert(argv[++i]);
+  } else if (std::strcmp(argv[i], "--implementation") == 0 && i + 1 < argc) {
+    selected.implementations.insert(argv[++i]);
+  } else if (std::strcmp(argv[i], "--list") == 0) {
+    for (const FUNCTION &function : functions) {
+      printf("%s\n", function.name);
+    }
+    return selection_option::listed;
+  } else if (takes_file && selected.filename == nullptr &&
+             argv[i][0] != '-') {
+    selected.filename = argv[i];
+  } else {
+    return selection_option::unknown;
+  }
+  return selection_option::parsed;
+}
+
+// Checks that the selected functions exist, and prints the first unknown
+// one otherwise.
+template <typename FUNCTION, size_t N>
+bool check_functions(const FUNCTION (&functions)[N],
+                     const selection &selected) {
+  for (const std::string &name : selected.functions) {
+    if (std::none_of(std::begin(functions), std::end(functions),
+                     [&](const FUNCTION &f) { return name == f.name; })) {
+      std::cerr << "Unknown function: " << name << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace simdutf::benchmarks
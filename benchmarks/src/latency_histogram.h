@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace simdutf::benchmarks {
+
+/**
+ * A histogram of durations in nanoseconds, in the manner of HdrHistogram:
+ * the values below 128 are counted exactly, and each larger power of two is
+ * split in 64 buckets of equal width, so that the reported percentiles are
+ * within 1/64 (1.6 %) of the recorded values whatever their magnitude.
+ */
+class latency_histogram {
+public:
+  void record(uint64_t value) {
+    counts[index_of(value)]++;
+    total++;
+    if (value > largest) {
+      largest = value;
+    }
+  }
+
+  void clear() {
+    counts.assign(counts.size(), 0);
+    total = 0;
+    largest = 0;
+  }
+
+  size_t count() const { return total; }
+  uint64_t max() const { return largest; }
+
+  /**
+   * The smallest value such that the given percentage (between 0 and 100)
+   * of the recorded values are at most this value, rounded up to the end of
+   * its bucket.
+   */
+  uint64_t percentile(double percentage) const {
+    if (total == 0) {
+      return 0;
+    }
+    size_t rank = size_t(percentage / 100 * double(total) + 0.5);
+    rank = rank < 1 ? 1 : (rank > total ? total : rank);
+    size_t seen = 0;
+    for (size_t i = 0; i < counts.size(); i++) {
+      seen += counts[i];
+      if (seen >= rank) {
+        const uint64_t highest = highest_of(i);
+        return highest < largest ? highest : largest;
+      }
+    }
+    return largest;
+  }
+
+private:
+  static constexpr size_t sub_buckets = 64;
+  // 128 exact values, then 64 buckets for each power of two up to 2^64
+  static constexpr size_t bucket_count = sub_buckets * 59;
+
+  static size_t index_of(uint64_t value) {
+    if (value < 2 * sub_buckets) {
+      return size_t(value);
+    }
+    size_t shift = 0;
+    while ((value >> shift) >= 2 * sub_buckets) {
+      shift++;
+    }
+    return sub_buckets * (shift + 1) + size_t(value >> shift) - sub_buckets;
+  }
+
+  static uint64_t highest_of(size_t index) {
+    if (index < 2 * sub_buckets) {
+      return index;
+    }
+    const size_t shift = index / sub_buckets - 1;
+    const uint64_t sub = index % sub_buckets + sub_buckets;
+    return ((sub + 1) << shift) - 1;
+  }
+
+  std::vector<size_t> counts = std::vector<size_t>(bucket_count);
+  size_t total = 0;
+  uint64_t largest = 0;
+};
+
+} // namespace simdutf::benchmarks
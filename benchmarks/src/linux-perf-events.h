@@ -22,7 +22,9 @@ template <int TYPE = PERF_TYPE_HARDWARE> class LinuxEvents {
   std::vector<uint64_t> ids{};
 
 public:
-  explicit LinuxEvents(std::vector<int> config_vec) : fd(0), working(true) {
+  // An empty list of events opens nothing and is never working.
+  explicit LinuxEvents(std::vector<int> config_vec)
+      : fd(-1), working(!config_vec.empty()) {
     memset(&attribs, 0, sizeof(attribs));
     attribs.type = TYPE;
     attribs.size = sizeof(attribs);
@@ -75,7 +77,9 @@ public:
     }
   }
 
-  inline void end(std::vector<unsigned long long> &results) {
+  // Stores the counts in results, from the index first on.
+  inline void end(std::vector<unsigned long long> &results,
+                  size_t first = 0) {
     if (fd != -1) {
       if (ioctl(fd, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP) == -1) {
         report_error("ioctl(PERF_EVENT_IOC_DISABLE)");
@@ -87,7 +91,7 @@ public:
     }
     // our actual results are in slots 1,3,5, ... of this structure
     for (uint32_t i = 1; i < temp_result_vec.size(); i += 2) {
-      results[i / 2] = temp_result_vec[i];
+      results[first + i / 2] = temp_result_vec[i];
     }
     for (uint32_t i = 2; i < temp_result_vec.size(); i += 2) {
       if (ids[i / 2 - 1] != temp_result_vec[i]) {
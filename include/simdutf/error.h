@@ -41,6 +41,10 @@ enum error_code {
   BASE64_EXTRA_BITS,        // The base64 input terminates with non-zero
                             // padding bits.
   OUTPUT_BUFFER_TOO_SMALL,  // The provided buffer is too small.
+  INVALID_XML_CHARACTER,    // Found a character that is not allowed in an
+                            // XML 1.0 document (a control character other
+                            // than tab, line feed and carriage return, or
+                            // U+FFFE and U+FFFF).
   OTHER                     // Not related to validation/transcoding.
 };
 
@@ -68,6 +72,8 @@ inline std::string_view error_to_string(error_code code) noexcept {
     return "BASE64_EXTRA_BITS";
   case OUTPUT_BUFFER_TOO_SMALL:
     return "OUTPUT_BUFFER_TOO_SMALL";
+  case INVALID_XML_CHARACTER:
+    return "INVALID_XML_CHARACTER";
   default:
     return "OTHER";
   }
@@ -6,6 +6,8 @@
 #ifdef SIMDUTF_INTERNAL_TESTS
   #include <vector>
 #endif
+#include <cstring>
+#include <utility>
 #include "simdutf/common_defs.h"
 #include "simdutf/compiler_check.h"
 #include "simdutf/encoding_types.h"
@@ -186,6 +188,8 @@ namespace simdutf {
 
 constexpr size_t default_line_length =
     76; ///< default line length for base64 encoding with lines
+constexpr size_t non_temporal_threshold =
+    size_t(1) << 20; ///< minimal input length for the _nt conversions
 
 #if SIMDUTF_FEATURE_DETECT_ENCODING
 /**
@@ -278,7 +282,66 @@ validate_utf8(const detail::input_span_of_byte_like auto &input) noexcept {
   }
 }
   #endif // SIMDUTF_SPAN
-#endif   // SIMDUTF_FEATURE_UTF8 || SIMDUTF_FEATURE_DETECT_ENCODING
+
+namespace internal {
+simdutf_really_inline uint64_t fixed_length_word(const char *input) noexcept {
+  uint64_t word;
+  std::memcpy(&word, input, sizeof(word));
+  return word;
+}
+
+template <size_t... I>
+simdutf_really_inline uint64_t
+fixed_length_or_words(const char *input, std::index_sequence<I...>) noexcept {
+  return (uint64_t(0) | ... | fixed_length_word(input + 8 * I));
+}
+
+template <size_t... I>
+simdutf_really_inline uint64_t
+fixed_length_or_bytes(const char *input, std::index_sequence<I...>) noexcept {
+  return (uint64_t(0) | ... | uint8_t(input[I]));
+}
+
+// Returns the bitwise OR of the N bytes at input, read as 64-bit words (the
+// last word overlapping the previous one) in straight-line code.
+template <size_t N>
+simdutf_really_inline uint64_t fixed_length_or(const char *input) noexcept {
+  if constexpr (N >= 8) {
+    uint64_t all =
+        fixed_length_or_words(input, std::make_index_sequence<N / 8>());
+    if constexpr (N % 8 != 0) {
+      all |= fixed_length_word(input + N - 8);
+    }
+    return all;
+  } else {
+    return fixed_length_or_bytes(input, std::make_index_sequence<N>());
+  }
+}
+} // namespace internal
+
+/**
+ * Validate a UTF-8 string whose length is known at compile time, such as a
+ * 16-byte key, a 36-byte UUID or a 64-byte hexadecimal hash. Up to 64 bytes,
+ * the function is inlined as straight-line code that accepts ASCII strings
+ * without a call; other strings are passed to validate_utf8.
+ *
+ * Example: bool ok = simdutf::validate_utf8_fixed<36>(uuid);
+ *
+ * @tparam N the length of the string in bytes.
+ * @param buf the UTF-8 string to validate, N bytes long.
+ * @return true if and only if the string is valid UTF-8.
+ */
+template <size_t N>
+simdutf_really_inline simdutf_warn_unused bool
+validate_utf8_fixed(const char *buf) noexcept {
+  if constexpr (N <= 64) {
+    if ((internal::fixed_length_or<N>(buf) & 0x8080808080808080) == 0) {
+      return true;
+    }
+  }
+  return validate_utf8(buf, N);
+}
+#endif // SIMDUTF_FEATURE_UTF8 || SIMDUTF_FEATURE_DETECT_ENCODING
 
 #if SIMDUTF_FEATURE_UTF8
 /**
@@ -851,6 +914,27 @@ convert_latin1_to_utf8(
 }
   #endif // SIMDUTF_SPAN
 
+/**
+ * Convert Latin1 string into UTF-8 string, like convert_latin1_to_utf8, for
+ * very large inputs whose output is not read again soon.
+ *
+ * The input is converted in chunks into a small buffer that stays in the
+ * L1 cache, and each chunk is written to the output with non-temporal
+ * (streaming) stores, which bypass the caches, while the next chunk of input
+ * is prefetched. The conversion then does not evict the working set of other
+ * code from the last-level cache. Inputs shorter than
+ * non_temporal_threshold bytes are passed to convert_latin1_to_utf8. Where
+ * non-temporal stores are not available to simdutf, the chunks are copied
+ * with regular stores.
+ *
+ * @param input         the Latin1 string to convert
+ * @param length        the length of the string in bytes
+ * @param utf8_output   the pointer to buffer that can hold conversion result
+ * @return the number of written char; 0 if conversion is not possible
+ */
+simdutf_warn_unused size_t convert_latin1_to_utf8_nt(
+    const char *input, size_t length, char *utf8_output) noexcept;
+
 /**
  * Convert Latin1 string into UTF-8 string with output limit.
  *
@@ -1225,6 +1309,21 @@ convert_utf8_to_utf16le(const detail::input_span_of_byte_like auto &utf8_input,
 }
   #endif // SIMDUTF_SPAN
 
+/**
+ * Convert possibly broken UTF-8 string into UTF-16LE string, like
+ * convert_utf8_to_utf16le, for very large inputs whose output is not read
+ * again soon: the output is written with non-temporal stores, see
+ * convert_latin1_to_utf8_nt.
+ *
+ * @param input         the UTF-8 string to convert
+ * @param length        the length of the string in bytes
+ * @param utf16_output  the pointer to buffer that can hold conversion result
+ * @return the number of written char16_t; 0 if the input was not valid UTF-8
+ * string
+ */
+simdutf_warn_unused size_t convert_utf8_to_utf16le_nt(
+    const char *input, size_t length, char16_t *utf16_output) noexcept;
+
 /**
  * Convert possibly broken UTF-8 string into UTF-16BE string.
  *
@@ -3993,8 +4092,417 @@ trim_partial_utf8(
   }
 }
   #endif // SIMDUTF_SPAN
+
+/**
+ * Convert a UTF-8 string to lower case using the simple (one-to-one) Unicode
+ * case mappings.
+ *
+ * Blocks made only of ASCII characters are mapped with SIMD instructions;
+ * other blocks fall back on the full simple Unicode lower-case mapping. Bytes
+ * that are not part of a valid UTF-8 character are copied unchanged, so
+ * invalid inputs are accepted.
+ *
+ * The output may be longer than the input (at most by half: a 2-byte
+ * character can map to a 3-byte character). An output buffer of
+ * length + length / 2 bytes is always sufficient; when the input is ASCII,
+ * length bytes are sufficient.
+ *
+ * @param input         the UTF-8 string to process
+ * @param length        the length of the string in bytes
+ * @param output        the pointer to buffer that can hold the result
+ * @return the number of bytes written
+ */
+simdutf_warn_unused size_t to_lower_ascii_utf8(const char *input,
+                                               size_t length,
+                                               char *output) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused size_t to_lower_ascii_utf8(
+    const detail::input_span_of_byte_like auto &input,
+    detail::output_span_of_byte_like auto &&output) noexcept {
+  return to_lower_ascii_utf8(reinterpret_cast<const char *>(input.data()),
+                             input.size(),
+                             reinterpret_cast<char *>(output.data()));
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert a UTF-8 string to upper case using the simple (one-to-one) Unicode
+ * case mappings.
+ *
+ * Blocks made only of ASCII characters are mapped with SIMD instructions;
+ * other blocks fall back on the full simple Unicode upper-case mapping. Bytes
+ * that are not part of a valid UTF-8 character are copied unchanged, so
+ * invalid inputs are accepted.
+ *
+ * The output may be longer than the input (at most by half). An output buffer
+ * of length + length / 2 bytes is always sufficient; when the input is ASCII,
+ * length bytes are sufficient.
+ *
+ * @param input         the UTF-8 string to process
+ * @param length        the length of the string in bytes
+ * @param output        the pointer to buffer that can hold the result
+ * @return the number of bytes written
+ */
+simdutf_warn_unused size_t to_upper_ascii_utf8(const char *input,
+                                               size_t length,
+                                               char *output) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused size_t to_upper_ascii_utf8(
+    const detail::input_span_of_byte_like auto &input,
+    detail::output_span_of_byte_like auto &&output) noexcept {
+  return to_upper_ascii_utf8(reinterpret_cast<const char *>(input.data()),
+                             input.size(),
+                             reinterpret_cast<char *>(output.data()));
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Compare two UTF-8 strings for equality, ignoring case. Characters are
+ * compared after simple Unicode case folding (CaseFolding.txt, statuses C and
+ * S), so that, e.g., "K" (U+212A KELVIN SIGN) equals "k". The two strings may
+ * thus be equal even if their lengths in bytes differ.
+ *
+ * Pairs of ASCII blocks are compared with SIMD instructions. Bytes that are not
+ * part of a valid UTF-8 character only compare equal to the same byte.
+ *
+ * @param input1        the first UTF-8 string
+ * @param length1       the length of the first string in bytes
+ * @param input2        the second UTF-8 string
+ * @param length2       the length of the second string in bytes
+ * @return true if and only if the strings are equal once case-folded
+ */
+simdutf_warn_unused bool equals_ignore_case_utf8(const char *input1,
+                                                 size_t length1,
+                                                 const char *input2,
+                                                 size_t length2) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused bool equals_ignore_case_utf8(
+    const detail::input_span_of_byte_like auto &input1,
+    const detail::input_span_of_byte_like auto &input2) noexcept {
+  return equals_ignore_case_utf8(
+      reinterpret_cast<const char *>(input1.data()), input1.size(),
+      reinterpret_cast<const char *>(input2.data()), input2.size());
+}
+  #endif // SIMDUTF_SPAN
+#endif   // SIMDUTF_FEATURE_UTF8
+
+#if SIMDUTF_FEATURE_UTF8 || SIMDUTF_FEATURE_UTF16
+// nfc_quick_check_result is the answer of the NFC_Quick_Check algorithm
+// (Unicode Standard Annex #15).
+enum nfc_quick_check_result {
+  nfc_quick_check_no = 0,   /* the string is not in NFC (or not valid) */
+  nfc_quick_check_yes = 1,  /* the string is in NFC */
+  nfc_quick_check_maybe = 2 /* the string may be in NFC: a full check is
+                               required */
+};
+#endif // SIMDUTF_FEATURE_UTF8 || SIMDUTF_FEATURE_UTF16
+
+#if SIMDUTF_FEATURE_UTF8
+/**
+ * Check whether a UTF-8 string is in Unicode Normalization Form C (NFC) using
+ * the NFC_Quick_Check algorithm of Unicode Standard Annex #15.
+ *
+ * Code points below U+0300 (ASCII and Latin-1 in particular) are always in
+ * NFC: blocks made only of such code points are skipped with SIMD
+ * instructions while the input is validated. The other code points are
+ * looked up in a compact table of canonical combining classes and
+ * NFC_Quick_Check values.
+ *
+ * Invalid UTF-8 inputs give nfc_quick_check_no.
+ *
+ * @param input         the UTF-8 string to check
+ * @param length        the length of the string in bytes
+ * @return nfc_quick_check_yes if the string is in NFC, nfc_quick_check_no if
+ * it is not (or if it is not valid UTF-8), and nfc_quick_check_maybe when a
+ * full normalization is needed to decide.
+ */
+simdutf_warn_unused nfc_quick_check_result
+is_nfc_quick_utf8(const char *input, size_t length) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused nfc_quick_check_result
+is_nfc_quick_utf8(const detail::input_span_of_byte_like auto &input) noexcept {
+  return is_nfc_quick_utf8(reinterpret_cast<const char *>(input.data()),
+                           input.size());
+}
+  #endif // SIMDUTF_SPAN
+#endif   // SIMDUTF_FEATURE_UTF8
+
+#if SIMDUTF_FEATURE_UTF16
+/**
+ * Check whether a UTF-16 string (native endianness) is in Unicode
+ * Normalization Form C (NFC) using the NFC_Quick_Check algorithm of Unicode
+ * Standard Annex #15.
+ *
+ * Code units below U+0300 are skipped with SIMD instructions; the other code
+ * points are looked up in a compact table. Unpaired surrogates give
+ * nfc_quick_check_no.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-16 string to check
+ * @param length        the length of the string in 2-byte code units (char16_t)
+ * @return nfc_quick_check_yes if the string is in NFC, nfc_quick_check_no if
+ * it is not (or if it is not valid UTF-16), and nfc_quick_check_maybe when a
+ * full normalization is needed to decide.
+ */
+simdutf_warn_unused nfc_quick_check_result
+is_nfc_quick_utf16(const char16_t *input, size_t length) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused nfc_quick_check_result
+is_nfc_quick_utf16(std::span<const char16_t> input) noexcept {
+  return is_nfc_quick_utf16(input.data(), input.size());
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Check whether a UTF-16LE string is in Unicode Normalization Form C (NFC)
+ * using the NFC_Quick_Check algorithm of Unicode Standard Annex #15.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-16LE string to check
+ * @param length        the length of the string in 2-byte code units (char16_t)
+ * @return nfc_quick_check_yes, nfc_quick_check_no or nfc_quick_check_maybe
+ */
+simdutf_warn_unused nfc_quick_check_result
+is_nfc_quick_utf16le(const char16_t *input, size_t length) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused nfc_quick_check_result
+is_nfc_quick_utf16le(std::span<const char16_t> input) noexcept {
+  return is_nfc_quick_utf16le(input.data(), input.size());
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Check whether a UTF-16BE string is in Unicode Normalization Form C (NFC)
+ * using the NFC_Quick_Check algorithm of Unicode Standard Annex #15.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-16BE string to check
+ * @param length        the length of the string in 2-byte code units (char16_t)
+ * @return nfc_quick_check_yes, nfc_quick_check_no or nfc_quick_check_maybe
+ */
+simdutf_warn_unused nfc_quick_check_result
+is_nfc_quick_utf16be(const char16_t *input, size_t length) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused nfc_quick_check_result
+is_nfc_quick_utf16be(std::span<const char16_t> input) noexcept {
+  return is_nfc_quick_utf16be(input.data(), input.size());
+}
+  #endif // SIMDUTF_SPAN
+#endif // SIMDUTF_FEATURE_UTF16
+
+#if SIMDUTF_FEATURE_UTF8
+/**
+ * Compute the number of terminal columns needed to display a UTF-8 string,
+ * following the usual wcwidth conventions:
+ * - control characters (U+0000 to U+001F, U+007F to U+009F) have width 0;
+ * - combining marks (general categories Mn and Me), format characters
+ *   (category Cf, except the soft hyphen U+00AD) and the conjoining Hangul
+ *   Jamo vowels and final consonants have width 0;
+ * - East Asian Wide (W) and Fullwidth (F) characters have width 2;
+ * - all other characters, including the East Asian Ambiguous ones, have
+ *   width 1.
+ *
+ * ASCII, Latin-1 and the CJK ideographs U+5000 to U+9FFF are classified
+ * with SIMD instructions, 64 bytes at a time; the other code points are
+ * looked up in a compact table generated from the Unicode Character
+ * Database.
+ *
+ * This function does not validate the input. If the input is not valid
+ * UTF-8, the result is implementation defined.
+ *
+ * @param input         the UTF-8 string to measure
+ * @param length        the length of the string in bytes
+ * @return the display width of the string in columns
+ */
+simdutf_warn_unused size_t display_width_utf8(const char *input,
+                                              size_t length) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused size_t
+display_width_utf8(const detail::input_span_of_byte_like auto &input) noexcept {
+  return display_width_utf8(reinterpret_cast<const char *>(input.data()),
+                            input.size());
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Count the extended grapheme clusters (user-perceived characters) of a UTF-8
+ * string, following Unicode Standard Annex #29. For example, "e" followed by
+ * the combining acute accent U+0301, the flag made of two regional
+ * indicators and an emoji ZWJ sequence each count as one cluster.
+ *
+ * Blocks of 64 bytes where every code point is a cluster by itself (no
+ * combining marks, joiners, regional indicators or Hangul Jamo, as in most
+ * ASCII, Latin, Greek, Cyrillic and CJK text) are counted with SIMD
+ * instructions like count_utf8; the full segmentation algorithm only runs
+ * around the other code points.
+ *
+ * This function does not validate the input. If the input is not valid
+ * UTF-8, the result is implementation defined.
+ *
+ * @param input         the UTF-8 string to process
+ * @param length        the length of the string in bytes
+ * @return the number of extended grapheme clusters
+ */
+simdutf_warn_unused size_t count_graphemes_utf8(const char *input,
+                                                size_t length) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused size_t count_graphemes_utf8(
+    const detail::input_span_of_byte_like auto &input) noexcept {
+  return count_graphemes_utf8(reinterpret_cast<const char *>(input.data()),
+                              input.size());
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Find the end of the first extended grapheme cluster of a UTF-8 string,
+ * following Unicode Standard Annex #29. The input must start at a cluster
+ * boundary: to iterate over the clusters of a string, advance the input by
+ * the returned value until it is empty.
+ *
+ * A byte that does not start a valid UTF-8 character forms a cluster by
+ * itself.
+ *
+ * @param input         the UTF-8 string to process
+ * @param length        the length of the string in bytes
+ * @return the length in bytes of the first cluster (0 if length is 0)
+ */
+simdutf_warn_unused size_t next_grapheme_boundary_utf8(const char *input,
+                                                       size_t length) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused size_t next_grapheme_boundary_utf8(
+    const detail::input_span_of_byte_like auto &input) noexcept {
+  return next_grapheme_boundary_utf8(
+      reinterpret_cast<const char *>(input.data()), input.size());
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Escape a UTF-8 string for HTML text and attribute values: '&', '<', '>',
+ * '"' and '\'' are replaced by "&amp;", "&lt;", "&gt;", "&quot;" and "&#39;",
+ * and the other characters are copied. The input is validated in the same
+ * pass.
+ *
+ * The bytes are classified with SIMD lookups while the UTF-8 validator runs
+ * over the same blocks, and blocks without special characters are copied
+ * with wide stores.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-8 string to escape
+ * @param length        the length of the string in bytes
+ * @param output        the pointer to a buffer that can hold the escaped
+ * string: 6 * length bytes are always enough
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either position of the error
+ * (in the input in code units) if any, or the number of bytes written if
+ * successful. The content of the buffer is unspecified on error.
+ */
+simdutf_warn_unused result escape_html_utf8(const char *input, size_t length,
+                                            char *output) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused result
+escape_html_utf8(const detail::input_span_of_byte_like auto &input,
+                 detail::output_span_of_byte_like auto &&output) noexcept {
+  return escape_html_utf8(reinterpret_cast<const char *>(input.data()),
+                          input.size(),
+                          reinterpret_cast<char *>(output.data()));
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Escape a UTF-8 string for XML 1.0 text and attribute values, like
+ * escape_html_utf8 but with "&apos;" for '\''. Characters that XML 1.0 does
+ * not allow (the C0 controls other than tab, line feed and carriage return,
+ * U+FFFE and U+FFFF) are reported as INVALID_XML_CHARACTER errors.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-8 string to escape
+ * @param length        the length of the string in bytes
+ * @param output        the pointer to a buffer that can hold the escaped
+ * string: 6 * length bytes are always enough
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either position of the error
+ * (in the input in code units) if any, or the number of bytes written if
+ * successful. The content of the buffer is unspecified on error.
+ */
+simdutf_warn_unused result escape_xml_utf8(const char *input, size_t length,
+                                           char *output) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused result
+escape_xml_utf8(const detail::input_span_of_byte_like auto &input,
+                detail::output_span_of_byte_like auto &&output) noexcept {
+  return escape_xml_utf8(reinterpret_cast<const char *>(input.data()),
+                         input.size(),
+                         reinterpret_cast<char *>(output.data()));
+}
+  #endif // SIMDUTF_SPAN
 #endif   // SIMDUTF_FEATURE_UTF8
 
+#if SIMDUTF_FEATURE_UTF16
+/**
+ * Compute the number of terminal columns needed to display a UTF-16 string
+ * (native endianness). See display_width_utf8 for the width of each
+ * character. Unpaired high surrogates have width 1 and unpaired low
+ * surrogates have width 0.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-16 string to measure
+ * @param length        the length of the string in 2-byte code units (char16_t)
+ * @return the display width of the string in columns
+ */
+simdutf_warn_unused size_t display_width_utf16(const char16_t *input,
+                                               size_t length) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused size_t
+display_width_utf16(std::span<const char16_t> input) noexcept {
+  return display_width_utf16(input.data(), input.size());
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Compute the number of terminal columns needed to display a UTF-16LE
+ * string. See display_width_utf8 for the width of each character.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-16LE string to measure
+ * @param length        the length of the string in 2-byte code units (char16_t)
+ * @return the display width of the string in columns
+ */
+simdutf_warn_unused size_t display_width_utf16le(const char16_t *input,
+                                                 size_t length) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused size_t
+display_width_utf16le(std::span<const char16_t> input) noexcept {
+  return display_width_utf16le(input.data(), input.size());
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Compute the number of terminal columns needed to display a UTF-16BE
+ * string. See display_width_utf8 for the width of each character.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-16BE string to measure
+ * @param length        the length of the string in 2-byte code units (char16_t)
+ * @return the display width of the string in columns
+ */
+simdutf_warn_unused size_t display_width_utf16be(const char16_t *input,
+                                                 size_t length) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused size_t
+display_width_utf16be(std::span<const char16_t> input) noexcept {
+  return display_width_utf16be(input.data(), input.size());
+}
+  #endif // SIMDUTF_SPAN
+#endif // SIMDUTF_FEATURE_UTF16
+
 #if SIMDUTF_FEATURE_UTF16
 /**
  * Given a valid UTF-16BE string having a possibly truncated last character,
@@ -4093,13 +4601,13 @@ trim_partial_utf16(std::span<const char16_t> valid_utf16_input) noexcept {
   #endif // SIMDUTF_SPAN
 #endif   // SIMDUTF_FEATURE_UTF16
 
-#if SIMDUTF_FEATURE_BASE64 || SIMDUTF_FEATURE_UTF16 ||                         \
-    SIMDUTF_FEATURE_DETECT_ENCODING
+#if SIMDUTF_FEATURE_BASE64 || SIMDUTF_FEATURE_UTF8 ||                          \
+    SIMDUTF_FEATURE_UTF16 || SIMDUTF_FEATURE_DETECT_ENCODING
   #ifndef SIMDUTF_NEED_TRAILING_ZEROES
     #define SIMDUTF_NEED_TRAILING_ZEROES 1
   #endif
-#endif // SIMDUTF_FEATURE_BASE64 || SIMDUTF_FEATURE_UTF16 ||
-       // SIMDUTF_FEATURE_DETECT_ENCODING
+#endif // SIMDUTF_FEATURE_BASE64 || SIMDUTF_FEATURE_UTF8 ||
+       // SIMDUTF_FEATURE_UTF16 || SIMDUTF_FEATURE_DETECT_ENCODING
 
 #if SIMDUTF_FEATURE_BASE64
 // base64_options are used to specify the base64 encoding options.
@@ -4447,6 +4955,83 @@ base64_to_binary(
 }
   #endif // SIMDUTF_SPAN
 
+/**
+ * Convert a base64 input whose length is known at compile time, such as the
+ * 24 or 44 characters of an encoded 16-byte or 32-byte hash, into binary
+ * output. Up to 256 characters, when N is divisible by four, the function is
+ * inlined, without tail handling, and decodes inputs made of base64
+ * characters, with at most two padding characters at the end; other inputs,
+ * including invalid ones and inputs with spaces, are passed to
+ * base64_to_binary, which gives the same results.
+ *
+ * @tparam N the length of the input in bytes.
+ * @param input         the base64 string to process, N bytes long
+ * @param output        the pointer to a buffer that can hold the conversion
+ * result (should be at least maximal_binary_length_from_base64(input, N)
+ * bytes long).
+ * @param options       the base64 options to use, usually base64_default or
+ * base64_url, and base64_default by default.
+ * @param last_chunk_options the last chunk handling options,
+ * last_chunk_handling_options::loose by default.
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either position of the error
+ * (in the input in bytes) if any, or the number of bytes written if successful.
+ */
+template <size_t N>
+simdutf_really_inline simdutf_warn_unused result base64_to_binary_fixed(
+    const char *input, char *output, base64_options options = base64_default,
+    last_chunk_handling_options last_chunk_options = loose) noexcept {
+  if constexpr (N > 0 && N % 4 == 0 && N <= 256) {
+    namespace tables = ::simdutf::tables::base64;
+    const bool url = (options & base64_url) != 0;
+    const bool default_or_url = (options & base64_default_or_url) != 0;
+    const uint32_t *d0 = default_or_url ? tables::base64_default_or_url::d0
+                         : url          ? tables::base64_url::d0
+                                        : tables::base64_default::d0;
+    const uint32_t *d1 = default_or_url ? tables::base64_default_or_url::d1
+                         : url          ? tables::base64_url::d1
+                                        : tables::base64_default::d1;
+    const uint32_t *d2 = default_or_url ? tables::base64_default_or_url::d2
+                         : url          ? tables::base64_url::d2
+                                        : tables::base64_default::d2;
+    const uint32_t *d3 = default_or_url ? tables::base64_default_or_url::d3
+                         : url          ? tables::base64_url::d3
+                                        : tables::base64_default::d3;
+    // Each group of four characters gives three bytes, in the low bits of
+    // the bitwise OR of the table entries; invalid characters set bit 24.
+    uint32_t all = 0;
+    for (size_t i = 0; i + 4 < N; i += 4) {
+      const uint32_t x = d0[uint8_t(input[i])] | d1[uint8_t(input[i + 1])] |
+                         d2[uint8_t(input[i + 2])] |
+                         d3[uint8_t(input[i + 3])];
+      all |= x;
+      output[i / 4 * 3] = char(x);
+      output[i / 4 * 3 + 1] = char(x >> 8);
+      output[i / 4 * 3 + 2] = char(x >> 16);
+    }
+    const char *last = input + N - 4;
+    const size_t padding = last[3] != '=' ? 0 : last[2] != '=' ? 1 : 2;
+    const uint32_t x = d0[uint8_t(last[0])] | d1[uint8_t(last[1])] |
+                       (padding < 2 ? d2[uint8_t(last[2])] : 0) |
+                       (padding < 1 ? d3[uint8_t(last[3])] : 0);
+    all |= x;
+    // Only the loose mode ignores the bits left over by the padding.
+    if (all < 0x01000000 &&
+        (padding == 0 || last_chunk_options == loose)) {
+      constexpr size_t full = N / 4 * 3;
+      output[full - 3] = char(x);
+      if (padding < 2) {
+        output[full - 2] = char(x >> 8);
+      }
+      if (padding < 1) {
+        output[full - 1] = char(x >> 16);
+      }
+      return {error_code::SUCCESS, full - padding};
+    }
+  }
+  return base64_to_binary(input, N, output, options, last_chunk_options);
+}
+
 /**
  * Provide the base64 length in bytes given the length of a binary input.
  *
@@ -6719,8 +7304,177 @@ public:
    */
   simdutf_warn_unused virtual size_t
   count_utf8(const char *input, size_t length) const noexcept = 0;
+
+  /**
+   * Convert a UTF-8 string to lower case using the simple (one-to-one) Unicode
+   * case mappings. Bytes that are not part of a valid UTF-8 character are
+   * copied unchanged.
+   *
+   * An output buffer of length + length / 2 bytes is always sufficient.
+   *
+   * @param input         the UTF-8 string to process
+   * @param length        the length of the string in bytes
+   * @param output        the pointer to buffer that can hold the result
+   * @return the number of bytes written
+   */
+  simdutf_warn_unused virtual size_t
+  to_lower_ascii_utf8(const char *input, size_t length,
+                      char *output) const noexcept = 0;
+
+  /**
+   * Convert a UTF-8 string to upper case using the simple (one-to-one) Unicode
+   * case mappings. Bytes that are not part of a valid UTF-8 character are
+   * copied unchanged.
+   *
+   * An output buffer of length + length / 2 bytes is always sufficient.
+   *
+   * @param input         the UTF-8 string to process
+   * @param length        the length of the string in bytes
+   * @param output        the pointer to buffer that can hold the result
+   * @return the number of bytes written
+   */
+  simdutf_warn_unused virtual size_t
+  to_upper_ascii_utf8(const char *input, size_t length,
+                      char *output) const noexcept = 0;
+
+  /**
+   * Compare two UTF-8 strings for equality after simple Unicode case folding.
+   *
+   * @param input1        the first UTF-8 string
+   * @param length1       the length of the first string in bytes
+   * @param input2        the second UTF-8 string
+   * @param length2       the length of the second string in bytes
+   * @return true if and only if the strings are equal once case-folded
+   */
+  simdutf_warn_unused virtual bool
+  equals_ignore_case_utf8(const char *input1, size_t length1,
+                          const char *input2,
+                          size_t length2) const noexcept = 0;
+#endif // SIMDUTF_FEATURE_UTF8
+
+#if SIMDUTF_FEATURE_UTF8
+  /**
+   * Check whether a UTF-8 string is in Unicode Normalization Form C (NFC)
+   * using the NFC_Quick_Check algorithm. Invalid UTF-8 inputs give
+   * nfc_quick_check_no.
+   *
+   * @param input         the UTF-8 string to check
+   * @param length        the length of the string in bytes
+   * @return nfc_quick_check_yes, nfc_quick_check_no or nfc_quick_check_maybe
+   */
+  simdutf_warn_unused virtual nfc_quick_check_result
+  is_nfc_quick_utf8(const char *input, size_t length) const noexcept = 0;
+#endif // SIMDUTF_FEATURE_UTF8
+
+#if SIMDUTF_FEATURE_UTF16
+  /**
+   * Check whether a UTF-16LE string is in Unicode Normalization Form C (NFC)
+   * using the NFC_Quick_Check algorithm. Unpaired surrogates give
+   * nfc_quick_check_no.
+   *
+   * @param input         the UTF-16LE string to check
+   * @param length        the length of the string in 2-byte code units
+   * @return nfc_quick_check_yes, nfc_quick_check_no or nfc_quick_check_maybe
+   */
+  simdutf_warn_unused virtual nfc_quick_check_result
+  is_nfc_quick_utf16le(const char16_t *input,
+                       size_t length) const noexcept = 0;
+
+  /**
+   * Check whether a UTF-16BE string is in Unicode Normalization Form C (NFC)
+   * using the NFC_Quick_Check algorithm. Unpaired surrogates give
+   * nfc_quick_check_no.
+   *
+   * @param input         the UTF-16BE string to check
+   * @param length        the length of the string in 2-byte code units
+   * @return nfc_quick_check_yes, nfc_quick_check_no or nfc_quick_check_maybe
+   */
+  simdutf_warn_unused virtual nfc_quick_check_result
+  is_nfc_quick_utf16be(const char16_t *input,
+                       size_t length) const noexcept = 0;
+#endif // SIMDUTF_FEATURE_UTF16
+
+#if SIMDUTF_FEATURE_UTF8
+  /**
+   * Compute the number of terminal columns needed to display a UTF-8 string
+   * (wcwidth conventions, East Asian Wide and Fullwidth characters take two
+   * columns). If the input is not valid UTF-8, the result is implementation
+   * defined.
+   *
+   * @param input         the UTF-8 string to measure
+   * @param length        the length of the string in bytes
+   * @return the display width of the string in columns
+   */
+  simdutf_warn_unused virtual size_t
+  display_width_utf8(const char *input, size_t length) const noexcept = 0;
+
+  /**
+   * Count the extended grapheme clusters of a UTF-8 string (Unicode Standard
+   * Annex #29). If the input is not valid UTF-8, the result is implementation
+   * defined.
+   *
+   * @param input         the UTF-8 string to process
+   * @param length        the length of the string in bytes
+   * @return the number of extended grapheme clusters
+   */
+  simdutf_warn_unused virtual size_t
+  count_graphemes_utf8(const char *input, size_t length) const noexcept = 0;
+
+  /**
+   * Escape a UTF-8 string for HTML, validating it in the same pass. See
+   * simdutf::escape_html_utf8.
+   *
+   * @param input         the UTF-8 string to escape
+   * @param length        the length of the string in bytes
+   * @param output        the pointer to a buffer of at least 6 * length bytes
+   * @return a result pair struct with an error code and either the position
+   * of the error or the number of bytes written
+   */
+  simdutf_warn_unused virtual result
+  escape_html_utf8(const char *input, size_t length,
+                   char *output) const noexcept = 0;
+
+  /**
+   * Escape a UTF-8 string for XML 1.0, validating it in the same pass and
+   * rejecting the characters XML does not allow. See simdutf::escape_xml_utf8.
+   *
+   * @param input         the UTF-8 string to escape
+   * @param length        the length of the string in bytes
+   * @param output        the pointer to a buffer of at least 6 * length bytes
+   * @return a result pair struct with an error code and either the position
+   * of the error or the number of bytes written
+   */
+  simdutf_warn_unused virtual result
+  escape_xml_utf8(const char *input, size_t length,
+                  char *output) const noexcept = 0;
 #endif // SIMDUTF_FEATURE_UTF8
 
+#if SIMDUTF_FEATURE_UTF16
+  /**
+   * Compute the number of terminal columns needed to display a UTF-16LE
+   * string.
+   *
+   * @param input         the UTF-16LE string to measure
+   * @param length        the length of the string in 2-byte code units
+   * @return the display width of the string in columns
+   */
+  simdutf_warn_unused virtual size_t
+  display_width_utf16le(const char16_t *input,
+                        size_t length) const noexcept = 0;
+
+  /**
+   * Compute the number of terminal columns needed to display a UTF-16BE
+   * string.
+   *
+   * @param input         the UTF-16BE string to measure
+   * @param length        the length of the string in 2-byte code units
+   * @return the display width of the string in columns
+   */
+  simdutf_warn_unused virtual size_t
+  display_width_utf16be(const char16_t *input,
+                        size_t length) const noexcept = 0;
+#endif // SIMDUTF_FEATURE_UTF16
+
 #if SIMDUTF_FEATURE_BASE64
   /**
    * Provide the maximal binary length in bytes given the base64 input.
@@ -7192,6 +7946,330 @@ get_available_implementations();
 extern SIMDUTF_DLLIMPORTEXPORT internal::atomic_ptr<const implementation> &
 get_active_implementation();
 
+/**
+ * Makes the free functions run on the given implementation in the calling
+ * thread, until the object is destroyed, whatever the active implementation.
+ * The other threads are not affected: a thread pool serving latency-critical
+ * requests may, for example, stay away from AVX-512 while the batch threads
+ * use it.
+ *
+ * The implementation runs all the inputs of the thread, even when it is the
+ * detected one: the short inputs are not sent to a narrower implementation
+ * (see SIMDUTF_SIZE_AWARE_DISPATCH), nor do autotuned choices apply.
+ *
+ * The overrides nest: destroying one restores the previous override of the
+ * thread. A null implementation returns the thread to the active
+ * implementation. The implementation must be supported by the processor (see
+ * implementation::supported_by_runtime_system()). The object must be
+ * destroyed in the thread that created it.
+ *
+ * While no override exists in any thread, the free functions pay a single
+ * relaxed load to check for one. With a single implementation compiled in,
+ * overrides have no effect.
+ *
+ * Example:
+ *
+ *   simdutf::scoped_implementation guard(
+ *       simdutf::get_available_implementations()["haswell"]);
+ *   simdutf::validate_utf8(input, length); // runs on haswell
+ */
+class scoped_implementation {
+public:
+  SIMDUTF_DLLIMPORTEXPORT explicit scoped_implementation(
+      const implementation *impl) noexcept;
+  SIMDUTF_DLLIMPORTEXPORT ~scoped_implementation() noexcept;
+  scoped_implementation(const scoped_implementation &) = delete;
+  scoped_implementation &operator=(const scoped_implementation &) = delete;
+
+private:
+  const implementation *previous;
+};
+
+/**
+ * Times every implementation supported by this processor on a few kilobytes
+ * of synthetic text, and makes the free functions for validation, counting,
+ * length computation, the main transcodings and base64 run on the fastest
+ * one for each function. The other functions keep running on the active
+ * implementation. The choice is dropped if another implementation is made
+ * active. Autotuning is only compiled in when simdutf is built with
+ * SIMDUTF_AUTOTUNE (the CMake option of the same name).
+ *
+ * Autotuning can also run on first use, by setting the environment variable
+ * SIMDUTF_AUTOTUNE to 1, or to the path of a profile file: it is loaded if it
+ * exists, and written after timing if it does not. A profile that exists but
+ * cannot be loaded is left as it is, and the implementations are timed.
+ *
+ * The choice is made once per process, by autotune(), load_autotune_profile()
+ * or the environment variable, since other threads may be reading it.
+ * Timing takes a few milliseconds and should be done at startup.
+ *
+ * @return false if autotuning is not compiled in or the choice was already
+ * made.
+ */
+extern SIMDUTF_DLLIMPORTEXPORT bool autotune() noexcept;
+
+/**
+ * Writes the choice of implementation per function to a profile file, to be
+ * loaded by load_autotune_profile on a later run.
+ *
+ * @param filename the path of the profile file
+ * @return true if the file was written
+ */
+extern SIMDUTF_DLLIMPORTEXPORT bool
+save_autotune_profile(const char *filename) noexcept;
+
+/**
+ * Loads a profile written by save_autotune_profile, as if autotune() had run.
+ * The functions and implementations unknown to this build or unsupported by
+ * this processor are skipped. The lines may end with "\r\n", and the last one
+ * may lack its newline.
+ *
+ * @param filename the path of the profile file
+ * @return false if autotuning is not compiled in, the choice was already made
+ * (see autotune()), or the file could not be read or is malformed
+ */
+extern SIMDUTF_DLLIMPORTEXPORT bool
+load_autotune_profile(const char *filename) noexcept;
+
+/**
+ * Plain function pointers to the code of one implementation, for the most
+ * common functions. Calling through them skips the atomic load of the active
+ * implementation and the virtual call made by the free functions: hot loops
+ * on short strings may keep a reference to the table. The UTF-16 functions
+ * are the little-endian ones.
+ *
+ * See resolved_dispatch().
+ */
+struct resolved_functions {
+#if SIMDUTF_FEATURE_UTF8
+  bool (*validate_utf8)(const char *buf, size_t len) noexcept;
+  result (*validate_utf8_with_errors)(const char *buf, size_t len) noexcept;
+  size_t (*count_utf8)(const char *buf, size_t length) noexcept;
+#endif // SIMDUTF_FEATURE_UTF8
+#if SIMDUTF_FEATURE_ASCII
+  bool (*validate_ascii)(const char *buf, size_t len) noexcept;
+#endif // SIMDUTF_FEATURE_ASCII
+#if SIMDUTF_FEATURE_UTF16
+  bool (*validate_utf16le)(const char16_t *buf, size_t len) noexcept;
+  size_t (*count_utf16le)(const char16_t *buf, size_t length) noexcept;
+#endif // SIMDUTF_FEATURE_UTF16
+#if SIMDUTF_FEATURE_UTF32
+  bool (*validate_utf32)(const char32_t *buf, size_t len) noexcept;
+#endif // SIMDUTF_FEATURE_UTF32
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+  size_t (*utf16_length_from_utf8)(const char *input, size_t length) noexcept;
+  size_t (*utf8_length_from_utf16le)(const char16_t *input,
+                                     size_t length) noexcept;
+  size_t (*convert_utf8_to_utf16le)(const char *input, size_t length,
+                                    char16_t *utf16_output) noexcept;
+  size_t (*convert_valid_utf8_to_utf16le)(const char *input, size_t length,
+                                          char16_t *utf16_buffer) noexcept;
+  size_t (*convert_utf16le_to_utf8)(const char16_t *buf, size_t len,
+                                    char *utf8_buffer) noexcept;
+  size_t (*convert_valid_utf16le_to_utf8)(const char16_t *buf, size_t len,
+                                          char *utf8_buffer) noexcept;
+#endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
+  size_t (*utf32_length_from_utf8)(const char *input, size_t length) noexcept;
+  size_t (*utf8_length_from_utf32)(const char32_t *input,
+                                   size_t length) noexcept;
+  size_t (*convert_utf8_to_utf32)(const char *input, size_t length,
+                                  char32_t *utf32_output) noexcept;
+  size_t (*convert_utf32_to_utf8)(const char32_t *buf, size_t len,
+                                  char *utf8_buffer) noexcept;
+#endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_LATIN1
+  size_t (*utf8_length_from_latin1)(const char *input, size_t length) noexcept;
+  size_t (*convert_latin1_to_utf8)(const char *input, size_t length,
+                                   char *utf8_output) noexcept;
+  size_t (*convert_utf8_to_latin1)(const char *input, size_t length,
+                                   char *latin1_output) noexcept;
+#endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_LATIN1
+#if SIMDUTF_FEATURE_BASE64
+  result (*base64_to_binary)(const char *input, size_t length, char *output,
+                             base64_options options,
+                             last_chunk_handling_options
+                                 last_chunk_options) noexcept;
+  size_t (*binary_to_base64)(const char *input, size_t length, char *output,
+                             base64_options options) noexcept;
+#endif // SIMDUTF_FEATURE_BASE64
+};
+
+/**
+ * The function pointers of the active implementation, detected on first use.
+ * The tables are constant, so the reference may be kept: it does not follow
+ * later changes of the active implementation, nor the size-aware or
+ * autotuned choices of the free functions. When simdutf is built with a
+ * single implementation, the table is that of this implementation.
+ *
+ * Example:
+ *
+ *   const simdutf::resolved_functions &functions =
+ *       simdutf::resolved_dispatch();
+ *   for (const std::string &key : keys) {
+ *     if (!functions.validate_utf8(key.data(), key.size())) { ... }
+ *   }
+ */
+extern SIMDUTF_DLLIMPORTEXPORT const resolved_functions &
+resolved_dispatch() noexcept;
+
+/**
+ * The instruction sets detected on this processor, as a mask of
+ * internal::instruction_set values (e.g., internal::instruction_set::AVX2).
+ * Each instruction set has its own bit, and the bits do not change between
+ * releases, so that the masks can be logged and compared across machines.
+ * See instruction_set_name() to name the bits.
+ *
+ * Example:
+ *
+ *   const uint32_t detected = simdutf::get_detected_instruction_sets();
+ *   for (uint32_t bit = 1; bit != 0; bit <<= 1) {
+ *     if (detected & bit) { puts(simdutf::instruction_set_name(bit)); }
+ *   }
+ */
+extern SIMDUTF_DLLIMPORTEXPORT uint32_t
+get_detected_instruction_sets() noexcept;
+
+/**
+ * The name of an instruction set, e.g., "AVX512VBMI2" for
+ * internal::instruction_set::AVX512VBMI2.
+ *
+ * @param instruction_set a single bit of internal::instruction_set
+ * @return the name, or nullptr if simdutf does not detect this bit
+ */
+extern SIMDUTF_DLLIMPORTEXPORT const char *
+instruction_set_name(uint32_t instruction_set) noexcept;
+
+/**
+ * Why an implementation runs a function through the free functions, or why
+ * it does not, see get_dispatch_reason().
+ */
+enum class dispatch_reason {
+  chosen,                  // Runs the inputs of at least `below` code units.
+  chosen_for_short_inputs, // Runs the inputs shorter than `below`.
+  unsupported,             // The processor lacks some of its instruction sets.
+  lower_priority,          // A more advanced implementation is supported.
+  overridden,              // Another implementation was selected by hand, by
+                           // SIMDUTF_FORCE_IMPLEMENTATION or by a
+                           // scoped_implementation.
+  slower_when_tuned        // autotune() (or its profile) found another
+                           // implementation faster.
+};
+
+inline std::string_view to_string(dispatch_reason reason) noexcept {
+  switch (reason) {
+  case dispatch_reason::chosen:
+    return "chosen";
+  case dispatch_reason::chosen_for_short_inputs:
+    return "chosen_for_short_inputs";
+  case dispatch_reason::unsupported:
+    return "unsupported";
+  case dispatch_reason::lower_priority:
+    return "lower_priority";
+  case dispatch_reason::overridden:
+    return "overridden";
+  case dispatch_reason::slower_when_tuned:
+    return "slower_when_tuned";
+  }
+  return "<unknown>";
+}
+
+/**
+ * The implementations running a function through the free functions, see
+ * get_dispatch_report().
+ */
+struct function_dispatch {
+  /** The name of the function, e.g., "validate_utf8". */
+  const char *name;
+  /** The implementation running the inputs of at least `below` code units. */
+  const implementation *chosen;
+  /**
+   * The implementation running the shorter inputs (see
+   * SIMDUTF_SIZE_AWARE_DISPATCH), or nullptr if `chosen` runs all of them.
+   */
+  const implementation *short_inputs;
+  /** The length, in code units, below which short_inputs runs the inputs. */
+  size_t below;
+};
+
+/**
+ * Reports the implementations running the functions whose choice may differ
+ * from the active implementation: validation, counting, length computation,
+ * the main transcodings and base64. The variants of a function for both
+ * UTF-16 endiannesses share their entry. The other functions run on the
+ * active implementation. The report is that of the calling thread (see
+ * scoped_implementation), and detects the implementation if needed.
+ *
+ * @param output the array receiving the report, one entry per function
+ * @param capacity the number of entries of the array
+ * @return the number of functions, which may exceed capacity
+ */
+extern SIMDUTF_DLLIMPORTEXPORT size_t
+get_dispatch_report(function_dispatch *output, size_t capacity) noexcept;
+
+/**
+ * Tells why an implementation runs a function, or why it does not, in the
+ * calling thread.
+ *
+ * @param function the name of a function, as in get_dispatch_report(); the
+ * other names stand for the functions running on the active implementation
+ * @param impl an implementation from get_available_implementations()
+ * @return the reason
+ */
+extern SIMDUTF_DLLIMPORTEXPORT dispatch_reason
+get_dispatch_reason(const char *function, const implementation *impl) noexcept;
+
+#if SIMDUTF_STATISTICS
+/**
+ * The number of buckets of the size histograms, see function_statistics.
+ */
+constexpr size_t statistics_size_buckets = 65;
+
+/**
+ * The usage of a function through the free functions, counted when simdutf is
+ * built with SIMDUTF_STATISTICS (the CMake option of the same name). The
+ * variants of a function for both UTF-16 endiannesses share their
+ * statistics.
+ */
+struct function_statistics {
+  /** The name of the function, e.g., "validate_utf8". */
+  const char *name;
+  /** The number of calls. */
+  uint64_t calls;
+  /** The size of the inputs, in bytes (in characters for base64_to_binary). */
+  uint64_t bytes;
+  /**
+   * The number of calls reporting an invalid input (validation failures,
+   * validating conversions returning 0 on a non-empty input, base64 errors).
+   * The counting and length functions never count errors.
+   */
+  uint64_t errors;
+  /**
+   * The number of calls by input size: size_histogram[0] counts the empty
+   * inputs, and size_histogram[k] the inputs of 2^(k-1) to 2^k - 1 bytes.
+   */
+  uint64_t size_histogram[statistics_size_buckets];
+};
+
+/**
+ * Takes a snapshot of the statistics of the instrumented functions since the
+ * last reset_statistics(). The counters are kept per thread without locking,
+ * so that a snapshot taken while other threads call simdutf may miss their
+ * latest calls.
+ *
+ * @param output the array receiving the statistics, one entry per function
+ * @param capacity the number of entries of the array
+ * @return the number of instrumented functions, which may exceed capacity
+ */
+extern SIMDUTF_DLLIMPORTEXPORT size_t
+get_statistics(function_statistics *output, size_t capacity) noexcept;
+
+/**
+ * Restarts the statistics from zero.
+ */
+extern SIMDUTF_DLLIMPORTEXPORT void reset_statistics() noexcept;
+#endif // SIMDUTF_STATISTICS
+
 } // namespace simdutf
 
 #if SIMDUTF_FEATURE_BASE64
@@ -85,6 +85,9 @@ struct simdutf_riscv_hwprobe {
 namespace simdutf {
 namespace internal {
 
+// Each instruction set has its own bit, whatever the architecture: the masks
+// are reported by simdutf::get_detected_instruction_sets(), and the values
+// must not change.
 enum instruction_set {
   DEFAULT = 0x0,
   NEON = 0x1,
@@ -103,11 +106,11 @@ enum instruction_set {
   AVX512BW = 0x4000,
   AVX512VL = 0x8000,
   AVX512VBMI2 = 0x10000,
-  AVX512VPOPCNTDQ = 0x2000,
-  RVV = 0x4000,
-  ZVBB = 0x8000,
+  AVX512VPOPCNTDQ = 0x20000,
   LSX = 0x40000,
   LASX = 0x80000,
+  RVV = 0x100000,
+  ZVBB = 0x200000,
 };
 
 #if defined(__PPC64__)
@@ -0,0 +1,132 @@
+#ifndef SIMDUTF_DISPLAY_WIDTH_H
+#define SIMDUTF_DISPLAY_WIDTH_H
+
+#include "simdutf/unicode_width_tables.h"
+
+namespace simdutf {
+namespace scalar {
+namespace {
+namespace display_width {
+
+using tables::unicode_width::first_table_code_point;
+
+// Number of terminal columns used by a code point, following the usual
+// wcwidth conventions: control characters (C0, DEL and C1) take no column,
+// neither do the combining marks, the format characters (except U+00AD) and
+// the conjoining Hangul Jamo vowels and final consonants. East Asian Wide and
+// Fullwidth characters take two columns and everything else (including the
+// East Asian Ambiguous characters) takes one.
+simdutf_really_inline size_t code_point_width(uint32_t code_point) {
+  if (code_point < first_table_code_point) {
+    return (code_point < 0x20 || (code_point >= 0x7F && code_point < 0xA0))
+               ? 0
+               : 1;
+  }
+  using tables::unicode_width::width_ranges;
+  size_t lo = 0;
+  size_t count = sizeof(width_ranges) / sizeof(width_ranges[0]);
+  // find the last range starting at or before code_point
+  while (count > 1) {
+    size_t half = count / 2;
+    if (width_ranges[lo + half].first <= code_point) {
+      lo += half;
+      count -= half;
+    } else {
+      count = half;
+    }
+  }
+  const auto &r = width_ranges[lo];
+  if (code_point >= r.first && code_point - r.first < r.count) {
+    return r.width;
+  }
+  return 1;
+}
+
+#if SIMDUTF_FEATURE_UTF8
+// UTF-8 bytes below this value cannot start a code point at or above
+// first_table_code_point (U+0300 is encoded as 0xCC 0x80).
+constexpr uint8_t first_table_utf8_byte =
+    uint8_t(0xC0 | (first_table_code_point >> 6));
+// The three-byte sequences starting with these bytes encode wide code points.
+constexpr uint8_t first_wide_utf8_byte =
+    uint8_t(0xE0 | (tables::unicode_width::first_wide_block_code_point >> 12));
+constexpr uint8_t last_wide_utf8_byte =
+    uint8_t(0xE0 | (tables::unicode_width::last_wide_block_code_point >> 12));
+
+static_assert(first_table_code_point >= 0x80 && first_table_code_point < 0x800,
+              "the UTF-8 fast path assumes a 2-byte threshold");
+static_assert((tables::unicode_width::first_wide_block_code_point & 0xFFF) ==
+                      0 &&
+                  (tables::unicode_width::last_wide_block_code_point &
+                   0xFFF) == 0xFFF,
+              "the wide block must match whole UTF-8 leading bytes");
+
+// Width of the code point starting at data[0], or 1 if the bytes do not start
+// a valid code point. Continuation bytes contribute nothing to the width.
+simdutf_really_inline size_t utf8_char_width(const uint8_t *data,
+                                             size_t remaining) {
+  if ((data[0] & 0xC0) == 0x80) {
+    return 0;
+  }
+  size_t consumed;
+  const uint32_t code_point =
+      utf8::decode_code_point(data, remaining, consumed);
+  if (code_point & utf8::invalid_code_point) {
+    return 1;
+  }
+  return code_point_width(code_point);
+}
+
+inline size_t width_utf8(const char *input, size_t length) {
+  const uint8_t *data = reinterpret_cast<const uint8_t *>(input);
+  size_t width = 0;
+  for (size_t pos = 0; pos < length; pos++) {
+    if (data[pos] < 0x80) {
+      width += (data[pos] >= 0x20 && data[pos] != 0x7F);
+    } else {
+      width += utf8_char_width(data + pos, length - pos);
+    }
+  }
+  return width;
+}
+#endif // SIMDUTF_FEATURE_UTF8
+
+#if SIMDUTF_FEATURE_UTF16
+// Width of the code point starting at data[pos]. Low surrogates contribute
+// nothing to the width and unpaired high surrogates have width 1.
+template <endianness big_endian>
+simdutf_really_inline size_t utf16_char_width(const char16_t *data,
+                                              size_t length, size_t pos) {
+  const uint32_t word = utf16::swap_if_needed<big_endian>(data[pos]);
+  if ((word & 0xF800) != 0xD800) {
+    return code_point_width(word);
+  }
+  if (word >= 0xDC00) {
+    return 0;
+  }
+  const uint32_t low =
+      pos + 1 < length
+          ? uint32_t(utf16::swap_if_needed<big_endian>(data[pos + 1]) - 0xDC00)
+          : 0xFFFFFFFF;
+  if (low > 0x3FF) {
+    return 1;
+  }
+  return code_point_width(((word - 0xD800) << 10) + low + 0x10000);
+}
+
+template <endianness big_endian>
+inline size_t width_utf16(const char16_t *input, size_t length) {
+  size_t width = 0;
+  for (size_t pos = 0; pos < length; pos++) {
+    width += utf16_char_width<big_endian>(input, length, pos);
+  }
+  return width;
+}
+#endif // SIMDUTF_FEATURE_UTF16
+
+} // namespace display_width
+} // unnamed namespace
+} // namespace scalar
+} // namespace simdutf
+
+#endif
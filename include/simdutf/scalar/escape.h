@@ -0,0 +1,93 @@
+#ifndef SIMDUTF_ESCAPE_H
+#define SIMDUTF_ESCAPE_H
+
+namespace simdutf {
+namespace scalar {
+namespace {
+namespace escape {
+
+// An escaped byte takes at most this many bytes ("&quot;" or "&apos;").
+constexpr size_t max_escaped_length = 6;
+
+// Returns true if the ASCII byte must be replaced by an entity.
+simdutf_really_inline bool is_special(uint8_t byte) {
+  return byte == '&' || byte == '<' || byte == '>' || byte == '"' ||
+         byte == '\'';
+}
+
+// XML 1.0 only allows tab, line feed and carriage return among the C0
+// controls. Surrogates cannot appear in valid UTF-8, which leaves U+FFFE and
+// U+FFFF as the only other forbidden characters.
+simdutf_really_inline bool is_xml_forbidden_ascii(uint8_t byte) {
+  return byte < 0x20 && byte != '\t' && byte != '\n' && byte != '\r';
+}
+
+// U+FFFE and U+FFFF are encoded as 0xEF 0xBF 0xBE and 0xEF 0xBF 0xBF.
+simdutf_really_inline bool is_xml_forbidden_sequence(const uint8_t *data,
+                                                     size_t remaining) {
+  return remaining >= 3 && data[0] == 0xEF && data[1] == 0xBF &&
+         (data[2] & 0xFE) == 0xBE;
+}
+
+// Writes the entity of a special byte and returns the end of the output.
+template <bool xml>
+simdutf_really_inline char *write_entity(uint8_t byte, char *out) {
+  const char *entity;
+  size_t length;
+  switch (byte) {
+  case '&':
+    entity = "&amp;";
+    length = 5;
+    break;
+  case '<':
+    entity = "&lt;";
+    length = 4;
+    break;
+  case '>':
+    entity = "&gt;";
+    length = 4;
+    break;
+  case '"':
+    entity = "&quot;";
+    length = 6;
+    break;
+  default: // '\''
+    entity = xml ? "&apos;" : "&#39;";
+    length = xml ? 6 : 5;
+    break;
+  }
+  std::memcpy(out, entity, length);
+  return out + length;
+}
+
+template <bool xml>
+inline result escape_utf8(const char *input, size_t length, char *output) {
+  const uint8_t *data = reinterpret_cast<const uint8_t *>(input);
+  // the input is escaped up to the first UTF-8 error, if any
+  const result validation = utf8::validate_with_errors(data, length);
+  const size_t end = validation.is_ok() ? length : validation.count;
+  char *out = output;
+  for (size_t pos = 0; pos < end; pos++) {
+    const uint8_t byte = data[pos];
+    if (is_special(byte)) {
+      out = write_entity<xml>(byte, out);
+      continue;
+    }
+    if (xml && (is_xml_forbidden_ascii(byte) ||
+                is_xml_forbidden_sequence(data + pos, length - pos))) {
+      return result(error_code::INVALID_XML_CHARACTER, pos);
+    }
+    *out++ = char(byte);
+  }
+  if (validation.is_err()) {
+    return validation;
+  }
+  return result(error_code::SUCCESS, size_t(out - output));
+}
+
+} // namespace escape
+} // unnamed namespace
+} // namespace scalar
+} // namespace simdutf
+
+#endif
@@ -0,0 +1,201 @@
+#ifndef SIMDUTF_GRAPHEME_H
+#define SIMDUTF_GRAPHEME_H
+
+#include "simdutf/unicode_grapheme_tables.h"
+
+namespace simdutf {
+namespace scalar {
+namespace {
+namespace grapheme {
+
+using tables::unicode_grapheme::grapheme_break;
+
+simdutf_really_inline grapheme_break break_property(uint32_t code_point) {
+  using tables::unicode_grapheme::grapheme_ranges;
+  size_t lo = 0;
+  size_t count = sizeof(grapheme_ranges) / sizeof(grapheme_ranges[0]);
+  // find the last range starting at or before code_point
+  while (count > 1) {
+    size_t half = count / 2;
+    if (grapheme_ranges[lo + half].first <= code_point) {
+      lo += half;
+      count -= half;
+    } else {
+      count = half;
+    }
+  }
+  const auto &r = grapheme_ranges[lo];
+  if (code_point < r.first || code_point - r.first >= r.count) {
+    return tables::unicode_grapheme::gb_other;
+  }
+  if (r.property == tables::unicode_grapheme::gb_lvt &&
+      code_point - tables::unicode_grapheme::first_hangul_syllable <
+          tables::unicode_grapheme::hangul_syllable_count &&
+      (code_point - tables::unicode_grapheme::first_hangul_syllable) % 28 ==
+          0) {
+    return tables::unicode_grapheme::gb_lv;
+  }
+  return r.property;
+}
+
+// Code points with these properties never join with their neighbours, except
+// for the CR LF sequence.
+simdutf_really_inline bool is_simple(grapheme_break property) {
+  return property == tables::unicode_grapheme::gb_other ||
+         property == tables::unicode_grapheme::gb_control ||
+         property == tables::unicode_grapheme::gb_cr ||
+         property == tables::unicode_grapheme::gb_lf ||
+         property == tables::unicode_grapheme::gb_extended_pictographic;
+}
+
+// Extended grapheme cluster segmentation (rules GB3 to GB999 of Unicode
+// Standard Annex #29). The segmenter starts at a cluster boundary and is fed
+// the properties of the following code points.
+class segmenter {
+public:
+  explicit segmenter(grapheme_break first) { update(first); }
+
+  // Returns true if there is a cluster boundary before a code point having
+  // the given property.
+  bool is_boundary(grapheme_break next) {
+    const bool boundary = breaks(next);
+    update(next);
+    return boundary;
+  }
+
+private:
+  bool breaks(grapheme_break next) const {
+    using namespace tables::unicode_grapheme;
+    if (previous == gb_cr && next == gb_lf) {
+      return false; // GB3
+    }
+    if (previous == gb_control || previous == gb_cr || previous == gb_lf) {
+      return true; // GB4
+    }
+    if (next == gb_control || next == gb_cr || next == gb_lf) {
+      return true; // GB5
+    }
+    if (previous == gb_l &&
+        (next == gb_l || next == gb_v || next == gb_lv || next == gb_lvt)) {
+      return false; // GB6
+    }
+    if ((previous == gb_lv || previous == gb_v) &&
+        (next == gb_v || next == gb_t)) {
+      return false; // GB7
+    }
+    if ((previous == gb_lvt || previous == gb_t) && next == gb_t) {
+      return false; // GB8
+    }
+    if (next == gb_extend || next == gb_zwj || next == gb_spacing_mark) {
+      return false; // GB9, GB9a
+    }
+    if (previous == gb_prepend) {
+      return false; // GB9b
+    }
+    if (emoji == emoji_state::after_zwj && next == gb_extended_pictographic) {
+      return false; // GB11
+    }
+    if (previous == gb_regional_indicator && next == gb_regional_indicator &&
+        regional_indicators % 2 == 1) {
+      return false; // GB12, GB13
+    }
+    return true; // GB999
+  }
+
+  void update(grapheme_break next) {
+    using namespace tables::unicode_grapheme;
+    if (next == gb_extended_pictographic) {
+      emoji = emoji_state::after_pictographic;
+    } else if (next == gb_zwj && emoji == emoji_state::after_pictographic) {
+      emoji = emoji_state::after_zwj;
+    } else if (next != gb_extend || emoji != emoji_state::after_pictographic) {
+      emoji = emoji_state::none;
+    }
+    regional_indicators =
+        next == gb_regional_indicator ? regional_indicators + 1 : 0;
+    previous = next;
+  }
+
+  // GB11: Extended_Pictographic Extend* ZWJ x Extended_Pictographic
+  enum class emoji_state { none, after_pictographic, after_zwj };
+
+  grapheme_break previous{tables::unicode_grapheme::gb_other};
+  emoji_state emoji{emoji_state::none};
+  // number of consecutive regional indicators ending with 'previous'
+  size_t regional_indicators{0};
+};
+
+// UTF-8 bytes below this value cannot start a code point at or above
+// first_complex_code_point (U+0300 is encoded as 0xCC 0x80).
+constexpr uint8_t first_complex_utf8_byte =
+    uint8_t(0xC0 | (tables::unicode_grapheme::first_complex_code_point >> 6));
+// The code points starting with these leading bytes are all simple.
+constexpr uint8_t first_simple_two_byte_leading_byte = uint8_t(
+    0xC0 |
+    (tables::unicode_grapheme::first_simple_two_byte_code_point >> 6));
+constexpr uint8_t last_simple_two_byte_leading_byte = uint8_t(
+    0xC0 | (tables::unicode_grapheme::last_simple_two_byte_code_point >> 6));
+constexpr uint8_t first_simple_three_byte_leading_byte = uint8_t(
+    0xE0 |
+    (tables::unicode_grapheme::first_simple_three_byte_code_point >> 12));
+constexpr uint8_t last_simple_three_byte_leading_byte = uint8_t(
+    0xE0 |
+    (tables::unicode_grapheme::last_simple_three_byte_code_point >> 12));
+
+static_assert(tables::unicode_grapheme::first_complex_code_point >= 0x80 &&
+                  tables::unicode_grapheme::first_complex_code_point < 0x800,
+              "the UTF-8 fast path assumes a 2-byte threshold");
+static_assert(
+    (tables::unicode_grapheme::first_simple_two_byte_code_point & 0x3F) == 0 &&
+        (tables::unicode_grapheme::last_simple_two_byte_code_point & 0x3F) ==
+            0x3F &&
+        (tables::unicode_grapheme::first_simple_three_byte_code_point &
+         0xFFF) == 0 &&
+        (tables::unicode_grapheme::last_simple_three_byte_code_point &
+         0xFFF) == 0xFFF,
+    "the simple blocks must match whole UTF-8 leading bytes");
+
+// Property of the code point starting at data[0]. A byte that does not start
+// a valid code point is a cluster by itself (as a control character).
+simdutf_really_inline grapheme_break utf8_property(const uint8_t *data,
+                                                   size_t remaining,
+                                                   size_t &consumed) {
+  const uint32_t code_point =
+      utf8::decode_code_point(data, remaining, consumed);
+  if (code_point & utf8::invalid_code_point) {
+    return tables::unicode_grapheme::gb_control;
+  }
+  return break_property(code_point);
+}
+
+// Returns the position of the first cluster boundary after 'pos', which must
+// be a cluster boundary before the end of the input.
+inline size_t next_boundary_utf8(const uint8_t *data, size_t length,
+                                 size_t pos) {
+  size_t consumed;
+  segmenter s(utf8_property(data + pos, length - pos, consumed));
+  pos += consumed;
+  while (pos < length) {
+    if (s.is_boundary(utf8_property(data + pos, length - pos, consumed))) {
+      break;
+    }
+    pos += consumed;
+  }
+  return pos;
+}
+
+inline size_t count_utf8(const char *input, size_t length) {
+  const uint8_t *data = reinterpret_cast<const uint8_t *>(input);
+  size_t count = 0;
+  for (size_t pos = 0; pos < length; count++) {
+    pos = next_boundary_utf8(data, length, pos);
+  }
+  return count;
+}
+
+} // namespace grapheme
+} // unnamed namespace
+} // namespace scalar
+} // namespace simdutf
+
+#endif
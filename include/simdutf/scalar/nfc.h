@@ -0,0 +1,182 @@
+#ifndef SIMDUTF_NFC_H
+#define SIMDUTF_NFC_H
+
+#include "simdutf/unicode_normalization_tables.h"
+
+namespace simdutf {
+namespace scalar {
+namespace {
+namespace nfc {
+
+using tables::unicode_normalization::first_nfc_relevant_code_point;
+
+simdutf_really_inline const tables::unicode_normalization::nfc_range *
+find_range(uint32_t code_point) {
+  using tables::unicode_normalization::nfc_ranges;
+  size_t lo = 0;
+  size_t count = sizeof(nfc_ranges) / sizeof(nfc_ranges[0]);
+  // find the last range starting at or before code_point
+  while (count > 1) {
+    size_t half = count / 2;
+    if (nfc_ranges[lo + half].first <= code_point) {
+      lo += half;
+      count -= half;
+    } else {
+      count = half;
+    }
+  }
+  const auto &r = nfc_ranges[lo];
+  if (code_point >= r.first && code_point - r.first < r.count) {
+    return &r;
+  }
+  return nullptr;
+}
+
+// Implements one step of the NFC_Quick_Check algorithm from UAX #15. Returns
+// false if the string is known not to be in NFC.
+simdutf_really_inline bool check_code_point(uint32_t code_point,
+                                            uint8_t &last_ccc,
+                                            nfc_quick_check_result &result) {
+  if (code_point < first_nfc_relevant_code_point) {
+    last_ccc = 0;
+    return true;
+  }
+  const auto *r = find_range(code_point);
+  if (r == nullptr) {
+    last_ccc = 0;
+    return true;
+  }
+  if (r->ccc != 0 && last_ccc > r->ccc) {
+    return false;
+  }
+  if (r->quick_check == tables::unicode_normalization::qc_no) {
+    return false;
+  }
+  if (r->quick_check == tables::unicode_normalization::qc_maybe) {
+    result = nfc_quick_check_maybe;
+  }
+  last_ccc = r->ccc;
+  return true;
+}
+
+#if SIMDUTF_FEATURE_UTF8
+// UTF-8 bytes below this value cannot start a code point at or above
+// first_nfc_relevant_code_point (U+0300 is encoded as 0xCC 0x80).
+constexpr uint8_t first_nfc_relevant_utf8_byte =
+    uint8_t(0xC0 | (first_nfc_relevant_code_point >> 6));
+
+static_assert(first_nfc_relevant_code_point >= 0x80 &&
+                  first_nfc_relevant_code_point < 0x800,
+              "the UTF-8 fast path assumes a 2-byte threshold");
+
+// Checks the code points starting at 'pos', which must be the start of a
+// code point following a code point below first_nfc_relevant_code_point (or
+// the start of the string). Stops after the first code point below
+// first_nfc_relevant_code_point and returns the position following it.
+// Returns 'length' at the end of the input; sets 'result' to
+// nfc_quick_check_no and returns 'length' if the string is not in NFC or if
+// it is not valid UTF-8.
+inline size_t check_run_utf8(const uint8_t *data, size_t length, size_t pos,
+                             nfc_quick_check_result &result) {
+  uint8_t last_ccc = 0;
+  while (pos < length) {
+    size_t consumed;
+    const uint32_t code_point =
+        utf8::decode_code_point(data + pos, length - pos, consumed);
+    if ((code_point & utf8::invalid_code_point) ||
+        !check_code_point(code_point, last_ccc, result)) {
+      result = nfc_quick_check_no;
+      return length;
+    }
+    pos += consumed;
+    if (code_point < first_nfc_relevant_code_point) {
+      break;
+    }
+  }
+  return pos;
+}
+
+inline nfc_quick_check_result quick_check_utf8(const char *input,
+                                               size_t length) {
+  if (!utf8::validate(input, length)) {
+    return nfc_quick_check_no;
+  }
+  const uint8_t *data = reinterpret_cast<const uint8_t *>(input);
+  nfc_quick_check_result result = nfc_quick_check_yes;
+  size_t pos = 0;
+  while (pos < length) {
+    if (data[pos] < first_nfc_relevant_utf8_byte) {
+      pos++;
+      continue;
+    }
+    pos = check_run_utf8(data, length, pos, result);
+    if (result == nfc_quick_check_no) {
+      return result;
+    }
+  }
+  return result;
+}
+#endif // SIMDUTF_FEATURE_UTF8
+
+#if SIMDUTF_FEATURE_UTF16
+// UTF-16 counterpart of check_run_utf8: unpaired surrogates make the result
+// nfc_quick_check_no.
+template <endianness big_endian>
+inline size_t check_run_utf16(const char16_t *data, size_t length, size_t pos,
+                              nfc_quick_check_result &result) {
+  uint8_t last_ccc = 0;
+  while (pos < length) {
+    uint32_t code_point = utf16::swap_if_needed<big_endian>(data[pos]);
+    size_t consumed = 1;
+    if ((code_point & 0xF800) == 0xD800) {
+      const uint32_t high = code_point - 0xD800;
+      const uint32_t low =
+          pos + 1 < length
+              ? uint32_t(utf16::swap_if_needed<big_endian>(data[pos + 1]) -
+                         0xDC00)
+              : 0xFFFFFFFF;
+      if (high > 0x3FF || low > 0x3FF) {
+        result = nfc_quick_check_no;
+        return length;
+      }
+      code_point = (high << 10) + low + 0x10000;
+      consumed = 2;
+    }
+    if (!check_code_point(code_point, last_ccc, result)) {
+      result = nfc_quick_check_no;
+      return length;
+    }
+    pos += consumed;
+    if (code_point < first_nfc_relevant_code_point) {
+      break;
+    }
+  }
+  return pos;
+}
+
+template <endianness big_endian>
+inline nfc_quick_check_result quick_check_utf16(const char16_t *input,
+                                                size_t length) {
+  nfc_quick_check_result result = nfc_quick_check_yes;
+  size_t pos = 0;
+  while (pos < length) {
+    if (utf16::swap_if_needed<big_endian>(input[pos]) <
+        first_nfc_relevant_code_point) {
+      pos++;
+      continue;
+    }
+    pos = check_run_utf16<big_endian>(input, length, pos, result);
+    if (result == nfc_quick_check_no) {
+      return result;
+    }
+  }
+  return result;
+}
+#endif // SIMDUTF_FEATURE_UTF16
+
+} // namespace nfc
+} // unnamed namespace
+} // namespace scalar
+} // namespace simdutf
+
+#endif
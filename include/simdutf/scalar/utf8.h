@@ -321,6 +321,55 @@ trim_partial_utf8(InputPtr input, size_t length) {
   return length;
 }
 
+// Bit set in the values returned by decode_code_point for bytes that do not
+// start a valid UTF-8 sequence; the low byte then holds the byte itself.
+constexpr uint32_t invalid_code_point = 0x80000000;
+
+// Decodes the code point starting at data[0], reading at most 'remaining'
+// bytes, and sets 'length' to the number of bytes used. Overlong sequences,
+// surrogates and truncated sequences are reported as a single invalid byte.
+simdutf_really_inline uint32_t decode_code_point(const uint8_t *data,
+                                                 size_t remaining,
+                                                 size_t &length) {
+  const uint8_t leading_byte = data[0];
+  length = 1;
+  if (leading_byte < 0x80) {
+    return leading_byte;
+  }
+  if ((leading_byte & 0b11100000) == 0b11000000) {
+    if (remaining >= 2 && (data[1] & 0b11000000) == 0b10000000) {
+      uint32_t cp = (leading_byte & 0b00011111) << 6 | (data[1] & 0b00111111);
+      if (cp >= 0x80) {
+        length = 2;
+        return cp;
+      }
+    }
+  } else if ((leading_byte & 0b11110000) == 0b11100000) {
+    if (remaining >= 3 && (data[1] & 0b11000000) == 0b10000000 &&
+        (data[2] & 0b11000000) == 0b10000000) {
+      uint32_t cp = (leading_byte & 0b00001111) << 12 |
+                    (data[1] & 0b00111111) << 6 | (data[2] & 0b00111111);
+      if (cp >= 0x800 && (cp < 0xd800 || cp > 0xdfff)) {
+        length = 3;
+        return cp;
+      }
+    }
+  } else if ((leading_byte & 0b11111000) == 0b11110000) {
+    if (remaining >= 4 && (data[1] & 0b11000000) == 0b10000000 &&
+        (data[2] & 0b11000000) == 0b10000000 &&
+        (data[3] & 0b11000000) == 0b10000000) {
+      uint32_t cp = (leading_byte & 0b00000111) << 18 |
+                    (data[1] & 0b00111111) << 12 |
+                    (data[2] & 0b00111111) << 6 | (data[3] & 0b00111111);
+      if (cp >= 0x10000 && cp <= 0x10ffff) {
+        length = 4;
+        return cp;
+      }
+    }
+  }
+  return invalid_code_point | leading_byte;
+}
+
 } // namespace utf8
 } // unnamed namespace
 } // namespace scalar
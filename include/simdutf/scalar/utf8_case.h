@@ -0,0 +1,194 @@
+#ifndef SIMDUTF_UTF8_CASE_H
+#define SIMDUTF_UTF8_CASE_H
+
+#include <cstring>
+
+#include "simdutf/unicode_case_tables.h"
+
+namespace simdutf {
+namespace scalar {
+namespace {
+namespace utf8_case {
+
+enum class case_mapping { lower, upper, fold };
+
+template <case_mapping mapping>
+simdutf_really_inline uint32_t map_code_point(uint32_t code_point) {
+  using namespace tables::unicode_case;
+  const uint16_t *latin1 = mapping == case_mapping::lower   ? latin1_lower
+                           : mapping == case_mapping::upper ? latin1_upper
+                                                            : latin1_fold;
+  if (code_point < 256) {
+    return latin1[code_point];
+  }
+  const case_range *ranges = mapping == case_mapping::lower   ? lower_ranges
+                             : mapping == case_mapping::upper ? upper_ranges
+                                                              : fold_ranges;
+  size_t count = mapping == case_mapping::lower
+                     ? sizeof(lower_ranges) / sizeof(lower_ranges[0])
+                 : mapping == case_mapping::upper
+                     ? sizeof(upper_ranges) / sizeof(upper_ranges[0])
+                     : sizeof(fold_ranges) / sizeof(fold_ranges[0]);
+  if (code_point < ranges[0].first) {
+    return code_point;
+  }
+  // find the last range starting at or before code_point
+  size_t lo = 0;
+  while (count > 1) {
+    size_t half = count / 2;
+    if (ranges[lo + half].first <= code_point) {
+      lo += half;
+      count -= half;
+    } else {
+      count = half;
+    }
+  }
+  const case_range &r = ranges[lo];
+  uint32_t offset = code_point - r.first;
+  if (offset % r.stride == 0 && offset / r.stride < r.count) {
+    return uint32_t(int32_t(code_point) + r.delta);
+  }
+  return code_point;
+}
+
+simdutf_really_inline size_t encode(uint32_t code_point, uint8_t *out) {
+  if ((code_point & utf8::invalid_code_point) || code_point < 0x80) {
+    out[0] = uint8_t(code_point);
+    return 1;
+  }
+  if (code_point < 0x800) {
+    out[0] = uint8_t((code_point >> 6) | 0b11000000);
+    out[1] = uint8_t((code_point & 0b111111) | 0b10000000);
+    return 2;
+  }
+  if (code_point < 0x10000) {
+    out[0] = uint8_t((code_point >> 12) | 0b11100000);
+    out[1] = uint8_t(((code_point >> 6) & 0b111111) | 0b10000000);
+    out[2] = uint8_t((code_point & 0b111111) | 0b10000000);
+    return 3;
+  }
+  out[0] = uint8_t((code_point >> 18) | 0b11110000);
+  out[1] = uint8_t(((code_point >> 12) & 0b111111) | 0b10000000);
+  out[2] = uint8_t(((code_point >> 6) & 0b111111) | 0b10000000);
+  out[3] = uint8_t((code_point & 0b111111) | 0b10000000);
+  return 4;
+}
+
+// Maps the ASCII letters of eight ASCII bytes at once (SWAR). The input must
+// be ASCII: no carry can then cross a byte boundary.
+template <case_mapping mapping>
+simdutf_really_inline uint64_t map_ascii_word(uint64_t word) {
+  constexpr uint64_t ones = 0x0101010101010101;
+  constexpr uint8_t first = mapping == case_mapping::upper ? 'a' : 'A';
+  constexpr uint8_t last = mapping == case_mapping::upper ? 'z' : 'Z';
+  const uint64_t ge_first = word + ones * (0x80 - first);
+  const uint64_t gt_last = word + ones * (0x80 - last - 1);
+  const uint64_t letters = ge_first & ~gt_last & (ones * 0x80);
+  return word ^ (letters >> 2);
+}
+
+// Maps one code point (or invalid byte) and returns the number of bytes
+// written; 'consumed' receives the number of input bytes.
+template <case_mapping mapping>
+simdutf_really_inline size_t map_one(const uint8_t *data, size_t remaining,
+                                     uint8_t *out, size_t &consumed) {
+  uint32_t cp = utf8::decode_code_point(data, remaining, consumed);
+  if (cp & utf8::invalid_code_point) {
+    out[0] = data[0];
+    return 1;
+  }
+  return encode(map_code_point<mapping>(cp), out);
+}
+
+template <case_mapping mapping>
+size_t map(const char *input, size_t length, char *output) {
+  const uint8_t *data = reinterpret_cast<const uint8_t *>(input);
+  uint8_t *out = reinterpret_cast<uint8_t *>(output);
+  size_t pos = 0;
+  while (pos < length) {
+    if (pos + 8 <= length) {
+      uint64_t word;
+      std::memcpy(&word, data + pos, sizeof(word));
+      if ((word & 0x8080808080808080) == 0) {
+        word = map_ascii_word<mapping>(word);
+        std::memcpy(out, &word, sizeof(word));
+        pos += 8;
+        out += 8;
+        continue;
+      }
+    }
+    size_t consumed;
+    out += map_one<mapping>(data + pos, length - pos, out, consumed);
+    pos += consumed;
+  }
+  return size_t(out - reinterpret_cast<uint8_t *>(output));
+}
+
+inline size_t to_lower(const char *input, size_t length, char *output) {
+  return map<case_mapping::lower>(input, length, output);
+}
+
+inline size_t to_upper(const char *input, size_t length, char *output) {
+  return map<case_mapping::upper>(input, length, output);
+}
+
+// Compares the strings code point by code point under simple case folding,
+// starting at positions a_pos and b_pos. The comparison stops once a_pos
+// reaches a_stop (or either string ends) and the positions are updated.
+// Returns false as soon as a difference is found.
+inline bool equals_ignore_case_until(const uint8_t *a, size_t a_length,
+                                     size_t &a_pos, size_t a_stop,
+                                     const uint8_t *b, size_t b_length,
+                                     size_t &b_pos) {
+  while (a_pos < a_stop && a_pos < a_length && b_pos < b_length) {
+    if (a_pos + 8 <= a_length && b_pos + 8 <= b_length) {
+      uint64_t wa, wb;
+      std::memcpy(&wa, a + a_pos, sizeof(wa));
+      std::memcpy(&wb, b + b_pos, sizeof(wb));
+      if (((wa | wb) & 0x8080808080808080) == 0) {
+        if (map_ascii_word<case_mapping::fold>(wa) !=
+            map_ascii_word<case_mapping::fold>(wb)) {
+          return false;
+        }
+        a_pos += 8;
+        b_pos += 8;
+        continue;
+      }
+    }
+    size_t a_len, b_len;
+    uint32_t ca = utf8::decode_code_point(a + a_pos, a_length - a_pos, a_len);
+    uint32_t cb = utf8::decode_code_point(b + b_pos, b_length - b_pos, b_len);
+    if (!(ca & utf8::invalid_code_point)) {
+      ca = map_code_point<case_mapping::fold>(ca);
+    }
+    if (!(cb & utf8::invalid_code_point)) {
+      cb = map_code_point<case_mapping::fold>(cb);
+    }
+    if (ca != cb) {
+      return false;
+    }
+    a_pos += a_len;
+    b_pos += b_len;
+  }
+  return true;
+}
+
+inline bool equals_ignore_case(const char *a, size_t a_length, const char *b,
+                               size_t b_length) {
+  size_t a_pos = 0;
+  size_t b_pos = 0;
+  if (!equals_ignore_case_until(reinterpret_cast<const uint8_t *>(a),
+                                a_length, a_pos, a_length,
+                                reinterpret_cast<const uint8_t *>(b),
+                                b_length, b_pos)) {
+    return false;
+  }
+  return a_pos == a_length && b_pos == b_length;
+}
+
+} // namespace utf8_case
+} // unnamed namespace
+} // namespace scalar
+} // namespace simdutf
+
+#endif
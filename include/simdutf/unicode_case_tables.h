@@ -0,0 +1,271 @@
+#ifndef SIMDUTF_UNICODE_CASE_TABLES_H
+#define SIMDUTF_UNICODE_CASE_TABLES_H
+#include <cstdint>
+
+// This file is generated by scripts/unicode_tables.py, do not edit.
+// Simple (1:1) case mappings from UnicodeData.txt and CaseFolding.txt.
+
+namespace simdutf {
+namespace {
+namespace tables {
+namespace unicode_case {
+
+// Code points first, first + stride, ..., first + (count - 1) * stride
+// map to the code point plus delta.
+struct case_range {
+  uint32_t first;
+  uint16_t count;
+  uint16_t stride;
+  int32_t delta;
+};
+
+// lower mapping for U+0000..U+00FF
+constexpr uint16_t latin1_lower[256] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20,
+    21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39,
+    40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58,
+    59, 60, 61, 62, 63, 64, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107,
+    108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122,
+    91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107,
+    108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122,
+    123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137,
+    138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152,
+    153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167,
+    168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182,
+    183, 184, 185, 186, 187, 188, 189, 190, 191, 224, 225, 226, 227, 228, 229,
+    230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244,
+    245, 246, 215, 248, 249, 250, 251, 252, 253, 254, 223, 224, 225, 226, 227,
+    228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242,
+    243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255};
+
+// lower mapping for U+0100 and above, sorted by first
+constexpr case_range lower_ranges[179] = {
+    {0x100, 24, 2, 1}, {0x130, 1, 1, -199}, {0x132, 3, 2, 1}, {0x139, 8, 2, 1},
+    {0x14a, 23, 2, 1}, {0x178, 1, 1, -121}, {0x179, 3, 2, 1},
+    {0x181, 1, 1, 210}, {0x182, 2, 2, 1}, {0x186, 1, 1, 206}, {0x187, 1, 1, 1},
+    {0x189, 2, 1, 205}, {0x18b, 1, 1, 1}, {0x18e, 1, 1, 79}, {0x18f, 1, 1, 202},
+    {0x190, 1, 1, 203}, {0x191, 1, 1, 1}, {0x193, 1, 1, 205},
+    {0x194, 1, 1, 207}, {0x196, 1, 1, 211}, {0x197, 1, 1, 209},
+    {0x198, 1, 1, 1}, {0x19c, 1, 1, 211}, {0x19d, 1, 1, 213},
+    {0x19f, 1, 1, 214}, {0x1a0, 3, 2, 1}, {0x1a6, 1, 1, 218}, {0x1a7, 1, 1, 1},
+    {0x1a9, 1, 1, 218}, {0x1ac, 1, 1, 1}, {0x1ae, 1, 1, 218}, {0x1af, 1, 1, 1},
+    {0x1b1, 2, 1, 217}, {0x1b3, 2, 2, 1}, {0x1b7, 1, 1, 219}, {0x1b8, 1, 1, 1},
+    {0x1bc, 1, 1, 1}, {0x1c4, 1, 1, 2}, {0x1c5, 1, 1, 1}, {0x1c7, 1, 1, 2},
+    {0x1c8, 1, 1, 1}, {0x1ca, 1, 1, 2}, {0x1cb, 9, 2, 1}, {0x1de, 9, 2, 1},
+    {0x1f1, 1, 1, 2}, {0x1f2, 2, 2, 1}, {0x1f6, 1, 1, -97}, {0x1f7, 1, 1, -56},
+    {0x1f8, 20, 2, 1}, {0x220, 1, 1, -130}, {0x222, 9, 2, 1},
+    {0x23a, 1, 1, 10795}, {0x23b, 1, 1, 1}, {0x23d, 1, 1, -163},
+    {0x23e, 1, 1, 10792}, {0x241, 1, 1, 1}, {0x243, 1, 1, -195},
+    {0x244, 1, 1, 69}, {0x245, 1, 1, 71}, {0x246, 5, 2, 1}, {0x370, 2, 2, 1},
+    {0x376, 1, 1, 1}, {0x37f, 1, 1, 116}, {0x386, 1, 1, 38}, {0x388, 3, 1, 37},
+    {0x38c, 1, 1, 64}, {0x38e, 2, 1, 63}, {0x391, 17, 1, 32}, {0x3a3, 9, 1, 32},
+    {0x3cf, 1, 1, 8}, {0x3d8, 12, 2, 1}, {0x3f4, 1, 1, -60}, {0x3f7, 1, 1, 1},
+    {0x3f9, 1, 1, -7}, {0x3fa, 1, 1, 1}, {0x3fd, 3, 1, -130},
+    {0x400, 16, 1, 80}, {0x410, 32, 1, 32}, {0x460, 17, 2, 1},
+    {0x48a, 27, 2, 1}, {0x4c0, 1, 1, 15}, {0x4c1, 7, 2, 1}, {0x4d0, 48, 2, 1},
+    {0x531, 38, 1, 48}, {0x10a0, 38, 1, 7264}, {0x10c7, 1, 1, 7264},
+    {0x10cd, 1, 1, 7264}, {0x13a0, 80, 1, 38864}, {0x13f0, 6, 1, 8},
+    {0x1c90, 43, 1, -3008}, {0x1cbd, 3, 1, -3008}, {0x1e00, 75, 2, 1},
+    {0x1e9e, 1, 1, -7615}, {0x1ea0, 48, 2, 1}, {0x1f08, 8, 1, -8},
+    {0x1f18, 6, 1, -8}, {0x1f28, 8, 1, -8}, {0x1f38, 8, 1, -8},
+    {0x1f48, 6, 1, -8}, {0x1f59, 4, 2, -8}, {0x1f68, 8, 1, -8},
+    {0x1f88, 8, 1, -8}, {0x1f98, 8, 1, -8}, {0x1fa8, 8, 1, -8},
+    {0x1fb8, 2, 1, -8}, {0x1fba, 2, 1, -74}, {0x1fbc, 1, 1, -9},
+    {0x1fc8, 4, 1, -86}, {0x1fcc, 1, 1, -9}, {0x1fd8, 2, 1, -8},
+    {0x1fda, 2, 1, -100}, {0x1fe8, 2, 1, -8}, {0x1fea, 2, 1, -112},
+    {0x1fec, 1, 1, -7}, {0x1ff8, 2, 1, -128}, {0x1ffa, 2, 1, -126},
+    {0x1ffc, 1, 1, -9}, {0x2126, 1, 1, -7517}, {0x212a, 1, 1, -8383},
+    {0x212b, 1, 1, -8262}, {0x2132, 1, 1, 28}, {0x2160, 16, 1, 16},
+    {0x2183, 1, 1, 1}, {0x24b6, 26, 1, 26}, {0x2c00, 48, 1, 48},
+    {0x2c60, 1, 1, 1}, {0x2c62, 1, 1, -10743}, {0x2c63, 1, 1, -3814},
+    {0x2c64, 1, 1, -10727}, {0x2c67, 3, 2, 1}, {0x2c6d, 1, 1, -10780},
+    {0x2c6e, 1, 1, -10749}, {0x2c6f, 1, 1, -10783}, {0x2c70, 1, 1, -10782},
+    {0x2c72, 1, 1, 1}, {0x2c75, 1, 1, 1}, {0x2c7e, 2, 1, -10815},
+    {0x2c80, 50, 2, 1}, {0x2ceb, 2, 2, 1}, {0x2cf2, 1, 1, 1},
+    {0xa640, 23, 2, 1}, {0xa680, 14, 2, 1}, {0xa722, 7, 2, 1},
+    {0xa732, 31, 2, 1}, {0xa779, 2, 2, 1}, {0xa77d, 1, 1, -35332},
+    {0xa77e, 5, 2, 1}, {0xa78b, 1, 1, 1}, {0xa78d, 1, 1, -42280},
+    {0xa790, 2, 2, 1}, {0xa796, 10, 2, 1}, {0xa7aa, 1, 1, -42308},
+    {0xa7ab, 1, 1, -42319}, {0xa7ac, 1, 1, -42315}, {0xa7ad, 1, 1, -42305},
+    {0xa7ae, 1, 1, -42308}, {0xa7b0, 1, 1, -42258}, {0xa7b1, 1, 1, -42282},
+    {0xa7b2, 1, 1, -42261}, {0xa7b3, 1, 1, 928}, {0xa7b4, 8, 2, 1},
+    {0xa7c4, 1, 1, -48}, {0xa7c5, 1, 1, -42307}, {0xa7c6, 1, 1, -35384},
+    {0xa7c7, 2, 2, 1}, {0xa7d0, 1, 1, 1}, {0xa7d6, 2, 2, 1}, {0xa7f5, 1, 1, 1},
+    {0xff21, 26, 1, 32}, {0x10400, 40, 1, 40}, {0x104b0, 36, 1, 40},
+    {0x10570, 11, 1, 39}, {0x1057c, 15, 1, 39}, {0x1058c, 7, 1, 39},
+    {0x10594, 2, 1, 39}, {0x10c80, 51, 1, 64}, {0x118a0, 32, 1, 32},
+    {0x16e40, 32, 1, 32}, {0x1e900, 34, 1, 34}};
+
+// upper mapping for U+0000..U+00FF
+constexpr uint16_t latin1_upper[256] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20,
+    21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39,
+    40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58,
+    59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77,
+    78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96,
+    65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83,
+    84, 85, 86, 87, 88, 89, 90, 123, 124, 125, 126, 127, 128, 129, 130, 131,
+    132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146,
+    147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161,
+    162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176,
+    177, 178, 179, 180, 924, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+    192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206,
+    207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221,
+    222, 223, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204,
+    205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 247, 216, 217, 218, 219,
+    220, 221, 222, 376};
+
+// upper mapping for U+0100 and above, sorted by first
+constexpr case_range upper_ranges[195] = {
+    {0x101, 24, 2, -1}, {0x131, 1, 1, -232}, {0x133, 3, 2, -1},
+    {0x13a, 8, 2, -1}, {0x14b, 23, 2, -1}, {0x17a, 3, 2, -1},
+    {0x17f, 1, 1, -300}, {0x180, 1, 1, 195}, {0x183, 2, 2, -1},
+    {0x188, 1, 1, -1}, {0x18c, 1, 1, -1}, {0x192, 1, 1, -1}, {0x195, 1, 1, 97},
+    {0x199, 1, 1, -1}, {0x19a, 1, 1, 163}, {0x19e, 1, 1, 130},
+    {0x1a1, 3, 2, -1}, {0x1a8, 1, 1, -1}, {0x1ad, 1, 1, -1}, {0x1b0, 1, 1, -1},
+    {0x1b4, 2, 2, -1}, {0x1b9, 1, 1, -1}, {0x1bd, 1, 1, -1}, {0x1bf, 1, 1, 56},
+    {0x1c5, 1, 1, -1}, {0x1c6, 1, 1, -2}, {0x1c8, 1, 1, -1}, {0x1c9, 1, 1, -2},
+    {0x1cb, 1, 1, -1}, {0x1cc, 1, 1, -2}, {0x1ce, 8, 2, -1}, {0x1dd, 1, 1, -79},
+    {0x1df, 9, 2, -1}, {0x1f2, 1, 1, -1}, {0x1f3, 1, 1, -2}, {0x1f5, 1, 1, -1},
+    {0x1f9, 20, 2, -1}, {0x223, 9, 2, -1}, {0x23c, 1, 1, -1},
+    {0x23f, 2, 1, 10815}, {0x242, 1, 1, -1}, {0x247, 5, 2, -1},
+    {0x250, 1, 1, 10783}, {0x251, 1, 1, 10780}, {0x252, 1, 1, 10782},
+    {0x253, 1, 1, -210}, {0x254, 1, 1, -206}, {0x256, 2, 1, -205},
+    {0x259, 1, 1, -202}, {0x25b, 1, 1, -203}, {0x25c, 1, 1, 42319},
+    {0x260, 1, 1, -205}, {0x261, 1, 1, 42315}, {0x263, 1, 1, -207},
+    {0x265, 1, 1, 42280}, {0x266, 1, 1, 42308}, {0x268, 1, 1, -209},
+    {0x269, 1, 1, -211}, {0x26a, 1, 1, 42308}, {0x26b, 1, 1, 10743},
+    {0x26c, 1, 1, 42305}, {0x26f, 1, 1, -211}, {0x271, 1, 1, 10749},
+    {0x272, 1, 1, -213}, {0x275, 1, 1, -214}, {0x27d, 1, 1, 10727},
+    {0x280, 1, 1, -218}, {0x282, 1, 1, 42307}, {0x283, 1, 1, -218},
+    {0x287, 1, 1, 42282}, {0x288, 1, 1, -218}, {0x289, 1, 1, -69},
+    {0x28a, 2, 1, -217}, {0x28c, 1, 1, -71}, {0x292, 1, 1, -219},
+    {0x29d, 1, 1, 42261}, {0x29e, 1, 1, 42258}, {0x345, 1, 1, 84},
+    {0x371, 2, 2, -1}, {0x377, 1, 1, -1}, {0x37b, 3, 1, 130},
+    {0x3ac, 1, 1, -38}, {0x3ad, 3, 1, -37}, {0x3b1, 17, 1, -32},
+    {0x3c2, 1, 1, -31}, {0x3c3, 9, 1, -32}, {0x3cc, 1, 1, -64},
+    {0x3cd, 2, 1, -63}, {0x3d0, 1, 1, -62}, {0x3d1, 1, 1, -57},
+    {0x3d5, 1, 1, -47}, {0x3d6, 1, 1, -54}, {0x3d7, 1, 1, -8},
+    {0x3d9, 12, 2, -1}, {0x3f0, 1, 1, -86}, {0x3f1, 1, 1, -80},
+    {0x3f2, 1, 1, 7}, {0x3f3, 1, 1, -116}, {0x3f5, 1, 1, -96},
+    {0x3f8, 1, 1, -1}, {0x3fb, 1, 1, -1}, {0x430, 32, 1, -32},
+    {0x450, 16, 1, -80}, {0x461, 17, 2, -1}, {0x48b, 27, 2, -1},
+    {0x4c2, 7, 2, -1}, {0x4cf, 1, 1, -15}, {0x4d1, 48, 2, -1},
+    {0x561, 38, 1, -48}, {0x10d0, 43, 1, 3008}, {0x10fd, 3, 1, 3008},
+    {0x13f8, 6, 1, -8}, {0x1c80, 1, 1, -6254}, {0x1c81, 1, 1, -6253},
+    {0x1c82, 1, 1, -6244}, {0x1c83, 2, 1, -6242}, {0x1c85, 1, 1, -6243},
+    {0x1c86, 1, 1, -6236}, {0x1c87, 1, 1, -6181}, {0x1c88, 1, 1, 35266},
+    {0x1d79, 1, 1, 35332}, {0x1d7d, 1, 1, 3814}, {0x1d8e, 1, 1, 35384},
+    {0x1e01, 75, 2, -1}, {0x1e9b, 1, 1, -59}, {0x1ea1, 48, 2, -1},
+    {0x1f00, 8, 1, 8}, {0x1f10, 6, 1, 8}, {0x1f20, 8, 1, 8}, {0x1f30, 8, 1, 8},
+    {0x1f40, 6, 1, 8}, {0x1f51, 4, 2, 8}, {0x1f60, 8, 1, 8}, {0x1f70, 2, 1, 74},
+    {0x1f72, 4, 1, 86}, {0x1f76, 2, 1, 100}, {0x1f78, 2, 1, 128},
+    {0x1f7a, 2, 1, 112}, {0x1f7c, 2, 1, 126}, {0x1f80, 8, 1, 8},
+    {0x1f90, 8, 1, 8}, {0x1fa0, 8, 1, 8}, {0x1fb0, 2, 1, 8}, {0x1fb3, 1, 1, 9},
+    {0x1fbe, 1, 1, -7205}, {0x1fc3, 1, 1, 9}, {0x1fd0, 2, 1, 8},
+    {0x1fe0, 2, 1, 8}, {0x1fe5, 1, 1, 7}, {0x1ff3, 1, 1, 9},
+    {0x214e, 1, 1, -28}, {0x2170, 16, 1, -16}, {0x2184, 1, 1, -1},
+    {0x24d0, 26, 1, -26}, {0x2c30, 48, 1, -48}, {0x2c61, 1, 1, -1},
+    {0x2c65, 1, 1, -10795}, {0x2c66, 1, 1, -10792}, {0x2c68, 3, 2, -1},
+    {0x2c73, 1, 1, -1}, {0x2c76, 1, 1, -1}, {0x2c81, 50, 2, -1},
+    {0x2cec, 2, 2, -1}, {0x2cf3, 1, 1, -1}, {0x2d00, 38, 1, -7264},
+    {0x2d27, 1, 1, -7264}, {0x2d2d, 1, 1, -7264}, {0xa641, 23, 2, -1},
+    {0xa681, 14, 2, -1}, {0xa723, 7, 2, -1}, {0xa733, 31, 2, -1},
+    {0xa77a, 2, 2, -1}, {0xa77f, 5, 2, -1}, {0xa78c, 1, 1, -1},
+    {0xa791, 2, 2, -1}, {0xa794, 1, 1, 48}, {0xa797, 10, 2, -1},
+    {0xa7b5, 8, 2, -1}, {0xa7c8, 2, 2, -1}, {0xa7d1, 1, 1, -1},
+    {0xa7d7, 2, 2, -1}, {0xa7f6, 1, 1, -1}, {0xab53, 1, 1, -928},
+    {0xab70, 80, 1, -38864}, {0xff41, 26, 1, -32}, {0x10428, 40, 1, -40},
+    {0x104d8, 36, 1, -40}, {0x10597, 11, 1, -39}, {0x105a3, 15, 1, -39},
+    {0x105b3, 7, 1, -39}, {0x105bb, 2, 1, -39}, {0x10cc0, 51, 1, -64},
+    {0x118c0, 32, 1, -32}, {0x16e60, 32, 1, -32}, {0x1e922, 34, 1, -34}};
+
+// fold mapping for U+0000..U+00FF
+constexpr uint16_t latin1_fold[256] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20,
+    21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39,
+    40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58,
+    59, 60, 61, 62, 63, 64, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107,
+    108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122,
+    91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107,
+    108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122,
+    123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137,
+    138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152,
+    153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167,
+    168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 956, 182,
+    183, 184, 185, 186, 187, 188, 189, 190, 191, 224, 225, 226, 227, 228, 229,
+    230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244,
+    245, 246, 215, 248, 249, 250, 251, 252, 253, 254, 223, 224, 225, 226, 227,
+    228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242,
+    243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255};
+
+// fold mapping for U+0100 and above, sorted by first
+constexpr case_range fold_ranges[198] = {
+    {0x100, 24, 2, 1}, {0x132, 3, 2, 1}, {0x139, 8, 2, 1}, {0x14a, 23, 2, 1},
+    {0x178, 1, 1, -121}, {0x179, 3, 2, 1}, {0x17f, 1, 1, -268},
+    {0x181, 1, 1, 210}, {0x182, 2, 2, 1}, {0x186, 1, 1, 206}, {0x187, 1, 1, 1},
+    {0x189, 2, 1, 205}, {0x18b, 1, 1, 1}, {0x18e, 1, 1, 79}, {0x18f, 1, 1, 202},
+    {0x190, 1, 1, 203}, {0x191, 1, 1, 1}, {0x193, 1, 1, 205},
+    {0x194, 1, 1, 207}, {0x196, 1, 1, 211}, {0x197, 1, 1, 209},
+    {0x198, 1, 1, 1}, {0x19c, 1, 1, 211}, {0x19d, 1, 1, 213},
+    {0x19f, 1, 1, 214}, {0x1a0, 3, 2, 1}, {0x1a6, 1, 1, 218}, {0x1a7, 1, 1, 1},
+    {0x1a9, 1, 1, 218}, {0x1ac, 1, 1, 1}, {0x1ae, 1, 1, 218}, {0x1af, 1, 1, 1},
+    {0x1b1, 2, 1, 217}, {0x1b3, 2, 2, 1}, {0x1b7, 1, 1, 219}, {0x1b8, 1, 1, 1},
+    {0x1bc, 1, 1, 1}, {0x1c4, 1, 1, 2}, {0x1c5, 1, 1, 1}, {0x1c7, 1, 1, 2},
+    {0x1c8, 1, 1, 1}, {0x1ca, 1, 1, 2}, {0x1cb, 9, 2, 1}, {0x1de, 9, 2, 1},
+    {0x1f1, 1, 1, 2}, {0x1f2, 2, 2, 1}, {0x1f6, 1, 1, -97}, {0x1f7, 1, 1, -56},
+    {0x1f8, 20, 2, 1}, {0x220, 1, 1, -130}, {0x222, 9, 2, 1},
+    {0x23a, 1, 1, 10795}, {0x23b, 1, 1, 1}, {0x23d, 1, 1, -163},
+    {0x23e, 1, 1, 10792}, {0x241, 1, 1, 1}, {0x243, 1, 1, -195},
+    {0x244, 1, 1, 69}, {0x245, 1, 1, 71}, {0x246, 5, 2, 1}, {0x345, 1, 1, 116},
+    {0x370, 2, 2, 1}, {0x376, 1, 1, 1}, {0x37f, 1, 1, 116}, {0x386, 1, 1, 38},
+    {0x388, 3, 1, 37}, {0x38c, 1, 1, 64}, {0x38e, 2, 1, 63}, {0x391, 17, 1, 32},
+    {0x3a3, 9, 1, 32}, {0x3c2, 1, 1, 1}, {0x3cf, 1, 1, 8}, {0x3d0, 1, 1, -30},
+    {0x3d1, 1, 1, -25}, {0x3d5, 1, 1, -15}, {0x3d6, 1, 1, -22},
+    {0x3d8, 12, 2, 1}, {0x3f0, 1, 1, -54}, {0x3f1, 1, 1, -48},
+    {0x3f4, 1, 1, -60}, {0x3f5, 1, 1, -64}, {0x3f7, 1, 1, 1}, {0x3f9, 1, 1, -7},
+    {0x3fa, 1, 1, 1}, {0x3fd, 3, 1, -130}, {0x400, 16, 1, 80},
+    {0x410, 32, 1, 32}, {0x460, 17, 2, 1}, {0x48a, 27, 2, 1}, {0x4c0, 1, 1, 15},
+    {0x4c1, 7, 2, 1}, {0x4d0, 48, 2, 1}, {0x531, 38, 1, 48},
+    {0x10a0, 38, 1, 7264}, {0x10c7, 1, 1, 7264}, {0x10cd, 1, 1, 7264},
+    {0x13f8, 6, 1, -8}, {0x1c80, 1, 1, -6222}, {0x1c81, 1, 1, -6221},
+    {0x1c82, 1, 1, -6212}, {0x1c83, 2, 1, -6210}, {0x1c85, 1, 1, -6211},
+    {0x1c86, 1, 1, -6204}, {0x1c87, 1, 1, -6180}, {0x1c88, 1, 1, 35267},
+    {0x1c90, 43, 1, -3008}, {0x1cbd, 3, 1, -3008}, {0x1e00, 75, 2, 1},
+    {0x1e9b, 1, 1, -58}, {0x1e9e, 1, 1, -7615}, {0x1ea0, 48, 2, 1},
+    {0x1f08, 8, 1, -8}, {0x1f18, 6, 1, -8}, {0x1f28, 8, 1, -8},
+    {0x1f38, 8, 1, -8}, {0x1f48, 6, 1, -8}, {0x1f59, 4, 2, -8},
+    {0x1f68, 8, 1, -8}, {0x1f88, 8, 1, -8}, {0x1f98, 8, 1, -8},
+    {0x1fa8, 8, 1, -8}, {0x1fb8, 2, 1, -8}, {0x1fba, 2, 1, -74},
+    {0x1fbc, 1, 1, -9}, {0x1fbe, 1, 1, -7173}, {0x1fc8, 4, 1, -86},
+    {0x1fcc, 1, 1, -9}, {0x1fd8, 2, 1, -8}, {0x1fda, 2, 1, -100},
+    {0x1fe8, 2, 1, -8}, {0x1fea, 2, 1, -112}, {0x1fec, 1, 1, -7},
+    {0x1ff8, 2, 1, -128}, {0x1ffa, 2, 1, -126}, {0x1ffc, 1, 1, -9},
+    {0x2126, 1, 1, -7517}, {0x212a, 1, 1, -8383}, {0x212b, 1, 1, -8262},
+    {0x2132, 1, 1, 28}, {0x2160, 16, 1, 16}, {0x2183, 1, 1, 1},
+    {0x24b6, 26, 1, 26}, {0x2c00, 48, 1, 48}, {0x2c60, 1, 1, 1},
+    {0x2c62, 1, 1, -10743}, {0x2c63, 1, 1, -3814}, {0x2c64, 1, 1, -10727},
+    {0x2c67, 3, 2, 1}, {0x2c6d, 1, 1, -10780}, {0x2c6e, 1, 1, -10749},
+    {0x2c6f, 1, 1, -10783}, {0x2c70, 1, 1, -10782}, {0x2c72, 1, 1, 1},
+    {0x2c75, 1, 1, 1}, {0x2c7e, 2, 1, -10815}, {0x2c80, 50, 2, 1},
+    {0x2ceb, 2, 2, 1}, {0x2cf2, 1, 1, 1}, {0xa640, 23, 2, 1},
+    {0xa680, 14, 2, 1}, {0xa722, 7, 2, 1}, {0xa732, 31, 2, 1},
+    {0xa779, 2, 2, 1}, {0xa77d, 1, 1, -35332}, {0xa77e, 5, 2, 1},
+    {0xa78b, 1, 1, 1}, {0xa78d, 1, 1, -42280}, {0xa790, 2, 2, 1},
+    {0xa796, 10, 2, 1}, {0xa7aa, 1, 1, -42308}, {0xa7ab, 1, 1, -42319},
+    {0xa7ac, 1, 1, -42315}, {0xa7ad, 1, 1, -42305}, {0xa7ae, 1, 1, -42308},
+    {0xa7b0, 1, 1, -42258}, {0xa7b1, 1, 1, -42282}, {0xa7b2, 1, 1, -42261},
+    {0xa7b3, 1, 1, 928}, {0xa7b4, 8, 2, 1}, {0xa7c4, 1, 1, -48},
+    {0xa7c5, 1, 1, -42307}, {0xa7c6, 1, 1, -35384}, {0xa7c7, 2, 2, 1},
+    {0xa7d0, 1, 1, 1}, {0xa7d6, 2, 2, 1}, {0xa7f5, 1, 1, 1},
+    {0xab70, 80, 1, -38864}, {0xff21, 26, 1, 32}, {0x10400, 40, 1, 40},
+    {0x104b0, 36, 1, 40}, {0x10570, 11, 1, 39}, {0x1057c, 15, 1, 39},
+    {0x1058c, 7, 1, 39}, {0x10594, 2, 1, 39}, {0x10c80, 51, 1, 64},
+    {0x118a0, 32, 1, 32}, {0x16e40, 32, 1, 32}, {0x1e900, 34, 1, 34}};
+
+} // namespace unicode_case
+} // namespace tables
+} // unnamed namespace
+} // namespace simdutf
+
+#endif // SIMDUTF_UNICODE_CASE_TABLES_H
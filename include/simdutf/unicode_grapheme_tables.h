@@ -0,0 +1,370 @@
+#ifndef SIMDUTF_UNICODE_GRAPHEME_TABLES_H
+#define SIMDUTF_UNICODE_GRAPHEME_TABLES_H
+#include <cstdint>
+
+// This file is generated by scripts/unicode_tables.py, do not edit.
+// Grapheme_Cluster_Break from GraphemeBreakProperty.txt and
+// Extended_Pictographic from emoji-data.txt.
+
+namespace simdutf {
+namespace {
+namespace tables {
+namespace unicode_grapheme {
+
+enum grapheme_break : uint8_t {
+  gb_other = 0,
+  gb_cr = 1,
+  gb_lf = 2,
+  gb_control = 3,
+  gb_extend = 4,
+  gb_zwj = 5,
+  gb_regional_indicator = 6,
+  gb_prepend = 7,
+  gb_spacing_mark = 8,
+  gb_l = 9,
+  gb_v = 10,
+  gb_t = 11,
+  gb_lv = 12,
+  gb_lvt = 13,
+  gb_extended_pictographic = 14,
+};
+
+// Code points below this value never join with their neighbours,
+// except CR LF.
+constexpr uint32_t first_complex_code_point = 0x300;
+
+// The Hangul syllables are listed as LVT; the ones at a multiple of 28
+// from the first one are LV.
+constexpr uint32_t first_hangul_syllable = 0xac00;
+constexpr uint32_t hangul_syllable_count = 11172;
+
+// The code points in these ranges never join with their neighbours.
+constexpr uint32_t first_simple_two_byte_code_point = 0x380;
+constexpr uint32_t last_simple_two_byte_code_point = 0x47f;
+constexpr uint32_t first_simple_three_byte_code_point = 0x4000;
+constexpr uint32_t last_simple_three_byte_code_point = 0x9fff;
+
+// Code points first, ..., first + count - 1 have the given property.
+struct grapheme_range {
+  uint32_t first;
+  uint16_t count;
+  grapheme_break property;
+};
+
+// sorted by first, code points not listed are Other
+constexpr grapheme_range grapheme_ranges[636] = {
+    {0x0, 10, gb_control}, {0xa, 1, gb_lf}, {0xb, 2, gb_control},
+    {0xd, 1, gb_cr}, {0xe, 18, gb_control}, {0x7f, 33, gb_control},
+    {0xa9, 1, gb_extended_pictographic}, {0xad, 1, gb_control},
+    {0xae, 1, gb_extended_pictographic}, {0x300, 112, gb_extend},
+    {0x483, 7, gb_extend}, {0x591, 45, gb_extend}, {0x5bf, 1, gb_extend},
+    {0x5c1, 2, gb_extend}, {0x5c4, 2, gb_extend}, {0x5c7, 1, gb_extend},
+    {0x600, 6, gb_prepend}, {0x610, 11, gb_extend}, {0x61c, 1, gb_control},
+    {0x64b, 21, gb_extend}, {0x670, 1, gb_extend}, {0x6d6, 7, gb_extend},
+    {0x6dd, 1, gb_prepend}, {0x6df, 6, gb_extend}, {0x6e7, 2, gb_extend},
+    {0x6ea, 4, gb_extend}, {0x70f, 1, gb_prepend}, {0x711, 1, gb_extend},
+    {0x730, 27, gb_extend}, {0x7a6, 11, gb_extend}, {0x7eb, 9, gb_extend},
+    {0x7fd, 1, gb_extend}, {0x816, 4, gb_extend}, {0x81b, 9, gb_extend},
+    {0x825, 3, gb_extend}, {0x829, 5, gb_extend}, {0x859, 3, gb_extend},
+    {0x890, 2, gb_prepend}, {0x898, 8, gb_extend}, {0x8ca, 24, gb_extend},
+    {0x8e2, 1, gb_prepend}, {0x8e3, 32, gb_extend}, {0x903, 1, gb_spacing_mark},
+    {0x93a, 1, gb_extend}, {0x93b, 1, gb_spacing_mark}, {0x93c, 1, gb_extend},
+    {0x93e, 3, gb_spacing_mark}, {0x941, 8, gb_extend},
+    {0x949, 4, gb_spacing_mark}, {0x94d, 1, gb_extend},
+    {0x94e, 2, gb_spacing_mark}, {0x951, 7, gb_extend}, {0x962, 2, gb_extend},
+    {0x981, 1, gb_extend}, {0x982, 2, gb_spacing_mark}, {0x9bc, 1, gb_extend},
+    {0x9be, 1, gb_extend}, {0x9bf, 2, gb_spacing_mark}, {0x9c1, 4, gb_extend},
+    {0x9c7, 2, gb_spacing_mark}, {0x9cb, 2, gb_spacing_mark},
+    {0x9cd, 1, gb_extend}, {0x9d7, 1, gb_extend}, {0x9e2, 2, gb_extend},
+    {0x9fe, 1, gb_extend}, {0xa01, 2, gb_extend}, {0xa03, 1, gb_spacing_mark},
+    {0xa3c, 1, gb_extend}, {0xa3e, 3, gb_spacing_mark}, {0xa41, 2, gb_extend},
+    {0xa47, 2, gb_extend}, {0xa4b, 3, gb_extend}, {0xa51, 1, gb_extend},
+    {0xa70, 2, gb_extend}, {0xa75, 1, gb_extend}, {0xa81, 2, gb_extend},
+    {0xa83, 1, gb_spacing_mark}, {0xabc, 1, gb_extend},
+    {0xabe, 3, gb_spacing_mark}, {0xac1, 5, gb_extend}, {0xac7, 2, gb_extend},
+    {0xac9, 1, gb_spacing_mark}, {0xacb, 2, gb_spacing_mark},
+    {0xacd, 1, gb_extend}, {0xae2, 2, gb_extend}, {0xafa, 6, gb_extend},
+    {0xb01, 1, gb_extend}, {0xb02, 2, gb_spacing_mark}, {0xb3c, 1, gb_extend},
+    {0xb3e, 2, gb_extend}, {0xb40, 1, gb_spacing_mark}, {0xb41, 4, gb_extend},
+    {0xb47, 2, gb_spacing_mark}, {0xb4b, 2, gb_spacing_mark},
+    {0xb4d, 1, gb_extend}, {0xb55, 3, gb_extend}, {0xb62, 2, gb_extend},
+    {0xb82, 1, gb_extend}, {0xbbe, 1, gb_extend}, {0xbbf, 1, gb_spacing_mark},
+    {0xbc0, 1, gb_extend}, {0xbc1, 2, gb_spacing_mark},
+    {0xbc6, 3, gb_spacing_mark}, {0xbca, 3, gb_spacing_mark},
+    {0xbcd, 1, gb_extend}, {0xbd7, 1, gb_extend}, {0xc00, 1, gb_extend},
+    {0xc01, 3, gb_spacing_mark}, {0xc04, 1, gb_extend}, {0xc3c, 1, gb_extend},
+    {0xc3e, 3, gb_extend}, {0xc41, 4, gb_spacing_mark}, {0xc46, 3, gb_extend},
+    {0xc4a, 4, gb_extend}, {0xc55, 2, gb_extend}, {0xc62, 2, gb_extend},
+    {0xc81, 1, gb_extend}, {0xc82, 2, gb_spacing_mark}, {0xcbc, 1, gb_extend},
+    {0xcbe, 1, gb_spacing_mark}, {0xcbf, 1, gb_extend},
+    {0xcc0, 2, gb_spacing_mark}, {0xcc2, 1, gb_extend},
+    {0xcc3, 2, gb_spacing_mark}, {0xcc6, 1, gb_extend},
+    {0xcc7, 2, gb_spacing_mark}, {0xcca, 2, gb_spacing_mark},
+    {0xccc, 2, gb_extend}, {0xcd5, 2, gb_extend}, {0xce2, 2, gb_extend},
+    {0xd00, 2, gb_extend}, {0xd02, 2, gb_spacing_mark}, {0xd3b, 2, gb_extend},
+    {0xd3e, 1, gb_extend}, {0xd3f, 2, gb_spacing_mark}, {0xd41, 4, gb_extend},
+    {0xd46, 3, gb_spacing_mark}, {0xd4a, 3, gb_spacing_mark},
+    {0xd4d, 1, gb_extend}, {0xd4e, 1, gb_prepend}, {0xd57, 1, gb_extend},
+    {0xd62, 2, gb_extend}, {0xd81, 1, gb_extend}, {0xd82, 2, gb_spacing_mark},
+    {0xdca, 1, gb_extend}, {0xdcf, 1, gb_extend}, {0xdd0, 2, gb_spacing_mark},
+    {0xdd2, 3, gb_extend}, {0xdd6, 1, gb_extend}, {0xdd8, 7, gb_spacing_mark},
+    {0xddf, 1, gb_extend}, {0xdf2, 2, gb_spacing_mark}, {0xe31, 1, gb_extend},
+    {0xe33, 1, gb_spacing_mark}, {0xe34, 7, gb_extend}, {0xe47, 8, gb_extend},
+    {0xeb1, 1, gb_extend}, {0xeb3, 1, gb_spacing_mark}, {0xeb4, 9, gb_extend},
+    {0xec8, 6, gb_extend}, {0xf18, 2, gb_extend}, {0xf35, 1, gb_extend},
+    {0xf37, 1, gb_extend}, {0xf39, 1, gb_extend}, {0xf3e, 2, gb_spacing_mark},
+    {0xf71, 14, gb_extend}, {0xf7f, 1, gb_spacing_mark}, {0xf80, 5, gb_extend},
+    {0xf86, 2, gb_extend}, {0xf8d, 11, gb_extend}, {0xf99, 36, gb_extend},
+    {0xfc6, 1, gb_extend}, {0x102d, 4, gb_extend}, {0x1031, 1, gb_spacing_mark},
+    {0x1032, 6, gb_extend}, {0x1039, 2, gb_extend},
+    {0x103b, 2, gb_spacing_mark}, {0x103d, 2, gb_extend},
+    {0x1056, 2, gb_spacing_mark}, {0x1058, 2, gb_extend},
+    {0x105e, 3, gb_extend}, {0x1071, 4, gb_extend}, {0x1082, 1, gb_extend},
+    {0x1084, 1, gb_spacing_mark}, {0x1085, 2, gb_extend},
+    {0x108d, 1, gb_extend}, {0x109d, 1, gb_extend}, {0x1100, 96, gb_l},
+    {0x1160, 72, gb_v}, {0x11a8, 88, gb_t}, {0x135d, 3, gb_extend},
+    {0x1712, 3, gb_extend}, {0x1715, 1, gb_spacing_mark},
+    {0x1732, 2, gb_extend}, {0x1734, 1, gb_spacing_mark},
+    {0x1752, 2, gb_extend}, {0x1772, 2, gb_extend}, {0x17b4, 2, gb_extend},
+    {0x17b6, 1, gb_spacing_mark}, {0x17b7, 7, gb_extend},
+    {0x17be, 8, gb_spacing_mark}, {0x17c6, 1, gb_extend},
+    {0x17c7, 2, gb_spacing_mark}, {0x17c9, 11, gb_extend},
+    {0x17dd, 1, gb_extend}, {0x180b, 3, gb_extend}, {0x180e, 1, gb_control},
+    {0x180f, 1, gb_extend}, {0x1885, 2, gb_extend}, {0x18a9, 1, gb_extend},
+    {0x1920, 3, gb_extend}, {0x1923, 4, gb_spacing_mark},
+    {0x1927, 2, gb_extend}, {0x1929, 3, gb_spacing_mark},
+    {0x1930, 2, gb_spacing_mark}, {0x1932, 1, gb_extend},
+    {0x1933, 6, gb_spacing_mark}, {0x1939, 3, gb_extend},
+    {0x1a17, 2, gb_extend}, {0x1a19, 2, gb_spacing_mark},
+    {0x1a1b, 1, gb_extend}, {0x1a55, 1, gb_spacing_mark},
+    {0x1a56, 1, gb_extend}, {0x1a57, 1, gb_spacing_mark},
+    {0x1a58, 7, gb_extend}, {0x1a60, 1, gb_extend}, {0x1a62, 1, gb_extend},
+    {0x1a65, 8, gb_extend}, {0x1a6d, 6, gb_spacing_mark},
+    {0x1a73, 10, gb_extend}, {0x1a7f, 1, gb_extend}, {0x1ab0, 31, gb_extend},
+    {0x1b00, 4, gb_extend}, {0x1b04, 1, gb_spacing_mark},
+    {0x1b34, 7, gb_extend}, {0x1b3b, 1, gb_spacing_mark},
+    {0x1b3c, 1, gb_extend}, {0x1b3d, 5, gb_spacing_mark},
+    {0x1b42, 1, gb_extend}, {0x1b43, 2, gb_spacing_mark},
+    {0x1b6b, 9, gb_extend}, {0x1b80, 2, gb_extend},
+    {0x1b82, 1, gb_spacing_mark}, {0x1ba1, 1, gb_spacing_mark},
+    {0x1ba2, 4, gb_extend}, {0x1ba6, 2, gb_spacing_mark},
+    {0x1ba8, 2, gb_extend}, {0x1baa, 1, gb_spacing_mark},
+    {0x1bab, 3, gb_extend}, {0x1be6, 1, gb_extend},
+    {0x1be7, 1, gb_spacing_mark}, {0x1be8, 2, gb_extend},
+    {0x1bea, 3, gb_spacing_mark}, {0x1bed, 1, gb_extend},
+    {0x1bee, 1, gb_spacing_mark}, {0x1bef, 3, gb_extend},
+    {0x1bf2, 2, gb_spacing_mark}, {0x1c24, 8, gb_spacing_mark},
+    {0x1c2c, 8, gb_extend}, {0x1c34, 2, gb_spacing_mark},
+    {0x1c36, 2, gb_extend}, {0x1cd0, 3, gb_extend}, {0x1cd4, 13, gb_extend},
+    {0x1ce1, 1, gb_spacing_mark}, {0x1ce2, 7, gb_extend},
+    {0x1ced, 1, gb_extend}, {0x1cf4, 1, gb_extend},
+    {0x1cf7, 1, gb_spacing_mark}, {0x1cf8, 2, gb_extend},
+    {0x1dc0, 64, gb_extend}, {0x200b, 1, gb_control}, {0x200c, 1, gb_extend},
+    {0x200d, 1, gb_zwj}, {0x200e, 2, gb_control}, {0x2028, 7, gb_control},
+    {0x203c, 1, gb_extended_pictographic},
+    {0x2049, 1, gb_extended_pictographic}, {0x2060, 16, gb_control},
+    {0x20d0, 33, gb_extend}, {0x2122, 1, gb_extended_pictographic},
+    {0x2139, 1, gb_extended_pictographic},
+    {0x2194, 6, gb_extended_pictographic},
+    {0x21a9, 2, gb_extended_pictographic},
+    {0x231a, 2, gb_extended_pictographic},
+    {0x2328, 1, gb_extended_pictographic},
+    {0x2388, 1, gb_extended_pictographic},
+    {0x23cf, 1, gb_extended_pictographic},
+    {0x23e9, 11, gb_extended_pictographic},
+    {0x23f8, 3, gb_extended_pictographic},
+    {0x24c2, 1, gb_extended_pictographic},
+    {0x25aa, 2, gb_extended_pictographic},
+    {0x25b6, 1, gb_extended_pictographic},
+    {0x25c0, 1, gb_extended_pictographic},
+    {0x25fb, 4, gb_extended_pictographic},
+    {0x2600, 6, gb_extended_pictographic},
+    {0x2607, 12, gb_extended_pictographic},
+    {0x2614, 114, gb_extended_pictographic},
+    {0x2690, 118, gb_extended_pictographic},
+    {0x2708, 11, gb_extended_pictographic},
+    {0x2714, 1, gb_extended_pictographic},
+    {0x2716, 1, gb_extended_pictographic},
+    {0x271d, 1, gb_extended_pictographic},
+    {0x2721, 1, gb_extended_pictographic},
+    {0x2728, 1, gb_extended_pictographic},
+    {0x2733, 2, gb_extended_pictographic},
+    {0x2744, 1, gb_extended_pictographic},
+    {0x2747, 1, gb_extended_pictographic},
+    {0x274c, 1, gb_extended_pictographic},
+    {0x274e, 1, gb_extended_pictographic},
+    {0x2753, 3, gb_extended_pictographic},
+    {0x2757, 1, gb_extended_pictographic},
+    {0x2763, 5, gb_extended_pictographic},
+    {0x2795, 3, gb_extended_pictographic},
+    {0x27a1, 1, gb_extended_pictographic},
+    {0x27b0, 1, gb_extended_pictographic},
+    {0x27bf, 1, gb_extended_pictographic},
+    {0x2934, 2, gb_extended_pictographic},
+    {0x2b05, 3, gb_extended_pictographic},
+    {0x2b1b, 2, gb_extended_pictographic},
+    {0x2b50, 1, gb_extended_pictographic},
+    {0x2b55, 1, gb_extended_pictographic}, {0x2cef, 3, gb_extend},
+    {0x2d7f, 1, gb_extend}, {0x2de0, 32, gb_extend}, {0x302a, 6, gb_extend},
+    {0x3030, 1, gb_extended_pictographic},
+    {0x303d, 1, gb_extended_pictographic}, {0x3099, 2, gb_extend},
+    {0x3297, 1, gb_extended_pictographic},
+    {0x3299, 1, gb_extended_pictographic}, {0xa66f, 4, gb_extend},
+    {0xa674, 10, gb_extend}, {0xa69e, 2, gb_extend}, {0xa6f0, 2, gb_extend},
+    {0xa802, 1, gb_extend}, {0xa806, 1, gb_extend}, {0xa80b, 1, gb_extend},
+    {0xa823, 2, gb_spacing_mark}, {0xa825, 2, gb_extend},
+    {0xa827, 1, gb_spacing_mark}, {0xa82c, 1, gb_extend},
+    {0xa880, 2, gb_spacing_mark}, {0xa8b4, 16, gb_spacing_mark},
+    {0xa8c4, 2, gb_extend}, {0xa8e0, 18, gb_extend}, {0xa8ff, 1, gb_extend},
+    {0xa926, 8, gb_extend}, {0xa947, 11, gb_extend},
+    {0xa952, 2, gb_spacing_mark}, {0xa960, 29, gb_l}, {0xa980, 3, gb_extend},
+    {0xa983, 1, gb_spacing_mark}, {0xa9b3, 1, gb_extend},
+    {0xa9b4, 2, gb_spacing_mark}, {0xa9b6, 4, gb_extend},
+    {0xa9ba, 2, gb_spacing_mark}, {0xa9bc, 2, gb_extend},
+    {0xa9be, 3, gb_spacing_mark}, {0xa9e5, 1, gb_extend},
+    {0xaa29, 6, gb_extend}, {0xaa2f, 2, gb_spacing_mark},
+    {0xaa31, 2, gb_extend}, {0xaa33, 2, gb_spacing_mark},
+    {0xaa35, 2, gb_extend}, {0xaa43, 1, gb_extend}, {0xaa4c, 1, gb_extend},
+    {0xaa4d, 1, gb_spacing_mark}, {0xaa7c, 1, gb_extend},
+    {0xaab0, 1, gb_extend}, {0xaab2, 3, gb_extend}, {0xaab7, 2, gb_extend},
+    {0xaabe, 2, gb_extend}, {0xaac1, 1, gb_extend},
+    {0xaaeb, 1, gb_spacing_mark}, {0xaaec, 2, gb_extend},
+    {0xaaee, 2, gb_spacing_mark}, {0xaaf5, 1, gb_spacing_mark},
+    {0xaaf6, 1, gb_extend}, {0xabe3, 2, gb_spacing_mark},
+    {0xabe5, 1, gb_extend}, {0xabe6, 2, gb_spacing_mark},
+    {0xabe8, 1, gb_extend}, {0xabe9, 2, gb_spacing_mark},
+    {0xabec, 1, gb_spacing_mark}, {0xabed, 1, gb_extend},
+    {0xac00, 11172, gb_lvt}, {0xd7b0, 23, gb_v}, {0xd7cb, 49, gb_t},
+    {0xfb1e, 1, gb_extend}, {0xfe00, 16, gb_extend}, {0xfe20, 16, gb_extend},
+    {0xfeff, 1, gb_control}, {0xff9e, 2, gb_extend}, {0xfff0, 12, gb_control},
+    {0x101fd, 1, gb_extend}, {0x102e0, 1, gb_extend}, {0x10376, 5, gb_extend},
+    {0x10a01, 3, gb_extend}, {0x10a05, 2, gb_extend}, {0x10a0c, 4, gb_extend},
+    {0x10a38, 3, gb_extend}, {0x10a3f, 1, gb_extend}, {0x10ae5, 2, gb_extend},
+    {0x10d24, 4, gb_extend}, {0x10eab, 2, gb_extend}, {0x10f46, 11, gb_extend},
+    {0x10f82, 4, gb_extend}, {0x11000, 1, gb_spacing_mark},
+    {0x11001, 1, gb_extend}, {0x11002, 1, gb_spacing_mark},
+    {0x11038, 15, gb_extend}, {0x11070, 1, gb_extend}, {0x11073, 2, gb_extend},
+    {0x1107f, 3, gb_extend}, {0x11082, 1, gb_spacing_mark},
+    {0x110b0, 3, gb_spacing_mark}, {0x110b3, 4, gb_extend},
+    {0x110b7, 2, gb_spacing_mark}, {0x110b9, 2, gb_extend},
+    {0x110bd, 1, gb_prepend}, {0x110c2, 1, gb_extend}, {0x110cd, 1, gb_prepend},
+    {0x11100, 3, gb_extend}, {0x11127, 5, gb_extend},
+    {0x1112c, 1, gb_spacing_mark}, {0x1112d, 8, gb_extend},
+    {0x11145, 2, gb_spacing_mark}, {0x11173, 1, gb_extend},
+    {0x11180, 2, gb_extend}, {0x11182, 1, gb_spacing_mark},
+    {0x111b3, 3, gb_spacing_mark}, {0x111b6, 9, gb_extend},
+    {0x111bf, 2, gb_spacing_mark}, {0x111c2, 2, gb_prepend},
+    {0x111c9, 4, gb_extend}, {0x111ce, 1, gb_spacing_mark},
+    {0x111cf, 1, gb_extend}, {0x1122c, 3, gb_spacing_mark},
+    {0x1122f, 3, gb_extend}, {0x11232, 2, gb_spacing_mark},
+    {0x11234, 1, gb_extend}, {0x11235, 1, gb_spacing_mark},
+    {0x11236, 2, gb_extend}, {0x1123e, 1, gb_extend}, {0x112df, 1, gb_extend},
+    {0x112e0, 3, gb_spacing_mark}, {0x112e3, 8, gb_extend},
+    {0x11300, 2, gb_extend}, {0x11302, 2, gb_spacing_mark},
+    {0x1133b, 2, gb_extend}, {0x1133e, 1, gb_extend},
+    {0x1133f, 1, gb_spacing_mark}, {0x11340, 1, gb_extend},
+    {0x11341, 4, gb_spacing_mark}, {0x11347, 2, gb_spacing_mark},
+    {0x1134b, 3, gb_spacing_mark}, {0x11357, 1, gb_extend},
+    {0x11362, 2, gb_spacing_mark}, {0x11366, 7, gb_extend},
+    {0x11370, 5, gb_extend}, {0x11435, 3, gb_spacing_mark},
+    {0x11438, 8, gb_extend}, {0x11440, 2, gb_spacing_mark},
+    {0x11442, 3, gb_extend}, {0x11445, 1, gb_spacing_mark},
+    {0x11446, 1, gb_extend}, {0x1145e, 1, gb_extend}, {0x114b0, 1, gb_extend},
+    {0x114b1, 2, gb_spacing_mark}, {0x114b3, 6, gb_extend},
+    {0x114b9, 1, gb_spacing_mark}, {0x114ba, 1, gb_extend},
+    {0x114bb, 2, gb_spacing_mark}, {0x114bd, 1, gb_extend},
+    {0x114be, 1, gb_spacing_mark}, {0x114bf, 2, gb_extend},
+    {0x114c1, 1, gb_spacing_mark}, {0x114c2, 2, gb_extend},
+    {0x115af, 1, gb_extend}, {0x115b0, 2, gb_spacing_mark},
+    {0x115b2, 4, gb_extend}, {0x115b8, 4, gb_spacing_mark},
+    {0x115bc, 2, gb_extend}, {0x115be, 1, gb_spacing_mark},
+    {0x115bf, 2, gb_extend}, {0x115dc, 2, gb_extend},
+    {0x11630, 3, gb_spacing_mark}, {0x11633, 8, gb_extend},
+    {0x1163b, 2, gb_spacing_mark}, {0x1163d, 1, gb_extend},
+    {0x1163e, 1, gb_spacing_mark}, {0x1163f, 2, gb_extend},
+    {0x116ab, 1, gb_extend}, {0x116ac, 1, gb_spacing_mark},
+    {0x116ad, 1, gb_extend}, {0x116ae, 2, gb_spacing_mark},
+    {0x116b0, 6, gb_extend}, {0x116b6, 1, gb_spacing_mark},
+    {0x116b7, 1, gb_extend}, {0x1171d, 3, gb_extend}, {0x11722, 4, gb_extend},
+    {0x11726, 1, gb_spacing_mark}, {0x11727, 5, gb_extend},
+    {0x1182c, 3, gb_spacing_mark}, {0x1182f, 9, gb_extend},
+    {0x11838, 1, gb_spacing_mark}, {0x11839, 2, gb_extend},
+    {0x11930, 1, gb_extend}, {0x11931, 5, gb_spacing_mark},
+    {0x11937, 2, gb_spacing_mark}, {0x1193b, 2, gb_extend},
+    {0x1193d, 1, gb_spacing_mark}, {0x1193e, 1, gb_extend},
+    {0x1193f, 1, gb_prepend}, {0x11940, 1, gb_spacing_mark},
+    {0x11941, 1, gb_prepend}, {0x11942, 1, gb_spacing_mark},
+    {0x11943, 1, gb_extend}, {0x119d1, 3, gb_spacing_mark},
+    {0x119d4, 4, gb_extend}, {0x119da, 2, gb_extend},
+    {0x119dc, 4, gb_spacing_mark}, {0x119e0, 1, gb_extend},
+    {0x119e4, 1, gb_spacing_mark}, {0x11a01, 10, gb_extend},
+    {0x11a33, 6, gb_extend}, {0x11a39, 1, gb_spacing_mark},
+    {0x11a3a, 1, gb_prepend}, {0x11a3b, 4, gb_extend}, {0x11a47, 1, gb_extend},
+    {0x11a51, 6, gb_extend}, {0x11a57, 2, gb_spacing_mark},
+    {0x11a59, 3, gb_extend}, {0x11a84, 6, gb_prepend}, {0x11a8a, 13, gb_extend},
+    {0x11a97, 1, gb_spacing_mark}, {0x11a98, 2, gb_extend},
+    {0x11c2f, 1, gb_spacing_mark}, {0x11c30, 7, gb_extend},
+    {0x11c38, 6, gb_extend}, {0x11c3e, 1, gb_spacing_mark},
+    {0x11c3f, 1, gb_extend}, {0x11c92, 22, gb_extend},
+    {0x11ca9, 1, gb_spacing_mark}, {0x11caa, 7, gb_extend},
+    {0x11cb1, 1, gb_spacing_mark}, {0x11cb2, 2, gb_extend},
+    {0x11cb4, 1, gb_spacing_mark}, {0x11cb5, 2, gb_extend},
+    {0x11d31, 6, gb_extend}, {0x11d3a, 1, gb_extend}, {0x11d3c, 2, gb_extend},
+    {0x11d3f, 7, gb_extend}, {0x11d46, 1, gb_prepend}, {0x11d47, 1, gb_extend},
+    {0x11d8a, 5, gb_spacing_mark}, {0x11d90, 2, gb_extend},
+    {0x11d93, 2, gb_spacing_mark}, {0x11d95, 1, gb_extend},
+    {0x11d96, 1, gb_spacing_mark}, {0x11d97, 1, gb_extend},
+    {0x11ef3, 2, gb_extend}, {0x11ef5, 2, gb_spacing_mark},
+    {0x13430, 9, gb_control}, {0x16af0, 5, gb_extend}, {0x16b30, 7, gb_extend},
+    {0x16f4f, 1, gb_extend}, {0x16f51, 55, gb_spacing_mark},
+    {0x16f8f, 4, gb_extend}, {0x16fe4, 1, gb_extend},
+    {0x16ff0, 2, gb_spacing_mark}, {0x1bc9d, 2, gb_extend},
+    {0x1bca0, 4, gb_control}, {0x1cf00, 46, gb_extend},
+    {0x1cf30, 23, gb_extend}, {0x1d165, 1, gb_extend},
+    {0x1d166, 1, gb_spacing_mark}, {0x1d167, 3, gb_extend},
+    {0x1d16d, 1, gb_spacing_mark}, {0x1d16e, 5, gb_extend},
+    {0x1d173, 8, gb_control}, {0x1d17b, 8, gb_extend}, {0x1d185, 7, gb_extend},
+    {0x1d1aa, 4, gb_extend}, {0x1d242, 3, gb_extend}, {0x1da00, 55, gb_extend},
+    {0x1da3b, 50, gb_extend}, {0x1da75, 1, gb_extend}, {0x1da84, 1, gb_extend},
+    {0x1da9b, 5, gb_extend}, {0x1daa1, 15, gb_extend}, {0x1e000, 7, gb_extend},
+    {0x1e008, 17, gb_extend}, {0x1e01b, 7, gb_extend}, {0x1e023, 2, gb_extend},
+    {0x1e026, 5, gb_extend}, {0x1e130, 7, gb_extend}, {0x1e2ae, 1, gb_extend},
+    {0x1e2ec, 4, gb_extend}, {0x1e8d0, 7, gb_extend}, {0x1e944, 7, gb_extend},
+    {0x1f000, 256, gb_extended_pictographic},
+    {0x1f10d, 3, gb_extended_pictographic},
+    {0x1f12f, 1, gb_extended_pictographic},
+    {0x1f16c, 6, gb_extended_pictographic},
+    {0x1f17e, 2, gb_extended_pictographic},
+    {0x1f18e, 1, gb_extended_pictographic},
+    {0x1f191, 10, gb_extended_pictographic},
+    {0x1f1ad, 57, gb_extended_pictographic},
+    {0x1f1e6, 26, gb_regional_indicator},
+    {0x1f201, 15, gb_extended_pictographic},
+    {0x1f21a, 1, gb_extended_pictographic},
+    {0x1f22f, 1, gb_extended_pictographic},
+    {0x1f232, 9, gb_extended_pictographic},
+    {0x1f23c, 4, gb_extended_pictographic},
+    {0x1f249, 434, gb_extended_pictographic}, {0x1f3fb, 5, gb_extend},
+    {0x1f400, 318, gb_extended_pictographic},
+    {0x1f546, 266, gb_extended_pictographic},
+    {0x1f680, 128, gb_extended_pictographic},
+    {0x1f774, 12, gb_extended_pictographic},
+    {0x1f7d5, 43, gb_extended_pictographic},
+    {0x1f80c, 4, gb_extended_pictographic},
+    {0x1f848, 8, gb_extended_pictographic},
+    {0x1f85a, 6, gb_extended_pictographic},
+    {0x1f888, 8, gb_extended_pictographic},
+    {0x1f8ae, 82, gb_extended_pictographic},
+    {0x1f90c, 47, gb_extended_pictographic},
+    {0x1f93c, 10, gb_extended_pictographic},
+    {0x1f947, 441, gb_extended_pictographic},
+    {0x1fc00, 1022, gb_extended_pictographic}, {0xe0000, 32, gb_control},
+    {0xe0020, 96, gb_extend}, {0xe0080, 128, gb_control},
+    {0xe0100, 240, gb_extend}, {0xe01f0, 3600, gb_control}};
+
+} // namespace unicode_grapheme
+} // namespace tables
+} // unnamed namespace
+} // namespace simdutf
+
+#endif // SIMDUTF_UNICODE_GRAPHEME_TABLES_H
@@ -0,0 +1,190 @@
+#ifndef SIMDUTF_UNICODE_NORMALIZATION_TABLES_H
+#define SIMDUTF_UNICODE_NORMALIZATION_TABLES_H
+#include <cstdint>
+
+// This file is generated by scripts/unicode_tables.py, do not edit.
+// Canonical_Combining_Class and NFC_Quick_Check from UnicodeData.txt and
+// DerivedNormalizationProps.txt.
+
+namespace simdutf {
+namespace {
+namespace tables {
+namespace unicode_normalization {
+
+// Code points below this value have a zero combining class and are
+// NFC_Quick_Check=Yes.
+constexpr uint32_t first_nfc_relevant_code_point = 0x300;
+
+enum quick_check_value : uint8_t { qc_yes = 0, qc_no = 1, qc_maybe = 2 };
+
+// Code points first, ..., first + count - 1 have the given canonical
+// combining class and NFC_Quick_Check value.
+struct nfc_range {
+  uint32_t first;
+  uint16_t count;
+  uint8_t ccc;
+  uint8_t quick_check;
+};
+
+// sorted by first, code points not listed are ccc=0 and NFC_QC=Yes
+constexpr nfc_range nfc_ranges[494] = {
+    {0x300, 5, 230, 2}, {0x305, 1, 230, 0}, {0x306, 7, 230, 2},
+    {0x30d, 2, 230, 0}, {0x30f, 1, 230, 2}, {0x310, 1, 230, 0},
+    {0x311, 1, 230, 2}, {0x312, 1, 230, 0}, {0x313, 2, 230, 2},
+    {0x315, 1, 232, 0}, {0x316, 4, 220, 0}, {0x31a, 1, 232, 0},
+    {0x31b, 1, 216, 2}, {0x31c, 5, 220, 0}, {0x321, 2, 202, 0},
+    {0x323, 4, 220, 2}, {0x327, 2, 202, 2}, {0x329, 4, 220, 0},
+    {0x32d, 2, 220, 2}, {0x32f, 1, 220, 0}, {0x330, 2, 220, 2},
+    {0x332, 2, 220, 0}, {0x334, 4, 1, 0}, {0x338, 1, 1, 2}, {0x339, 4, 220, 0},
+    {0x33d, 3, 230, 0}, {0x340, 2, 230, 1}, {0x342, 1, 230, 2},
+    {0x343, 2, 230, 1}, {0x345, 1, 240, 2}, {0x346, 1, 230, 0},
+    {0x347, 3, 220, 0}, {0x34a, 3, 230, 0}, {0x34d, 2, 220, 0},
+    {0x350, 3, 230, 0}, {0x353, 4, 220, 0}, {0x357, 1, 230, 0},
+    {0x358, 1, 232, 0}, {0x359, 2, 220, 0}, {0x35b, 1, 230, 0},
+    {0x35c, 1, 233, 0}, {0x35d, 2, 234, 0}, {0x35f, 1, 233, 0},
+    {0x360, 2, 234, 0}, {0x362, 1, 233, 0}, {0x363, 13, 230, 0},
+    {0x374, 1, 0, 1}, {0x37e, 1, 0, 1}, {0x387, 1, 0, 1}, {0x483, 5, 230, 0},
+    {0x591, 1, 220, 0}, {0x592, 4, 230, 0}, {0x596, 1, 220, 0},
+    {0x597, 3, 230, 0}, {0x59a, 1, 222, 0}, {0x59b, 1, 220, 0},
+    {0x59c, 6, 230, 0}, {0x5a2, 6, 220, 0}, {0x5a8, 2, 230, 0},
+    {0x5aa, 1, 220, 0}, {0x5ab, 2, 230, 0}, {0x5ad, 1, 222, 0},
+    {0x5ae, 1, 228, 0}, {0x5af, 1, 230, 0}, {0x5b0, 1, 10, 0},
+    {0x5b1, 1, 11, 0}, {0x5b2, 1, 12, 0}, {0x5b3, 1, 13, 0}, {0x5b4, 1, 14, 0},
+    {0x5b5, 1, 15, 0}, {0x5b6, 1, 16, 0}, {0x5b7, 1, 17, 0}, {0x5b8, 1, 18, 0},
+    {0x5b9, 2, 19, 0}, {0x5bb, 1, 20, 0}, {0x5bc, 1, 21, 0}, {0x5bd, 1, 22, 0},
+    {0x5bf, 1, 23, 0}, {0x5c1, 1, 24, 0}, {0x5c2, 1, 25, 0}, {0x5c4, 1, 230, 0},
+    {0x5c5, 1, 220, 0}, {0x5c7, 1, 18, 0}, {0x610, 8, 230, 0},
+    {0x618, 1, 30, 0}, {0x619, 1, 31, 0}, {0x61a, 1, 32, 0}, {0x64b, 1, 27, 0},
+    {0x64c, 1, 28, 0}, {0x64d, 1, 29, 0}, {0x64e, 1, 30, 0}, {0x64f, 1, 31, 0},
+    {0x650, 1, 32, 0}, {0x651, 1, 33, 0}, {0x652, 1, 34, 0}, {0x653, 2, 230, 2},
+    {0x655, 1, 220, 2}, {0x656, 1, 220, 0}, {0x657, 5, 230, 0},
+    {0x65c, 1, 220, 0}, {0x65d, 2, 230, 0}, {0x65f, 1, 220, 0},
+    {0x670, 1, 35, 0}, {0x6d6, 7, 230, 0}, {0x6df, 4, 230, 0},
+    {0x6e3, 1, 220, 0}, {0x6e4, 1, 230, 0}, {0x6e7, 2, 230, 0},
+    {0x6ea, 1, 220, 0}, {0x6eb, 2, 230, 0}, {0x6ed, 1, 220, 0},
+    {0x711, 1, 36, 0}, {0x730, 1, 230, 0}, {0x731, 1, 220, 0},
+    {0x732, 2, 230, 0}, {0x734, 1, 220, 0}, {0x735, 2, 230, 0},
+    {0x737, 3, 220, 0}, {0x73a, 1, 230, 0}, {0x73b, 2, 220, 0},
+    {0x73d, 1, 230, 0}, {0x73e, 1, 220, 0}, {0x73f, 3, 230, 0},
+    {0x742, 1, 220, 0}, {0x743, 1, 230, 0}, {0x744, 1, 220, 0},
+    {0x745, 1, 230, 0}, {0x746, 1, 220, 0}, {0x747, 1, 230, 0},
+    {0x748, 1, 220, 0}, {0x749, 2, 230, 0}, {0x7eb, 7, 230, 0},
+    {0x7f2, 1, 220, 0}, {0x7f3, 1, 230, 0}, {0x7fd, 1, 220, 0},
+    {0x816, 4, 230, 0}, {0x81b, 9, 230, 0}, {0x825, 3, 230, 0},
+    {0x829, 5, 230, 0}, {0x859, 3, 220, 0}, {0x898, 1, 230, 0},
+    {0x899, 3, 220, 0}, {0x89c, 4, 230, 0}, {0x8ca, 5, 230, 0},
+    {0x8cf, 5, 220, 0}, {0x8d4, 14, 230, 0}, {0x8e3, 1, 220, 0},
+    {0x8e4, 2, 230, 0}, {0x8e6, 1, 220, 0}, {0x8e7, 2, 230, 0},
+    {0x8e9, 1, 220, 0}, {0x8ea, 3, 230, 0}, {0x8ed, 3, 220, 0},
+    {0x8f0, 1, 27, 0}, {0x8f1, 1, 28, 0}, {0x8f2, 1, 29, 0}, {0x8f3, 3, 230, 0},
+    {0x8f6, 1, 220, 0}, {0x8f7, 2, 230, 0}, {0x8f9, 2, 220, 0},
+    {0x8fb, 5, 230, 0}, {0x93c, 1, 7, 2}, {0x94d, 1, 9, 0}, {0x951, 1, 230, 0},
+    {0x952, 1, 220, 0}, {0x953, 2, 230, 0}, {0x958, 8, 0, 1}, {0x9bc, 1, 7, 0},
+    {0x9be, 1, 0, 2}, {0x9cd, 1, 9, 0}, {0x9d7, 1, 0, 2}, {0x9dc, 2, 0, 1},
+    {0x9df, 1, 0, 1}, {0x9fe, 1, 230, 0}, {0xa33, 1, 0, 1}, {0xa36, 1, 0, 1},
+    {0xa3c, 1, 7, 0}, {0xa4d, 1, 9, 0}, {0xa59, 3, 0, 1}, {0xa5e, 1, 0, 1},
+    {0xabc, 1, 7, 0}, {0xacd, 1, 9, 0}, {0xb3c, 1, 7, 0}, {0xb3e, 1, 0, 2},
+    {0xb4d, 1, 9, 0}, {0xb56, 2, 0, 2}, {0xb5c, 2, 0, 1}, {0xbbe, 1, 0, 2},
+    {0xbcd, 1, 9, 0}, {0xbd7, 1, 0, 2}, {0xc3c, 1, 7, 0}, {0xc4d, 1, 9, 0},
+    {0xc55, 1, 84, 0}, {0xc56, 1, 91, 2}, {0xcbc, 1, 7, 0}, {0xcc2, 1, 0, 2},
+    {0xccd, 1, 9, 0}, {0xcd5, 2, 0, 2}, {0xd3b, 2, 9, 0}, {0xd3e, 1, 0, 2},
+    {0xd4d, 1, 9, 0}, {0xd57, 1, 0, 2}, {0xdca, 1, 9, 2}, {0xdcf, 1, 0, 2},
+    {0xddf, 1, 0, 2}, {0xe38, 2, 103, 0}, {0xe3a, 1, 9, 0}, {0xe48, 4, 107, 0},
+    {0xeb8, 2, 118, 0}, {0xeba, 1, 9, 0}, {0xec8, 4, 122, 0},
+    {0xf18, 2, 220, 0}, {0xf35, 1, 220, 0}, {0xf37, 1, 220, 0},
+    {0xf39, 1, 216, 0}, {0xf43, 1, 0, 1}, {0xf4d, 1, 0, 1}, {0xf52, 1, 0, 1},
+    {0xf57, 1, 0, 1}, {0xf5c, 1, 0, 1}, {0xf69, 1, 0, 1}, {0xf71, 1, 129, 0},
+    {0xf72, 1, 130, 0}, {0xf73, 1, 0, 1}, {0xf74, 1, 132, 0}, {0xf75, 2, 0, 1},
+    {0xf78, 1, 0, 1}, {0xf7a, 4, 130, 0}, {0xf80, 1, 130, 0}, {0xf81, 1, 0, 1},
+    {0xf82, 2, 230, 0}, {0xf84, 1, 9, 0}, {0xf86, 2, 230, 0}, {0xf93, 1, 0, 1},
+    {0xf9d, 1, 0, 1}, {0xfa2, 1, 0, 1}, {0xfa7, 1, 0, 1}, {0xfac, 1, 0, 1},
+    {0xfb9, 1, 0, 1}, {0xfc6, 1, 220, 0}, {0x102e, 1, 0, 2}, {0x1037, 1, 7, 0},
+    {0x1039, 2, 9, 0}, {0x108d, 1, 220, 0}, {0x1161, 21, 0, 2},
+    {0x11a8, 27, 0, 2}, {0x135d, 3, 230, 0}, {0x1714, 2, 9, 0},
+    {0x1734, 1, 9, 0}, {0x17d2, 1, 9, 0}, {0x17dd, 1, 230, 0},
+    {0x18a9, 1, 228, 0}, {0x1939, 1, 222, 0}, {0x193a, 1, 230, 0},
+    {0x193b, 1, 220, 0}, {0x1a17, 1, 230, 0}, {0x1a18, 1, 220, 0},
+    {0x1a60, 1, 9, 0}, {0x1a75, 8, 230, 0}, {0x1a7f, 1, 220, 0},
+    {0x1ab0, 5, 230, 0}, {0x1ab5, 6, 220, 0}, {0x1abb, 2, 230, 0},
+    {0x1abd, 1, 220, 0}, {0x1abf, 2, 220, 0}, {0x1ac1, 2, 230, 0},
+    {0x1ac3, 2, 220, 0}, {0x1ac5, 5, 230, 0}, {0x1aca, 1, 220, 0},
+    {0x1acb, 4, 230, 0}, {0x1b34, 1, 7, 0}, {0x1b35, 1, 0, 2},
+    {0x1b44, 1, 9, 0}, {0x1b6b, 1, 230, 0}, {0x1b6c, 1, 220, 0},
+    {0x1b6d, 7, 230, 0}, {0x1baa, 2, 9, 0}, {0x1be6, 1, 7, 0},
+    {0x1bf2, 2, 9, 0}, {0x1c37, 1, 7, 0}, {0x1cd0, 3, 230, 0},
+    {0x1cd4, 1, 1, 0}, {0x1cd5, 5, 220, 0}, {0x1cda, 2, 230, 0},
+    {0x1cdc, 4, 220, 0}, {0x1ce0, 1, 230, 0}, {0x1ce2, 7, 1, 0},
+    {0x1ced, 1, 220, 0}, {0x1cf4, 1, 230, 0}, {0x1cf8, 2, 230, 0},
+    {0x1dc0, 2, 230, 0}, {0x1dc2, 1, 220, 0}, {0x1dc3, 7, 230, 0},
+    {0x1dca, 1, 220, 0}, {0x1dcb, 2, 230, 0}, {0x1dcd, 1, 234, 0},
+    {0x1dce, 1, 214, 0}, {0x1dcf, 1, 220, 0}, {0x1dd0, 1, 202, 0},
+    {0x1dd1, 37, 230, 0}, {0x1df6, 1, 232, 0}, {0x1df7, 2, 228, 0},
+    {0x1df9, 1, 220, 0}, {0x1dfa, 1, 218, 0}, {0x1dfb, 1, 230, 0},
+    {0x1dfc, 1, 233, 0}, {0x1dfd, 1, 220, 0}, {0x1dfe, 1, 230, 0},
+    {0x1dff, 1, 220, 0}, {0x1f71, 1, 0, 1}, {0x1f73, 1, 0, 1},
+    {0x1f75, 1, 0, 1}, {0x1f77, 1, 0, 1}, {0x1f79, 1, 0, 1}, {0x1f7b, 1, 0, 1},
+    {0x1f7d, 1, 0, 1}, {0x1fbb, 1, 0, 1}, {0x1fbe, 1, 0, 1}, {0x1fc9, 1, 0, 1},
+    {0x1fcb, 1, 0, 1}, {0x1fd3, 1, 0, 1}, {0x1fdb, 1, 0, 1}, {0x1fe3, 1, 0, 1},
+    {0x1feb, 1, 0, 1}, {0x1fee, 2, 0, 1}, {0x1ff9, 1, 0, 1}, {0x1ffb, 1, 0, 1},
+    {0x1ffd, 1, 0, 1}, {0x2000, 2, 0, 1}, {0x20d0, 2, 230, 0},
+    {0x20d2, 2, 1, 0}, {0x20d4, 4, 230, 0}, {0x20d8, 3, 1, 0},
+    {0x20db, 2, 230, 0}, {0x20e1, 1, 230, 0}, {0x20e5, 2, 1, 0},
+    {0x20e7, 1, 230, 0}, {0x20e8, 1, 220, 0}, {0x20e9, 1, 230, 0},
+    {0x20ea, 2, 1, 0}, {0x20ec, 4, 220, 0}, {0x20f0, 1, 230, 0},
+    {0x2126, 1, 0, 1}, {0x212a, 2, 0, 1}, {0x2329, 2, 0, 1}, {0x2adc, 1, 0, 1},
+    {0x2cef, 3, 230, 0}, {0x2d7f, 1, 9, 0}, {0x2de0, 32, 230, 0},
+    {0x302a, 1, 218, 0}, {0x302b, 1, 228, 0}, {0x302c, 1, 232, 0},
+    {0x302d, 1, 222, 0}, {0x302e, 2, 224, 0}, {0x3099, 2, 8, 2},
+    {0xa66f, 1, 230, 0}, {0xa674, 10, 230, 0}, {0xa69e, 2, 230, 0},
+    {0xa6f0, 2, 230, 0}, {0xa806, 1, 9, 0}, {0xa82c, 1, 9, 0},
+    {0xa8c4, 1, 9, 0}, {0xa8e0, 18, 230, 0}, {0xa92b, 3, 220, 0},
+    {0xa953, 1, 9, 0}, {0xa9b3, 1, 7, 0}, {0xa9c0, 1, 9, 0},
+    {0xaab0, 1, 230, 0}, {0xaab2, 2, 230, 0}, {0xaab4, 1, 220, 0},
+    {0xaab7, 2, 230, 0}, {0xaabe, 2, 230, 0}, {0xaac1, 1, 230, 0},
+    {0xaaf6, 1, 9, 0}, {0xabed, 1, 9, 0}, {0xf900, 270, 0, 1},
+    {0xfa10, 1, 0, 1}, {0xfa12, 1, 0, 1}, {0xfa15, 10, 0, 1}, {0xfa20, 1, 0, 1},
+    {0xfa22, 1, 0, 1}, {0xfa25, 2, 0, 1}, {0xfa2a, 68, 0, 1},
+    {0xfa70, 106, 0, 1}, {0xfb1d, 1, 0, 1}, {0xfb1e, 1, 26, 0},
+    {0xfb1f, 1, 0, 1}, {0xfb2a, 13, 0, 1}, {0xfb38, 5, 0, 1}, {0xfb3e, 1, 0, 1},
+    {0xfb40, 2, 0, 1}, {0xfb43, 2, 0, 1}, {0xfb46, 9, 0, 1},
+    {0xfe20, 7, 230, 0}, {0xfe27, 7, 220, 0}, {0xfe2e, 2, 230, 0},
+    {0x101fd, 1, 220, 0}, {0x102e0, 1, 220, 0}, {0x10376, 5, 230, 0},
+    {0x10a0d, 1, 220, 0}, {0x10a0f, 1, 230, 0}, {0x10a38, 1, 230, 0},
+    {0x10a39, 1, 1, 0}, {0x10a3a, 1, 220, 0}, {0x10a3f, 1, 9, 0},
+    {0x10ae5, 1, 230, 0}, {0x10ae6, 1, 220, 0}, {0x10d24, 4, 230, 0},
+    {0x10eab, 2, 230, 0}, {0x10f46, 2, 220, 0}, {0x10f48, 3, 230, 0},
+    {0x10f4b, 1, 220, 0}, {0x10f4c, 1, 230, 0}, {0x10f4d, 4, 220, 0},
+    {0x10f82, 1, 230, 0}, {0x10f83, 1, 220, 0}, {0x10f84, 1, 230, 0},
+    {0x10f85, 1, 220, 0}, {0x11046, 1, 9, 0}, {0x11070, 1, 9, 0},
+    {0x1107f, 1, 9, 0}, {0x110b9, 1, 9, 0}, {0x110ba, 1, 7, 2},
+    {0x11100, 3, 230, 0}, {0x11127, 1, 0, 2}, {0x11133, 2, 9, 0},
+    {0x11173, 1, 7, 0}, {0x111c0, 1, 9, 0}, {0x111ca, 1, 7, 0},
+    {0x11235, 1, 9, 0}, {0x11236, 1, 7, 0}, {0x112e9, 1, 7, 0},
+    {0x112ea, 1, 9, 0}, {0x1133b, 2, 7, 0}, {0x1133e, 1, 0, 2},
+    {0x1134d, 1, 9, 0}, {0x11357, 1, 0, 2}, {0x11366, 7, 230, 0},
+    {0x11370, 5, 230, 0}, {0x11442, 1, 9, 0}, {0x11446, 1, 7, 0},
+    {0x1145e, 1, 230, 0}, {0x114b0, 1, 0, 2}, {0x114ba, 1, 0, 2},
+    {0x114bd, 1, 0, 2}, {0x114c2, 1, 9, 0}, {0x114c3, 1, 7, 0},
+    {0x115af, 1, 0, 2}, {0x115bf, 1, 9, 0}, {0x115c0, 1, 7, 0},
+    {0x1163f, 1, 9, 0}, {0x116b6, 1, 9, 0}, {0x116b7, 1, 7, 0},
+    {0x1172b, 1, 9, 0}, {0x11839, 1, 9, 0}, {0x1183a, 1, 7, 0},
+    {0x11930, 1, 0, 2}, {0x1193d, 2, 9, 0}, {0x11943, 1, 7, 0},
+    {0x119e0, 1, 9, 0}, {0x11a34, 1, 9, 0}, {0x11a47, 1, 9, 0},
+    {0x11a99, 1, 9, 0}, {0x11c3f, 1, 9, 0}, {0x11d42, 1, 7, 0},
+    {0x11d44, 2, 9, 0}, {0x11d97, 1, 9, 0}, {0x16af0, 5, 1, 0},
+    {0x16b30, 7, 230, 0}, {0x16ff0, 2, 6, 0}, {0x1bc9e, 1, 1, 0},
+    {0x1d15e, 7, 0, 1}, {0x1d165, 2, 216, 0}, {0x1d167, 3, 1, 0},
+    {0x1d16d, 1, 226, 0}, {0x1d16e, 5, 216, 0}, {0x1d17b, 8, 220, 0},
+    {0x1d185, 5, 230, 0}, {0x1d18a, 2, 220, 0}, {0x1d1aa, 4, 230, 0},
+    {0x1d1bb, 6, 0, 1}, {0x1d242, 3, 230, 0}, {0x1e000, 7, 230, 0},
+    {0x1e008, 17, 230, 0}, {0x1e01b, 7, 230, 0}, {0x1e023, 2, 230, 0},
+    {0x1e026, 5, 230, 0}, {0x1e130, 7, 230, 0}, {0x1e2ae, 1, 230, 0},
+    {0x1e2ec, 4, 230, 0}, {0x1e8d0, 7, 220, 0}, {0x1e944, 6, 230, 0},
+    {0x1e94a, 1, 7, 0}, {0x2f800, 542, 0, 1}};
+
+} // namespace unicode_normalization
+} // namespace tables
+} // unnamed namespace
+} // namespace simdutf
+
+#endif // SIMDUTF_UNICODE_NORMALIZATION_TABLES_H
@@ -0,0 +1,149 @@
+#ifndef SIMDUTF_UNICODE_WIDTH_TABLES_H
+#define SIMDUTF_UNICODE_WIDTH_TABLES_H
+#include <cstdint>
+
+// This file is generated by scripts/unicode_tables.py, do not edit.
+// Display widths from EastAsianWidth.txt and UnicodeData.txt.
+
+namespace simdutf {
+namespace {
+namespace tables {
+namespace unicode_width {
+
+// Code points below this value have width 1, except the control
+// characters which have width 0.
+constexpr uint32_t first_table_code_point = 0x300;
+
+// All the code points in this range have width 2.
+constexpr uint32_t first_wide_block_code_point = 0x5000;
+constexpr uint32_t last_wide_block_code_point = 0x9fff;
+
+// Code points first, ..., first + count - 1 have the given width.
+struct width_range {
+  uint32_t first;
+  uint16_t count;
+  uint16_t width;
+};
+
+// sorted by first, code points not listed have width 1
+constexpr width_range width_ranges[471] = {
+    {0x300, 112, 0}, {0x483, 7, 0}, {0x591, 45, 0}, {0x5bf, 1, 0},
+    {0x5c1, 2, 0}, {0x5c4, 2, 0}, {0x5c7, 1, 0}, {0x600, 6, 0}, {0x610, 11, 0},
+    {0x61c, 1, 0}, {0x64b, 21, 0}, {0x670, 1, 0}, {0x6d6, 8, 0}, {0x6df, 6, 0},
+    {0x6e7, 2, 0}, {0x6ea, 4, 0}, {0x70f, 1, 0}, {0x711, 1, 0}, {0x730, 27, 0},
+    {0x7a6, 11, 0}, {0x7eb, 9, 0}, {0x7fd, 1, 0}, {0x816, 4, 0}, {0x81b, 9, 0},
+    {0x825, 3, 0}, {0x829, 5, 0}, {0x859, 3, 0}, {0x890, 2, 0}, {0x898, 8, 0},
+    {0x8ca, 57, 0}, {0x93a, 1, 0}, {0x93c, 1, 0}, {0x941, 8, 0}, {0x94d, 1, 0},
+    {0x951, 7, 0}, {0x962, 2, 0}, {0x981, 1, 0}, {0x9bc, 1, 0}, {0x9c1, 4, 0},
+    {0x9cd, 1, 0}, {0x9e2, 2, 0}, {0x9fe, 1, 0}, {0xa01, 2, 0}, {0xa3c, 1, 0},
+    {0xa41, 2, 0}, {0xa47, 2, 0}, {0xa4b, 3, 0}, {0xa51, 1, 0}, {0xa70, 2, 0},
+    {0xa75, 1, 0}, {0xa81, 2, 0}, {0xabc, 1, 0}, {0xac1, 5, 0}, {0xac7, 2, 0},
+    {0xacd, 1, 0}, {0xae2, 2, 0}, {0xafa, 6, 0}, {0xb01, 1, 0}, {0xb3c, 1, 0},
+    {0xb3f, 1, 0}, {0xb41, 4, 0}, {0xb4d, 1, 0}, {0xb55, 2, 0}, {0xb62, 2, 0},
+    {0xb82, 1, 0}, {0xbc0, 1, 0}, {0xbcd, 1, 0}, {0xc00, 1, 0}, {0xc04, 1, 0},
+    {0xc3c, 1, 0}, {0xc3e, 3, 0}, {0xc46, 3, 0}, {0xc4a, 4, 0}, {0xc55, 2, 0},
+    {0xc62, 2, 0}, {0xc81, 1, 0}, {0xcbc, 1, 0}, {0xcbf, 1, 0}, {0xcc6, 1, 0},
+    {0xccc, 2, 0}, {0xce2, 2, 0}, {0xd00, 2, 0}, {0xd3b, 2, 0}, {0xd41, 4, 0},
+    {0xd4d, 1, 0}, {0xd62, 2, 0}, {0xd81, 1, 0}, {0xdca, 1, 0}, {0xdd2, 3, 0},
+    {0xdd6, 1, 0}, {0xe31, 1, 0}, {0xe34, 7, 0}, {0xe47, 8, 0}, {0xeb1, 1, 0},
+    {0xeb4, 9, 0}, {0xec8, 6, 0}, {0xf18, 2, 0}, {0xf35, 1, 0}, {0xf37, 1, 0},
+    {0xf39, 1, 0}, {0xf71, 14, 0}, {0xf80, 5, 0}, {0xf86, 2, 0}, {0xf8d, 11, 0},
+    {0xf99, 36, 0}, {0xfc6, 1, 0}, {0x102d, 4, 0}, {0x1032, 6, 0},
+    {0x1039, 2, 0}, {0x103d, 2, 0}, {0x1058, 2, 0}, {0x105e, 3, 0},
+    {0x1071, 4, 0}, {0x1082, 1, 0}, {0x1085, 2, 0}, {0x108d, 1, 0},
+    {0x109d, 1, 0}, {0x1100, 96, 2}, {0x1160, 160, 0}, {0x135d, 3, 0},
+    {0x1712, 3, 0}, {0x1732, 2, 0}, {0x1752, 2, 0}, {0x1772, 2, 0},
+    {0x17b4, 2, 0}, {0x17b7, 7, 0}, {0x17c6, 1, 0}, {0x17c9, 11, 0},
+    {0x17dd, 1, 0}, {0x180b, 5, 0}, {0x1885, 2, 0}, {0x18a9, 1, 0},
+    {0x1920, 3, 0}, {0x1927, 2, 0}, {0x1932, 1, 0}, {0x1939, 3, 0},
+    {0x1a17, 2, 0}, {0x1a1b, 1, 0}, {0x1a56, 1, 0}, {0x1a58, 7, 0},
+    {0x1a60, 1, 0}, {0x1a62, 1, 0}, {0x1a65, 8, 0}, {0x1a73, 10, 0},
+    {0x1a7f, 1, 0}, {0x1ab0, 31, 0}, {0x1b00, 4, 0}, {0x1b34, 1, 0},
+    {0x1b36, 5, 0}, {0x1b3c, 1, 0}, {0x1b42, 1, 0}, {0x1b6b, 9, 0},
+    {0x1b80, 2, 0}, {0x1ba2, 4, 0}, {0x1ba8, 2, 0}, {0x1bab, 3, 0},
+    {0x1be6, 1, 0}, {0x1be8, 2, 0}, {0x1bed, 1, 0}, {0x1bef, 3, 0},
+    {0x1c2c, 8, 0}, {0x1c36, 2, 0}, {0x1cd0, 3, 0}, {0x1cd4, 13, 0},
+    {0x1ce2, 7, 0}, {0x1ced, 1, 0}, {0x1cf4, 1, 0}, {0x1cf8, 2, 0},
+    {0x1dc0, 64, 0}, {0x200b, 5, 0}, {0x202a, 5, 0}, {0x2060, 5, 0},
+    {0x2066, 10, 0}, {0x20d0, 33, 0}, {0x231a, 2, 2}, {0x2329, 2, 2},
+    {0x23e9, 4, 2}, {0x23f0, 1, 2}, {0x23f3, 1, 2}, {0x25fd, 2, 2},
+    {0x2614, 2, 2}, {0x2648, 12, 2}, {0x267f, 1, 2}, {0x2693, 1, 2},
+    {0x26a1, 1, 2}, {0x26aa, 2, 2}, {0x26bd, 2, 2}, {0x26c4, 2, 2},
+    {0x26ce, 1, 2}, {0x26d4, 1, 2}, {0x26ea, 1, 2}, {0x26f2, 2, 2},
+    {0x26f5, 1, 2}, {0x26fa, 1, 2}, {0x26fd, 1, 2}, {0x2705, 1, 2},
+    {0x270a, 2, 2}, {0x2728, 1, 2}, {0x274c, 1, 2}, {0x274e, 1, 2},
+    {0x2753, 3, 2}, {0x2757, 1, 2}, {0x2795, 3, 2}, {0x27b0, 1, 2},
+    {0x27bf, 1, 2}, {0x2b1b, 2, 2}, {0x2b50, 1, 2}, {0x2b55, 1, 2},
+    {0x2cef, 3, 0}, {0x2d7f, 1, 0}, {0x2de0, 32, 0}, {0x2e80, 26, 2},
+    {0x2e9b, 89, 2}, {0x2f00, 214, 2}, {0x2ff0, 12, 2}, {0x3000, 42, 2},
+    {0x302a, 4, 0}, {0x302e, 17, 2}, {0x3041, 86, 2}, {0x3099, 2, 0},
+    {0x309b, 101, 2}, {0x3105, 43, 2}, {0x3131, 94, 2}, {0x3190, 84, 2},
+    {0x31f0, 47, 2}, {0x3220, 40, 2}, {0x3250, 7024, 2}, {0x4e00, 22157, 2},
+    {0xa490, 55, 2}, {0xa66f, 4, 0}, {0xa674, 10, 0}, {0xa69e, 2, 0},
+    {0xa6f0, 2, 0}, {0xa802, 1, 0}, {0xa806, 1, 0}, {0xa80b, 1, 0},
+    {0xa825, 2, 0}, {0xa82c, 1, 0}, {0xa8c4, 2, 0}, {0xa8e0, 18, 0},
+    {0xa8ff, 1, 0}, {0xa926, 8, 0}, {0xa947, 11, 0}, {0xa960, 29, 2},
+    {0xa980, 3, 0}, {0xa9b3, 1, 0}, {0xa9b6, 4, 0}, {0xa9bc, 2, 0},
+    {0xa9e5, 1, 0}, {0xaa29, 6, 0}, {0xaa31, 2, 0}, {0xaa35, 2, 0},
+    {0xaa43, 1, 0}, {0xaa4c, 1, 0}, {0xaa7c, 1, 0}, {0xaab0, 1, 0},
+    {0xaab2, 3, 0}, {0xaab7, 2, 0}, {0xaabe, 2, 0}, {0xaac1, 1, 0},
+    {0xaaec, 2, 0}, {0xaaf6, 1, 0}, {0xabe5, 1, 0}, {0xabe8, 1, 0},
+    {0xabed, 1, 0}, {0xac00, 11172, 2}, {0xd7b0, 80, 0}, {0xf900, 512, 2},
+    {0xfb1e, 1, 0}, {0xfe00, 16, 0}, {0xfe10, 10, 2}, {0xfe20, 16, 0},
+    {0xfe30, 35, 2}, {0xfe54, 19, 2}, {0xfe68, 4, 2}, {0xfeff, 1, 0},
+    {0xff01, 96, 2}, {0xffe0, 7, 2}, {0xfff9, 3, 0}, {0x101fd, 1, 0},
+    {0x102e0, 1, 0}, {0x10376, 5, 0}, {0x10a01, 3, 0}, {0x10a05, 2, 0},
+    {0x10a0c, 4, 0}, {0x10a38, 3, 0}, {0x10a3f, 1, 0}, {0x10ae5, 2, 0},
+    {0x10d24, 4, 0}, {0x10eab, 2, 0}, {0x10f46, 11, 0}, {0x10f82, 4, 0},
+    {0x11001, 1, 0}, {0x11038, 15, 0}, {0x11070, 1, 0}, {0x11073, 2, 0},
+    {0x1107f, 3, 0}, {0x110b3, 4, 0}, {0x110b9, 2, 0}, {0x110bd, 1, 0},
+    {0x110c2, 1, 0}, {0x110cd, 1, 0}, {0x11100, 3, 0}, {0x11127, 5, 0},
+    {0x1112d, 8, 0}, {0x11173, 1, 0}, {0x11180, 2, 0}, {0x111b6, 9, 0},
+    {0x111c9, 4, 0}, {0x111cf, 1, 0}, {0x1122f, 3, 0}, {0x11234, 1, 0},
+    {0x11236, 2, 0}, {0x1123e, 1, 0}, {0x112df, 1, 0}, {0x112e3, 8, 0},
+    {0x11300, 2, 0}, {0x1133b, 2, 0}, {0x11340, 1, 0}, {0x11366, 7, 0},
+    {0x11370, 5, 0}, {0x11438, 8, 0}, {0x11442, 3, 0}, {0x11446, 1, 0},
+    {0x1145e, 1, 0}, {0x114b3, 6, 0}, {0x114ba, 1, 0}, {0x114bf, 2, 0},
+    {0x114c2, 2, 0}, {0x115b2, 4, 0}, {0x115bc, 2, 0}, {0x115bf, 2, 0},
+    {0x115dc, 2, 0}, {0x11633, 8, 0}, {0x1163d, 1, 0}, {0x1163f, 2, 0},
+    {0x116ab, 1, 0}, {0x116ad, 1, 0}, {0x116b0, 6, 0}, {0x116b7, 1, 0},
+    {0x1171d, 3, 0}, {0x11722, 4, 0}, {0x11727, 5, 0}, {0x1182f, 9, 0},
+    {0x11839, 2, 0}, {0x1193b, 2, 0}, {0x1193e, 1, 0}, {0x11943, 1, 0},
+    {0x119d4, 4, 0}, {0x119da, 2, 0}, {0x119e0, 1, 0}, {0x11a01, 10, 0},
+    {0x11a33, 6, 0}, {0x11a3b, 4, 0}, {0x11a47, 1, 0}, {0x11a51, 6, 0},
+    {0x11a59, 3, 0}, {0x11a8a, 13, 0}, {0x11a98, 2, 0}, {0x11c30, 7, 0},
+    {0x11c38, 6, 0}, {0x11c3f, 1, 0}, {0x11c92, 22, 0}, {0x11caa, 7, 0},
+    {0x11cb2, 2, 0}, {0x11cb5, 2, 0}, {0x11d31, 6, 0}, {0x11d3a, 1, 0},
+    {0x11d3c, 2, 0}, {0x11d3f, 7, 0}, {0x11d47, 1, 0}, {0x11d90, 2, 0},
+    {0x11d95, 1, 0}, {0x11d97, 1, 0}, {0x11ef3, 2, 0}, {0x13430, 9, 0},
+    {0x16af0, 5, 0}, {0x16b30, 7, 0}, {0x16f4f, 1, 0}, {0x16f8f, 4, 0},
+    {0x16fe0, 4, 2}, {0x16fe4, 1, 0}, {0x16ff0, 2, 2}, {0x17000, 6136, 2},
+    {0x18800, 1238, 2}, {0x18d00, 9, 2}, {0x1aff0, 4, 2}, {0x1aff5, 7, 2},
+    {0x1affd, 2, 2}, {0x1b000, 291, 2}, {0x1b150, 3, 2}, {0x1b164, 4, 2},
+    {0x1b170, 396, 2}, {0x1bc9d, 2, 0}, {0x1bca0, 4, 0}, {0x1cf00, 46, 0},
+    {0x1cf30, 23, 0}, {0x1d167, 3, 0}, {0x1d173, 16, 0}, {0x1d185, 7, 0},
+    {0x1d1aa, 4, 0}, {0x1d242, 3, 0}, {0x1da00, 55, 0}, {0x1da3b, 50, 0},
+    {0x1da75, 1, 0}, {0x1da84, 1, 0}, {0x1da9b, 5, 0}, {0x1daa1, 15, 0},
+    {0x1e000, 7, 0}, {0x1e008, 17, 0}, {0x1e01b, 7, 0}, {0x1e023, 2, 0},
+    {0x1e026, 5, 0}, {0x1e130, 7, 0}, {0x1e2ae, 1, 0}, {0x1e2ec, 4, 0},
+    {0x1e8d0, 7, 0}, {0x1e944, 7, 0}, {0x1f004, 1, 2}, {0x1f0cf, 1, 2},
+    {0x1f18e, 1, 2}, {0x1f191, 10, 2}, {0x1f200, 3, 2}, {0x1f210, 44, 2},
+    {0x1f240, 9, 2}, {0x1f250, 2, 2}, {0x1f260, 6, 2}, {0x1f300, 33, 2},
+    {0x1f32d, 9, 2}, {0x1f337, 70, 2}, {0x1f37e, 22, 2}, {0x1f3a0, 43, 2},
+    {0x1f3cf, 5, 2}, {0x1f3e0, 17, 2}, {0x1f3f4, 1, 2}, {0x1f3f8, 71, 2},
+    {0x1f440, 1, 2}, {0x1f442, 187, 2}, {0x1f4ff, 63, 2}, {0x1f54b, 4, 2},
+    {0x1f550, 24, 2}, {0x1f57a, 1, 2}, {0x1f595, 2, 2}, {0x1f5a4, 1, 2},
+    {0x1f5fb, 85, 2}, {0x1f680, 70, 2}, {0x1f6cc, 1, 2}, {0x1f6d0, 3, 2},
+    {0x1f6d5, 3, 2}, {0x1f6dd, 3, 2}, {0x1f6eb, 2, 2}, {0x1f6f4, 9, 2},
+    {0x1f7e0, 12, 2}, {0x1f7f0, 1, 2}, {0x1f90c, 47, 2}, {0x1f93c, 10, 2},
+    {0x1f947, 185, 2}, {0x1fa70, 5, 2}, {0x1fa78, 5, 2}, {0x1fa80, 7, 2},
+    {0x1fa90, 29, 2}, {0x1fab0, 11, 2}, {0x1fac0, 6, 2}, {0x1fad0, 10, 2},
+    {0x1fae0, 8, 2}, {0x1faf0, 7, 2}, {0x20000, 65534, 2}, {0x30000, 65534, 2},
+    {0xe0001, 1, 0}, {0xe0020, 96, 0}, {0xe0100, 240, 0}};
+
+} // namespace unicode_width
+} // namespace tables
+} // unnamed namespace
+} // namespace simdutf
+
+#endif // SIMDUTF_UNICODE_WIDTH_TABLES_H
@@ -41,6 +41,7 @@ typedef enum simdutf_error_code {
   SIMDUTF_ERROR_BASE64_INPUT_REMAINDER,
   SIMDUTF_ERROR_BASE64_EXTRA_BITS,
   SIMDUTF_ERROR_OUTPUT_BUFFER_TOO_SMALL,
+  SIMDUTF_ERROR_INVALID_XML_CHARACTER,
   SIMDUTF_ERROR_OTHER
 } simdutf_error_code;
 
@@ -64,6 +65,12 @@ typedef enum simdutf_encoding_type {
   SIMDUTF_ENCODING_UTF32_BE = 16
 } simdutf_encoding_type;
 
+typedef enum simdutf_nfc_quick_check_result {
+  SIMDUTF_NFC_QUICK_CHECK_NO = 0,
+  SIMDUTF_NFC_QUICK_CHECK_YES = 1,
+  SIMDUTF_NFC_QUICK_CHECK_MAYBE = 2
+} simdutf_nfc_quick_check_result;
+
 /* Validate UTF-8: returns true iff input is valid UTF-8 */
 bool simdutf_validate_utf8(const char *buf, size_t len);
 
@@ -113,6 +120,40 @@ size_t simdutf_count_utf16le(const char16_t *input, size_t length);
 size_t simdutf_count_utf16be(const char16_t *input, size_t length);
 size_t simdutf_count_utf8(const char *input, size_t length);
 
+/* Case mapping */
+size_t simdutf_to_lower_ascii_utf8(const char *input, size_t length,
+                                   char *output);
+size_t simdutf_to_upper_ascii_utf8(const char *input, size_t length,
+                                   char *output);
+bool simdutf_equals_ignore_case_utf8(const char *input1, size_t length1,
+                                     const char *input2, size_t length2);
+
+/* Normalization quick check */
+simdutf_nfc_quick_check_result simdutf_is_nfc_quick_utf8(const char *input,
+                                                         size_t length);
+simdutf_nfc_quick_check_result
+simdutf_is_nfc_quick_utf16(const char16_t *input, size_t length);
+simdutf_nfc_quick_check_result
+simdutf_is_nfc_quick_utf16le(const char16_t *input, size_t length);
+simdutf_nfc_quick_check_result
+simdutf_is_nfc_quick_utf16be(const char16_t *input, size_t length);
+
+/* Display width */
+size_t simdutf_display_width_utf8(const char *input, size_t length);
+size_t simdutf_display_width_utf16(const char16_t *input, size_t length);
+size_t simdutf_display_width_utf16le(const char16_t *input, size_t length);
+size_t simdutf_display_width_utf16be(const char16_t *input, size_t length);
+
+/* Grapheme clusters */
+size_t simdutf_count_graphemes_utf8(const char *input, size_t length);
+size_t simdutf_next_grapheme_boundary_utf8(const char *input, size_t length);
+
+/* HTML and XML escaping (output needs 6 * length bytes) */
+simdutf_result simdutf_escape_html_utf8(const char *input, size_t length,
+                                        char *output);
+simdutf_result simdutf_escape_xml_utf8(const char *input, size_t length,
+                                       char *output);
+
 /* Length estimators */
 size_t simdutf_utf8_length_from_latin1(const char *input, size_t length);
 size_t simdutf_latin1_length_from_utf8(const char *input, size_t length);
@@ -0,0 +1,465 @@
+#!/usr/bin/env python3
+"""
+Generates the Unicode property tables used by the scalar routines in
+include/simdutf/scalar/.
+
+The script reads the Unicode Character Database (UCD) text files from a
+directory. They can be downloaded from https://www.unicode.org/Public/UCD/latest/
+(emoji-data.txt lives in the emoji/ subdirectory).
+
+Usage:
+    python3 scripts/unicode_tables.py <ucd-directory>
+
+The generated headers are written to include/simdutf/.
+"""
+
+import os
+import re
+import sys
+
+SCRIPTPATH = os.path.dirname(os.path.abspath(__file__))
+PROJECTPATH = os.path.dirname(SCRIPTPATH)
+OUTPUTPATH = os.path.join(PROJECTPATH, "include", "simdutf")
+
+
+def parse_code_points(field):
+    """Parses '0041' or '0041..005A' into an inclusive range."""
+    field = field.strip()
+    if ".." in field:
+        first, last = field.split("..")
+        return int(first, 16), int(last, 16)
+    value = int(field, 16)
+    return value, value
+
+
+def read_unicode_data(ucd):
+    """Returns the general category and the simple case mappings."""
+    category = {}
+    upper = {}
+    lower = {}
+    range_start = None
+    with open(os.path.join(ucd, "UnicodeData.txt"), encoding="utf-8") as f:
+        for line in f:
+            fields = line.rstrip("\n").split(";")
+            cp = int(fields[0], 16)
+            if fields[1].endswith(", First>"):
+                range_start = cp
+                continue
+            if fields[1].endswith(", Last>"):
+                for c in range(range_start, cp + 1):
+                    category[c] = fields[2]
+                continue
+            category[cp] = fields[2]
+            if fields[12]:
+                upper[cp] = int(fields[12], 16)
+            if fields[13]:
+                lower[cp] = int(fields[13], 16)
+    return category, upper, lower
+
+
+def read_simple_case_folding(ucd):
+    folding = {}
+    with open(os.path.join(ucd, "CaseFolding.txt"), encoding="utf-8") as f:
+        for line in f:
+            line = line.split("#")[0].strip()
+            if not line:
+                continue
+            fields = [x.strip() for x in line.split(";")]
+            if fields[1] in ("C", "S"):
+                folding[int(fields[0], 16)] = int(fields[2], 16)
+    return folding
+
+
+def read_combining_classes(ucd):
+    """Returns the non-zero canonical combining classes."""
+    ccc = {}
+    with open(os.path.join(ucd, "UnicodeData.txt"), encoding="utf-8") as f:
+        for line in f:
+            fields = line.split(";")
+            if fields[3] != "0":
+                ccc[int(fields[0], 16)] = int(fields[3])
+    return ccc
+
+
+def read_property_ranges(path, property_name=None):
+    """
+    Reads a UCD file made of 'code points ; value' lines (or
+    'code points ; property ; value' lines when property_name is given) and
+    returns a dictionary from code point to value.
+    """
+    values = {}
+    with open(path, encoding="utf-8") as f:
+        for line in f:
+            line = line.split("#")[0].strip()
+            if not line:
+                continue
+            fields = [x.strip() for x in line.split(";")]
+            if property_name is not None:
+                if fields[1] != property_name:
+                    continue
+                value = fields[2]
+            else:
+                value = fields[1]
+            first, last = parse_code_points(fields[0])
+            for cp in range(first, last + 1):
+                values[cp] = value
+    return values
+
+
+def compress_runs(values, default):
+    """
+    Groups consecutive code points having the same value (other than the
+    default) into runs (first, count, value).
+    """
+    runs = []
+    for cp in sorted(values):
+        value = values[cp]
+        if value == default:
+            continue
+        if runs:
+            first, count, last_value = runs[-1]
+            if first + count == cp and last_value == value and count < 0xFFFF:
+                runs[-1] = (first, count + 1, value)
+                continue
+        runs.append((cp, 1, value))
+    return runs
+
+
+def compress_mapping(mapping, first_code_point):
+    """
+    Groups the mapping into runs (first, count, stride, delta) such that
+    first + k * stride maps to first + k * stride + delta for k < count.
+    """
+    runs = []
+    for cp, target in sorted(mapping.items()):
+        if cp < first_code_point:
+            continue
+        delta = target - cp
+        if runs:
+            first, count, stride, last_delta = runs[-1]
+            last = first + (count - 1) * stride
+            if last_delta == delta and count < 0xffff:
+                if count == 1 and cp - last in (1, 2):
+                    runs[-1] = (first, 2, cp - last, delta)
+                    continue
+                if count > 1 and cp - last == stride:
+                    runs[-1] = (first, count + 1, stride, delta)
+                    continue
+        runs.append((cp, 1, 1, delta))
+    return runs
+
+
+def format_array(values, indent="    ", width=80):
+    """Formats the values of a braced initializer, clang-format style."""
+    lines = []
+    line = indent
+    for i, v in enumerate(values):
+        item = v + ("," if i + 1 < len(values) else "};")
+        if len(line) + len(item) > width and line.strip():
+            lines.append(line.rstrip())
+            line = indent
+        line += item + " "
+    lines.append(line.rstrip())
+    return "\n".join(lines)
+
+
+def header_prologue(guard, description):
+    return (
+        f"#ifndef {guard}\n"
+        f"#define {guard}\n"
+        "#include <cstdint>\n"
+        "\n"
+        "// This file is generated by scripts/unicode_tables.py, do not edit.\n"
+        f"// {description}\n"
+        "\n"
+    )
+
+
+def generate_case_tables(ucd):
+    _, upper, lower = read_unicode_data(ucd)
+    folding = read_simple_case_folding(ucd)
+
+    out = header_prologue(
+        "SIMDUTF_UNICODE_CASE_TABLES_H",
+        "Simple (1:1) case mappings from UnicodeData.txt and CaseFolding.txt.",
+    )
+    out += "namespace simdutf {\nnamespace {\nnamespace tables {\n"
+    out += "namespace unicode_case {\n\n"
+    out += (
+        "// Code points first, first + stride, ..., first + (count - 1) * stride\n"
+        "// map to the code point plus delta.\n"
+        "struct case_range {\n"
+        "  uint32_t first;\n"
+        "  uint16_t count;\n"
+        "  uint16_t stride;\n"
+        "  int32_t delta;\n"
+        "};\n\n"
+    )
+    for name, mapping in (
+        ("lower", lower),
+        ("upper", upper),
+        ("fold", folding),
+    ):
+        latin1 = [str(mapping.get(cp, cp)) for cp in range(256)]
+        out += f"// {name} mapping for U+0000..U+00FF\n"
+        out += f"constexpr uint16_t latin1_{name}[256] = {{\n"
+        out += format_array(latin1) + "\n\n"
+        runs = compress_mapping(mapping, 256)
+        out += f"// {name} mapping for U+0100 and above, sorted by first\n"
+        out += f"constexpr case_range {name}_ranges[{len(runs)}] = {{\n"
+        out += (
+            format_array(
+                [
+                    "{0x%x, %d, %d, %d}" % (first, count, stride, delta)
+                    for (first, count, stride, delta) in runs
+                ]
+            )
+            + "\n\n"
+        )
+    out += "} // namespace unicode_case\n} // namespace tables\n"
+    out += "} // unnamed namespace\n} // namespace simdutf\n\n"
+    out += "#endif // SIMDUTF_UNICODE_CASE_TABLES_H\n"
+    return out
+
+
+def generate_normalization_tables(ucd):
+    ccc = read_combining_classes(ucd)
+    quick_check = read_property_ranges(
+        os.path.join(ucd, "DerivedNormalizationProps.txt"), "NFC_QC"
+    )
+    qc_values = {"Y": 0, "N": 1, "M": 2}
+    properties = {}
+    for cp in set(ccc) | set(quick_check):
+        properties[cp] = (ccc.get(cp, 0), qc_values[quick_check.get(cp, "Y")])
+    runs = compress_runs(properties, (0, 0))
+    first_code_point = runs[0][0]
+
+    out = header_prologue(
+        "SIMDUTF_UNICODE_NORMALIZATION_TABLES_H",
+        "Canonical_Combining_Class and NFC_Quick_Check from UnicodeData.txt and\n"
+        "// DerivedNormalizationProps.txt.",
+    )
+    out += "namespace simdutf {\nnamespace {\nnamespace tables {\n"
+    out += "namespace unicode_normalization {\n\n"
+    out += (
+        "// Code points below this value have a zero combining class and are\n"
+        "// NFC_Quick_Check=Yes.\n"
+        f"constexpr uint32_t first_nfc_relevant_code_point = 0x{first_code_point:x};\n\n"
+        "enum quick_check_value : uint8_t { qc_yes = 0, qc_no = 1, qc_maybe = 2 };\n\n"
+        "// Code points first, ..., first + count - 1 have the given canonical\n"
+        "// combining class and NFC_Quick_Check value.\n"
+        "struct nfc_range {\n"
+        "  uint32_t first;\n"
+        "  uint16_t count;\n"
+        "  uint8_t ccc;\n"
+        "  uint8_t quick_check;\n"
+        "};\n\n"
+    )
+    out += "// sorted by first, code points not listed are ccc=0 and NFC_QC=Yes\n"
+    out += f"constexpr nfc_range nfc_ranges[{len(runs)}] = {{\n"
+    out += (
+        format_array(
+            [
+                "{0x%x, %d, %d, %d}" % (first, count, value[0], value[1])
+                for (first, count, value) in runs
+            ]
+        )
+        + "\n\n"
+    )
+    out += "} // namespace unicode_normalization\n} // namespace tables\n"
+    out += "} // unnamed namespace\n} // namespace simdutf\n\n"
+    out += "#endif // SIMDUTF_UNICODE_NORMALIZATION_TABLES_H\n"
+    return out
+
+
+def generate_width_tables(ucd):
+    category, _, _ = read_unicode_data(ucd)
+    east_asian_width = read_property_ranges(os.path.join(ucd, "EastAsianWidth.txt"))
+    width = {}
+    for cp, value in east_asian_width.items():
+        if value in ("W", "F"):
+            width[cp] = 2
+    # Nonspacing and enclosing marks, format characters (except the soft
+    # hyphen) and the Hangul Jamo medial vowels and final consonants occupy
+    # no column.
+    for cp, gc in category.items():
+        if gc in ("Mn", "Me", "Cf") and cp != 0xAD:
+            width[cp] = 0
+    for cp in list(range(0x1160, 0x1200)) + list(range(0xD7B0, 0xD800)):
+        width[cp] = 0
+    # The code points below U+0300 are handled without the table.
+    for cp in range(0x300):
+        assert width.get(cp, 1) == 1 or cp == 0xAD or cp < 0xA0
+    runs = compress_runs({cp: w for cp, w in width.items() if cp >= 0x300}, 1)
+    # U+5000..U+9FFF (UTF-8 leading bytes 0xE5 to 0xE9) are all wide.
+    wide_first, wide_last = 0x5000, 0x9FFF
+    for cp in range(wide_first, wide_last + 1):
+        assert width.get(cp, 1) == 2
+
+    out = header_prologue(
+        "SIMDUTF_UNICODE_WIDTH_TABLES_H",
+        "Display widths from EastAsianWidth.txt and UnicodeData.txt.",
+    )
+    out += "namespace simdutf {\nnamespace {\nnamespace tables {\n"
+    out += "namespace unicode_width {\n\n"
+    out += (
+        "// Code points below this value have width 1, except the control\n"
+        "// characters which have width 0.\n"
+        f"constexpr uint32_t first_table_code_point = 0x{runs[0][0]:x};\n\n"
+        "// All the code points in this range have width 2.\n"
+        f"constexpr uint32_t first_wide_block_code_point = 0x{wide_first:x};\n"
+        f"constexpr uint32_t last_wide_block_code_point = 0x{wide_last:x};\n\n"
+        "// Code points first, ..., first + count - 1 have the given width.\n"
+        "struct width_range {\n"
+        "  uint32_t first;\n"
+        "  uint16_t count;\n"
+        "  uint16_t width;\n"
+        "};\n\n"
+    )
+    out += "// sorted by first, code points not listed have width 1\n"
+    out += f"constexpr width_range width_ranges[{len(runs)}] = {{\n"
+    out += (
+        format_array(
+            [
+                "{0x%x, %d, %d}" % (first, count, value)
+                for (first, count, value) in runs
+            ]
+        )
+        + "\n\n"
+    )
+    out += "} // namespace unicode_width\n} // namespace tables\n"
+    out += "} // unnamed namespace\n} // namespace simdutf\n\n"
+    out += "#endif // SIMDUTF_UNICODE_WIDTH_TABLES_H\n"
+    return out
+
+
+GRAPHEME_BREAK_VALUES = [
+    "Other",
+    "CR",
+    "LF",
+    "Control",
+    "Extend",
+    "ZWJ",
+    "Regional_Indicator",
+    "Prepend",
+    "SpacingMark",
+    "L",
+    "V",
+    "T",
+    "LV",
+    "LVT",
+    "Extended_Pictographic",
+]
+
+
+def grapheme_break_name(value):
+    # SpacingMark -> spacing_mark, Regional_Indicator -> regional_indicator
+    return re.sub(r"(?<=[a-z])([A-Z])", r"_\1", value).lower()
+
+
+def generate_grapheme_tables(ucd):
+    properties = read_property_ranges(os.path.join(ucd, "GraphemeBreakProperty.txt"))
+    # Extended_Pictographic is a separate property, but it only applies to
+    # code points with Grapheme_Cluster_Break=Other.
+    for cp in read_property_ranges(os.path.join(ucd, "emoji-data.txt")):
+        assert cp not in properties
+        properties[cp] = "Extended_Pictographic"
+    # The Hangul syllables alternate between LV and LVT: the table lists them
+    # as LVT and the LV syllables are recognized arithmetically.
+    hangul_first, hangul_count = 0xAC00, 11172
+    for cp in range(hangul_first, hangul_first + hangul_count):
+        is_lv = (cp - hangul_first) % 28 == 0
+        assert properties[cp] == ("LV" if is_lv else "LVT")
+        properties[cp] = "LVT"
+    runs = compress_runs(properties, "Other")
+
+    # Code points that never join with their neighbours (except CR LF). Those
+    # below U+0300 and the blocks with the UTF-8 leading bytes 0xCE..0xD1
+    # (Greek and Cyrillic) and 0xE4..0xE9 (CJK) are all simple.
+    def simple(cp):
+        return properties.get(cp, "Other") in (
+            "Other",
+            "CR",
+            "LF",
+            "Control",
+            "Extended_Pictographic",
+        )
+
+    first_complex = min(cp for cp in properties if not simple(cp))
+    assert first_complex == 0x300
+    simple_blocks = [(0x380, 0x47F), (0x4000, 0x9FFF)]
+    for first, last in simple_blocks:
+        assert all(simple(cp) for cp in range(first, last + 1))
+
+    out = header_prologue(
+        "SIMDUTF_UNICODE_GRAPHEME_TABLES_H",
+        "Grapheme_Cluster_Break from GraphemeBreakProperty.txt and\n"
+        "// Extended_Pictographic from emoji-data.txt.",
+    )
+    out += "namespace simdutf {\nnamespace {\nnamespace tables {\n"
+    out += "namespace unicode_grapheme {\n\n"
+    out += "enum grapheme_break : uint8_t {\n"
+    out += "".join(
+        f"  gb_{grapheme_break_name(value)} = {index},\n"
+        for index, value in enumerate(GRAPHEME_BREAK_VALUES)
+    )
+    out += "};\n\n"
+    out += (
+        "// Code points below this value never join with their neighbours,\n"
+        "// except CR LF.\n"
+        f"constexpr uint32_t first_complex_code_point = 0x{first_complex:x};\n\n"
+        "// The Hangul syllables are listed as LVT; the ones at a multiple of 28\n"
+        "// from the first one are LV.\n"
+        f"constexpr uint32_t first_hangul_syllable = 0x{hangul_first:x};\n"
+        f"constexpr uint32_t hangul_syllable_count = {hangul_count};\n\n"
+        "// The code points in these ranges never join with their neighbours.\n"
+        f"constexpr uint32_t first_simple_two_byte_code_point = 0x{simple_blocks[0][0]:x};\n"
+        f"constexpr uint32_t last_simple_two_byte_code_point = 0x{simple_blocks[0][1]:x};\n"
+        f"constexpr uint32_t first_simple_three_byte_code_point = 0x{simple_blocks[1][0]:x};\n"
+        f"constexpr uint32_t last_simple_three_byte_code_point = 0x{simple_blocks[1][1]:x};\n\n"
+        "// Code points first, ..., first + count - 1 have the given property.\n"
+        "struct grapheme_range {\n"
+        "  uint32_t first;\n"
+        "  uint16_t count;\n"
+        "  grapheme_break property;\n"
+        "};\n\n"
+    )
+    out += "// sorted by first, code points not listed are Other\n"
+    out += f"constexpr grapheme_range grapheme_ranges[{len(runs)}] = {{\n"
+    out += (
+        format_array(
+            [
+                "{0x%x, %d, gb_%s}" % (first, count, grapheme_break_name(value))
+                for (first, count, value) in runs
+            ]
+        )
+        + "\n\n"
+    )
+    out += "} // namespace unicode_grapheme\n} // namespace tables\n"
+    out += "} // unnamed namespace\n} // namespace simdutf\n\n"
+    out += "#endif // SIMDUTF_UNICODE_GRAPHEME_TABLES_H\n"
+    return out
+
+
+GENERATORS = {
+    "unicode_case_tables.h": generate_case_tables,
+    "unicode_normalization_tables.h": generate_normalization_tables,
+    "unicode_width_tables.h": generate_width_tables,
+    "unicode_grapheme_tables.h": generate_grapheme_tables,
+}
+
+
+def main():
+    if len(sys.argv) != 2:
+        print(__doc__)
+        sys.exit(1)
+    ucd = sys.argv[1]
+    for filename, generator in GENERATORS.items():
+        path = os.path.join(OUTPUTPATH, filename)
+        with open(path, "w", encoding="utf-8") as f:
+            f.write(generator(ucd))
+        print(f"wrote {path}")
+
+
+if __name__ == "__main__":
+    main()
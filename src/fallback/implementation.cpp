@@ -431,8 +431,84 @@ simdutf_warn_unused size_t
 implementation::count_utf8(const char *input, size_t length) const noexcept {
   return scalar::utf8::count_code_points(input, length);
 }
+
+simdutf_warn_unused size_t implementation::to_lower_ascii_utf8(
+    const char *input, size_t length, char *output) const noexcept {
+  return scalar::utf8_case::to_lower(input, length, output);
+}
+
+simdutf_warn_unused size_t implementation::to_upper_ascii_utf8(
+    const char *input, size_t length, char *output) const noexcept {
+  return scalar::utf8_case::to_upper(input, length, output);
+}
+
+simdutf_warn_unused bool implementation::equals_ignore_case_utf8(
+    const char *input1, size_t length1, const char *input2,
+    size_t length2) const noexcept {
+  return scalar::utf8_case::equals_ignore_case(input1, length1, input2, length2);
+}
+#endif // SIMDUTF_FEATURE_UTF8
+
+#if SIMDUTF_FEATURE_UTF8
+simdutf_warn_unused nfc_quick_check_result
+implementation::is_nfc_quick_utf8(const char *input,
+                                  size_t length) const noexcept {
+  return scalar::nfc::quick_check_utf8(input, length);
+}
+#endif // SIMDUTF_FEATURE_UTF8
+
+#if SIMDUTF_FEATURE_UTF16
+simdutf_warn_unused nfc_quick_check_result
+implementation::is_nfc_quick_utf16le(const char16_t *input,
+                                     size_t length) const noexcept {
+  return scalar::nfc::quick_check_utf16<endianness::LITTLE>(input, length);
+}
+
+simdutf_warn_unused nfc_quick_check_result
+implementation::is_nfc_quick_utf16be(const char16_t *input,
+                                     size_t length) const noexcept {
+  return scalar::nfc::quick_check_utf16<endianness::BIG>(input, length);
+}
+#endif // SIMDUTF_FEATURE_UTF16
+
+#if SIMDUTF_FEATURE_UTF8
+simdutf_warn_unused size_t
+implementation::display_width_utf8(const char *input,
+                                   size_t length) const noexcept {
+  return scalar::display_width::width_utf8(input, length);
+}
+
+simdutf_warn_unused size_t
+implementation::count_graphemes_utf8(const char *input,
+                                     size_t length) const noexcept {
+  return scalar::grapheme::count_utf8(input, length);
+}
+
+simdutf_warn_unused result implementation::escape_html_utf8(
+    const char *input, size_t length, char *output) const noexcept {
+  return scalar::escape::escape_utf8<false>(input, length, output);
+}
+
+simdutf_warn_unused result implementation::escape_xml_utf8(
+    const char *input, size_t length, char *output) const noexcept {
+  return scalar::escape::escape_utf8<true>(input, length, output);
+}
 #endif // SIMDUTF_FEATURE_UTF8
 
+#if SIMDUTF_FEATURE_UTF16
+simdutf_warn_unused size_t
+implementation::display_width_utf16le(const char16_t *input,
+                                      size_t length) const noexcept {
+  return scalar::display_width::width_utf16<endianness::LITTLE>(input, length);
+}
+
+simdutf_warn_unused size_t
+implementation::display_width_utf16be(const char16_t *input,
+                                      size_t length) const noexcept {
+  return scalar::display_width::width_utf16<endianness::BIG>(input, length);
+}
+#endif // SIMDUTF_FEATURE_UTF16
+
 #if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_LATIN1
 simdutf_warn_unused size_t implementation::latin1_length_from_utf8(
     const char *buf, size_t len) const noexcept {
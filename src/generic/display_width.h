@@ -0,0 +1,109 @@
+namespace simdutf {
+namespace SIMDUTF_IMPLEMENTATION {
+namespace {
+namespace display_width {
+
+#if SIMDUTF_FEATURE_UTF8
+/*
+ * Width of a 64-byte block of UTF-8. The leading bytes are counted as in
+ * count_utf8 and corrected with byte classes:
+ * - the ASCII controls (below 0x20, and 0x7F) have width 0;
+ * - the C1 controls U+0080..U+009F are 0xC2 followed by a byte below 0xA0;
+ * - the leading bytes 0xE5..0xE9 start the CJK ideographs U+5000..U+9FFF,
+ *   which all have width 2;
+ * - the other leading bytes at or above 0xCC (U+0300 and up) go through the
+ *   scalar table lookup.
+ * 'pending_c2' carries a 0xC2 byte ending the previous block.
+ */
+simdutf_really_inline size_t block_width(const simd8x64<int8_t> &in,
+                                         const uint8_t *data, size_t length,
+                                         size_t pos, uint64_t &pending_c2) {
+  const uint64_t leading = in.gt(-65);
+  const uint64_t controls = (in.lt(0x20) & ~in.lt(0)) | in.gt(0x7E);
+  const uint64_t c2 = in.gt(-63) & in.lt(-61);
+  const uint64_t c1 = ((c2 << 1) | pending_c2) & in.lt(-96);
+  pending_c2 = c2 >> 63;
+  const uint64_t wide =
+      in.gteq_unsigned(scalar::display_width::first_wide_utf8_byte) &
+      ~in.gteq_unsigned(
+          uint8_t(scalar::display_width::last_wide_utf8_byte + 1));
+  uint64_t other =
+      in.gteq_unsigned(scalar::display_width::first_table_utf8_byte) & ~wide;
+  size_t width = count_ones(leading & ~controls) - count_ones(c1) +
+                 count_ones(wide) - count_ones(other);
+  while (other != 0) {
+    const size_t i = pos + trailing_zeroes(other);
+    width += scalar::display_width::utf8_char_width(data + i, length - i);
+    other &= other - 1;
+  }
+  return width;
+}
+
+size_t generic_display_width_utf8(const char *input, size_t length) {
+  const uint8_t *data = reinterpret_cast<const uint8_t *>(input);
+  size_t width = 0;
+  uint64_t pending_c2 = 0;
+  size_t pos = 0;
+  for (; pos + 64 <= length; pos += 64) {
+    simd8x64<int8_t> in(reinterpret_cast<const int8_t *>(data + pos));
+    width += block_width(in, data, length, pos, pending_c2);
+  }
+  if (pos < length) {
+    // zero bytes are controls: the padding does not contribute to the width
+    int8_t block[64]{};
+    std::memcpy(block, data + pos, length - pos);
+    simd8x64<int8_t> in(block);
+    width += block_width(in, data, length, pos, pending_c2);
+  }
+  return width;
+}
+#endif // SIMDUTF_FEATURE_UTF8
+
+#if SIMDUTF_FEATURE_UTF16
+/*
+ * UTF-16 counterpart of generic_display_width_utf8: the code units in
+ * U+0020..U+007E and U+00A0..U+02FF have width 1, the ones in U+5000..U+9FFF
+ * have width 2, the controls and the low surrogates have width 0. The other
+ * code units (including the high surrogates) go through the scalar lookup.
+ */
+template <endianness big_endian>
+size_t generic_display_width_utf16(const char16_t *input, size_t length) {
+  size_t width = 0;
+  size_t pos = 0;
+  for (; pos + 32 <= length; pos += 32) {
+    simd16x32<uint16_t> in(reinterpret_cast<const uint16_t *>(input + pos));
+    if constexpr (!match_system(big_endian)) {
+      in.swap_bytes();
+    }
+    // two bits per code unit
+    const uint64_t narrow =
+        in.lteq(uint16_t(scalar::display_width::first_table_code_point - 1));
+    const uint64_t controls =
+        in.lteq(0x1F) | (in.lteq(0x9F) & ~in.lteq(0x7E));
+    const uint64_t wide =
+        in.lteq(uint16_t(tables::unicode_width::last_wide_block_code_point)) &
+        ~in.lteq(uint16_t(
+            tables::unicode_width::first_wide_block_code_point - 1));
+    const uint64_t low_surrogates = in.lteq(0xDFFF) & ~in.lteq(0xDBFF);
+    uint64_t other = ~(narrow | wide | low_surrogates);
+    width += (count_ones(narrow & ~controls) + 2 * count_ones(wide)) / 2;
+    while (other != 0) {
+      const size_t i = trailing_zeroes(other) / 2;
+      width +=
+          scalar::display_width::utf16_char_width<big_endian>(input, length,
+                                                              pos + i);
+      other &= ~(uint64_t(3) << (2 * i));
+    }
+  }
+  for (; pos < length; pos++) {
+    width += scalar::display_width::utf16_char_width<big_endian>(input, length,
+                                                                 pos);
+  }
+  return width;
+}
+#endif // SIMDUTF_FEATURE_UTF16
+
+} // namespace display_width
+} // unnamed namespace
+} // namespace SIMDUTF_IMPLEMENTATION
+} // namespace simdutf
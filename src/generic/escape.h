@@ -0,0 +1,105 @@
+namespace simdutf {
+namespace SIMDUTF_IMPLEMENTATION {
+namespace {
+namespace escape {
+
+// Classes of the bytes, looked up from their high and low nibbles.
+constexpr uint8_t QUOTE_AMP_APOS = 1 << 0; // 0x22, 0x26, 0x27
+constexpr uint8_t LT_GT = 1 << 1;          // 0x3C, 0x3E
+constexpr uint8_t CONTROL_0 = 1 << 2;      // 0x00..0x1F but tab, LF, CR
+constexpr uint8_t CONTROL_1 = 1 << 3;      // 0x10..0x1F
+constexpr uint8_t LEAD_EF = 1 << 4;        // 0xEF (U+FFFE and U+FFFF)
+
+// Returns a mask of the bytes needing an entity (or, for XML, a check).
+template <bool xml>
+simdutf_really_inline uint64_t classify(const simd8x64<uint8_t> &in) {
+  constexpr uint8_t control_0 = xml ? CONTROL_0 : 0;
+  constexpr uint8_t control_1 = xml ? CONTROL_1 : 0;
+  constexpr uint8_t lead_ef = xml ? LEAD_EF : 0;
+  constexpr size_t bytes_per_chunk = sizeof(simd8<uint8_t>);
+  uint64_t plain = 0;
+  for (int i = 0; i < simd8x64<uint8_t>::NUM_CHUNKS; i++) {
+    const simd8<uint8_t> chunk = in.chunks[i];
+    const simd8<uint8_t> high = chunk.shr<4>().lookup_16<uint8_t>(
+        control_0, control_1, QUOTE_AMP_APOS, LT_GT, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, lead_ef, 0);
+    const simd8<uint8_t> low = (chunk & 0x0F).lookup_16<uint8_t>(
+        control_0 | control_1, control_0 | control_1,
+        control_0 | control_1 | QUOTE_AMP_APOS, control_0 | control_1,
+        control_0 | control_1, control_0 | control_1,
+        control_0 | control_1 | QUOTE_AMP_APOS,
+        control_0 | control_1 | QUOTE_AMP_APOS, control_0 | control_1,
+        control_1, control_1, control_0 | control_1,
+        control_0 | control_1 | LT_GT, control_1,
+        control_0 | control_1 | LT_GT, control_0 | control_1 | lead_ef);
+    const simd8<bool> is_plain = (high & low) == simd8<uint8_t>::splat(0);
+    plain |= uint64_t(uint32_t(is_plain.to_bitmask())) << (i * bytes_per_chunk);
+  }
+  return ~plain;
+}
+
+/*
+ * Escapes the special characters of a UTF-8 string and validates it in a
+ * single pass. Each 64-byte block goes through the UTF-8 validator and a
+ * nibble lookup flags the bytes to escape: blocks without any are stored at
+ * once, the other ones are copied run by run. For XML, the flagged control
+ * characters are errors and the 0xEF bytes are checked for U+FFFE and U+FFFF.
+ * On error, the scalar routine runs again to find its exact position.
+ */
+template <class checker, bool xml>
+result generic_escape_utf8(const char *input, size_t length, char *output) {
+  const uint8_t *data = reinterpret_cast<const uint8_t *>(input);
+  checker c{};
+  char *out = output;
+  for (size_t pos = 0; pos < length; pos += 64) {
+    const size_t block_length = length - pos < 64 ? length - pos : 64;
+    uint8_t padded[64]{};
+    const uint8_t *block = data + pos;
+    if (block_length < 64) {
+      std::memcpy(padded, block, block_length);
+      block = padded;
+    }
+    simd8x64<uint8_t> in(block);
+    c.check_next_input(in);
+    uint64_t flagged = classify<xml>(in);
+    if (block_length < 64) {
+      flagged &= (uint64_t(1) << block_length) - 1;
+    }
+    if (flagged == 0 && block_length == 64) {
+      in.store(reinterpret_cast<uint8_t *>(out));
+      out += 64;
+      continue;
+    }
+    size_t copied = 0;
+    while (flagged != 0) {
+      const size_t i = trailing_zeroes(flagged);
+      flagged &= flagged - 1;
+      const uint8_t byte = data[pos + i];
+      if (xml && byte >= 0x80) {
+        if (scalar::escape::is_xml_forbidden_sequence(data + pos + i,
+                                                      length - pos - i)) {
+          return scalar::escape::escape_utf8<xml>(input, length, output);
+        }
+        continue; // copied with the run
+      }
+      if (xml && byte < 0x20) {
+        return scalar::escape::escape_utf8<xml>(input, length, output);
+      }
+      std::memcpy(out, data + pos + copied, i - copied);
+      out = scalar::escape::write_entity<xml>(byte, out + (i - copied));
+      copied = i + 1;
+    }
+    std::memcpy(out, data + pos + copied, block_length - copied);
+    out += block_length - copied;
+  }
+  c.check_eof();
+  if (c.errors()) {
+    return scalar::escape::escape_utf8<xml>(input, length, output);
+  }
+  return result(error_code::SUCCESS, size_t(out - output));
+}
+
+} // namespace escape
+} // unnamed namespace
+} // namespace SIMDUTF_IMPLEMENTATION
+} // namespace simdutf
@@ -0,0 +1,72 @@
+namespace simdutf {
+namespace SIMDUTF_IMPLEMENTATION {
+namespace {
+namespace grapheme {
+
+/*
+ * Counts the extended grapheme clusters of a UTF-8 string. 'pos' is always a
+ * cluster boundary. When none of the code points starting in the 64-byte
+ * block at 'pos' joins with its neighbours (no combining marks, ZWJ, regional
+ * indicators, Hangul Jamo...), every code point is a cluster except for the
+ * CR LF pairs: the clusters are counted as in count_utf8. The leading bytes
+ * below 0xCC and the Greek, Cyrillic and CJK leading bytes are known to start
+ * such code points, the other ones are looked up. The block is then consumed
+ * up to a code point starting in its last four bytes, which is a boundary.
+ * Otherwise the clusters overlapping the block are segmented by the scalar
+ * routine.
+ */
+size_t generic_count_graphemes_utf8(const char *input, size_t length) {
+  const uint8_t *data = reinterpret_cast<const uint8_t *>(input);
+  size_t count = 0;
+  size_t pos = 0;
+  while (pos + 64 <= length) {
+    simd8x64<int8_t> in(reinterpret_cast<const int8_t *>(data + pos));
+    const uint64_t leading = in.gt(-65);
+    uint64_t unknown =
+        in.gteq_unsigned(scalar::grapheme::first_complex_utf8_byte) &
+        ~(in.gteq_unsigned(
+              scalar::grapheme::first_simple_two_byte_leading_byte) &
+          ~in.gteq_unsigned(uint8_t(
+              scalar::grapheme::last_simple_two_byte_leading_byte + 1))) &
+        ~(in.gteq_unsigned(
+              scalar::grapheme::first_simple_three_byte_leading_byte) &
+          ~in.gteq_unsigned(uint8_t(
+              scalar::grapheme::last_simple_three_byte_leading_byte + 1)));
+    bool simple = (leading >> 60) != 0;
+    while (simple && unknown != 0) {
+      const size_t i = pos + trailing_zeroes(unknown);
+      size_t consumed;
+      simple = scalar::grapheme::is_simple(
+          scalar::grapheme::utf8_property(data + i, length - i, consumed));
+      unknown &= unknown - 1;
+    }
+    if (simple) {
+      size_t end = 60 + trailing_zeroes(leading >> 60);
+      const uint64_t cr = in.gt(0x0C) & in.lt(0x0E);
+      const uint64_t lf = in.gt(0x09) & in.lt(0x0B);
+      const uint64_t crlf = (cr << 1) & lf;
+      if ((crlf >> end) & 1) {
+        end--;
+      }
+      const uint64_t before_end = (uint64_t(1) << end) - 1;
+      count += count_ones(leading & before_end) - count_ones(crlf & before_end);
+      pos += end;
+    } else {
+      const size_t block_end = pos + 64;
+      while (pos < block_end) {
+        pos = scalar::grapheme::next_boundary_utf8(data, length, pos);
+        count++;
+      }
+    }
+  }
+  while (pos < length) {
+    pos = scalar::grapheme::next_boundary_utf8(data, length, pos);
+    count++;
+  }
+  return count;
+}
+
+} // namespace grapheme
+} // unnamed namespace
+} // namespace SIMDUTF_IMPLEMENTATION
+} // namespace simdutf
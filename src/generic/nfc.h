@@ -0,0 +1,118 @@
+namespace simdutf {
+namespace SIMDUTF_IMPLEMENTATION {
+namespace {
+namespace nfc {
+
+#if SIMDUTF_FEATURE_UTF8
+/*
+ * NFC quick check for UTF-8. Code points below U+0300 are NFC_QC=Yes with a
+ * zero combining class and they are encoded with bytes below 0xCC. Each
+ * 64-byte block goes through the UTF-8 validator; the bytes at or above 0xCC
+ * (necessarily leading bytes) start a run of code points that is checked by
+ * the scalar routine, which stops past the first code point below U+0300.
+ */
+template <class checker>
+nfc_quick_check_result generic_is_nfc_quick_utf8(const char *input,
+                                                 size_t length) {
+  const uint8_t *data = reinterpret_cast<const uint8_t *>(input);
+  checker c{};
+  nfc_quick_check_result result = nfc_quick_check_yes;
+  // the code points before 'checked' have been processed
+  size_t checked = 0;
+  size_t pos = 0;
+  for (; pos + 64 <= length; pos += 64) {
+    simd::simd8x64<uint8_t> in(data + pos);
+    c.check_next_input(in);
+    if (checked >= pos + 64) {
+      continue;
+    }
+    uint64_t relevant =
+        in.gteq_unsigned(scalar::nfc::first_nfc_relevant_utf8_byte);
+    if (checked > pos) {
+      relevant &= ~uint64_t(0) << (checked - pos);
+    }
+    while (relevant != 0) {
+      checked = scalar::nfc::check_run_utf8(
+          data, length, pos + trailing_zeroes(relevant), result);
+      if (result == nfc_quick_check_no) {
+        return result;
+      }
+      if (checked >= pos + 64) {
+        break;
+      }
+      relevant &= ~uint64_t(0) << (checked - pos);
+    }
+  }
+  if (pos < length) {
+    uint8_t block[64]{};
+    std::memcpy(block, data + pos, length - pos);
+    simd::simd8x64<uint8_t> in(block);
+    c.check_next_input(in);
+    for (size_t i = checked > pos ? checked : pos; i < length;) {
+      if (data[i] < scalar::nfc::first_nfc_relevant_utf8_byte) {
+        i++;
+        continue;
+      }
+      i = scalar::nfc::check_run_utf8(data, length, i, result);
+      if (result == nfc_quick_check_no) {
+        return result;
+      }
+    }
+  }
+  c.check_eof();
+  return c.errors() ? nfc_quick_check_no : result;
+}
+#endif // SIMDUTF_FEATURE_UTF8
+
+#if SIMDUTF_FEATURE_UTF16
+template <endianness big_endian>
+nfc_quick_check_result generic_is_nfc_quick_utf16(const char16_t *input,
+                                                  size_t length) {
+  nfc_quick_check_result result = nfc_quick_check_yes;
+  size_t checked = 0;
+  size_t pos = 0;
+  for (; pos + 32 <= length; pos += 32) {
+    if (checked >= pos + 32) {
+      continue;
+    }
+    simd16x32<uint16_t> in(reinterpret_cast<const uint16_t *>(input + pos));
+    if constexpr (!match_system(big_endian)) {
+      in.swap_bytes();
+    }
+    // two bits per code unit
+    uint64_t relevant =
+        ~in.lteq(uint16_t(scalar::nfc::first_nfc_relevant_code_point - 1));
+    if (checked > pos) {
+      relevant &= ~uint64_t(0) << (2 * (checked - pos));
+    }
+    while (relevant != 0) {
+      checked = scalar::nfc::check_run_utf16<big_endian>(
+          input, length, pos + trailing_zeroes(relevant) / 2, result);
+      if (result == nfc_quick_check_no) {
+        return result;
+      }
+      if (checked >= pos + 32) {
+        break;
+      }
+      relevant &= ~uint64_t(0) << (2 * (checked - pos));
+    }
+  }
+  for (size_t i = checked > pos ? checked : pos; i < length;) {
+    if (scalar::utf16::swap_if_needed<big_endian>(input[i]) <
+        scalar::nfc::first_nfc_relevant_code_point) {
+      i++;
+      continue;
+    }
+    i = scalar::nfc::check_run_utf16<big_endian>(input, length, i, result);
+    if (result == nfc_quick_check_no) {
+      return result;
+    }
+  }
+  return result;
+}
+#endif // SIMDUTF_FEATURE_UTF16
+
+} // namespace nfc
+} // unnamed namespace
+} // namespace SIMDUTF_IMPLEMENTATION
+} // namespace simdutf
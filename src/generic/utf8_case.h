@@ -0,0 +1,80 @@
+namespace simdutf {
+namespace SIMDUTF_IMPLEMENTATION {
+namespace {
+namespace utf8_case {
+
+using scalar::utf8_case::case_mapping;
+
+// Pure-ASCII 64-byte blocks are detected as in ascii_validation.h and mapped
+// eight bytes at a time; a block holding non-ASCII bytes is handed to the
+// scalar routine, which applies the full simple Unicode case mapping up to
+// the end of the block.
+template <case_mapping mapping>
+size_t generic_map(const char *input, size_t length, char *output) {
+  const uint8_t *data = reinterpret_cast<const uint8_t *>(input);
+  uint8_t *out = reinterpret_cast<uint8_t *>(output);
+  size_t pos = 0;
+  while (pos + 64 <= length) {
+    simd::simd8x64<uint8_t> in(data + pos);
+    if (in.is_ascii()) {
+      for (size_t i = 0; i < 64; i += 8) {
+        uint64_t word;
+        std::memcpy(&word, data + pos + i, sizeof(word));
+        word = scalar::utf8_case::map_ascii_word<mapping>(word);
+        std::memcpy(out + i, &word, sizeof(word));
+      }
+      pos += 64;
+      out += 64;
+    } else {
+      const size_t block_end = pos + 64;
+      while (pos < block_end) {
+        size_t consumed;
+        out += scalar::utf8_case::map_one<mapping>(data + pos, length - pos,
+                                                   out, consumed);
+        pos += consumed;
+      }
+    }
+  }
+  out += scalar::utf8_case::map<mapping>(input + pos, length - pos,
+                                         reinterpret_cast<char *>(out));
+  return size_t(out - reinterpret_cast<uint8_t *>(output));
+}
+
+bool generic_equals_ignore_case(const char *a, size_t a_length, const char *b,
+                                size_t b_length) {
+  const uint8_t *a_data = reinterpret_cast<const uint8_t *>(a);
+  const uint8_t *b_data = reinterpret_cast<const uint8_t *>(b);
+  size_t a_pos = 0;
+  size_t b_pos = 0;
+  while (a_pos + 64 <= a_length && b_pos + 64 <= b_length) {
+    simd::simd8x64<uint8_t> in_a(a_data + a_pos);
+    simd::simd8x64<uint8_t> in_b(b_data + b_pos);
+    if (in_a.is_ascii() && in_b.is_ascii()) {
+      for (size_t i = 0; i < 64; i += 8) {
+        uint64_t word_a, word_b;
+        std::memcpy(&word_a, a_data + a_pos + i, sizeof(word_a));
+        std::memcpy(&word_b, b_data + b_pos + i, sizeof(word_b));
+        if (scalar::utf8_case::map_ascii_word<case_mapping::fold>(word_a) !=
+            scalar::utf8_case::map_ascii_word<case_mapping::fold>(word_b)) {
+          return false;
+        }
+      }
+      a_pos += 64;
+      b_pos += 64;
+    } else if (!scalar::utf8_case::equals_ignore_case_until(
+                   a_data, a_length, a_pos, a_pos + 64, b_data, b_length,
+                   b_pos)) {
+      return false;
+    }
+  }
+  if (!scalar::utf8_case::equals_ignore_case_until(
+          a_data, a_length, a_pos, a_length, b_data, b_length, b_pos)) {
+    return false;
+  }
+  return a_pos == a_length && b_pos == b_length;
+}
+
+} // namespace utf8_case
+} // unnamed namespace
+} // namespace SIMDUTF_IMPLEMENTATION
+} // namespace simdutf
@@ -0,0 +1,95 @@
+// file included directly
+
+#if SIMDUTF_FEATURE_UTF8
+// See generic/display_width.h for the byte classes.
+size_t display_width_utf8(const char *input, size_t length) {
+  const uint8_t *data = reinterpret_cast<const uint8_t *>(input);
+  const __m512i continuation = _mm512_set1_epi8(char(0xBF));
+  const __m512i space = _mm512_set1_epi8(0x20);
+  const __m512i del = _mm512_set1_epi8(0x7F);
+  const __m512i c2 = _mm512_set1_epi8(char(0xC2));
+  const __m512i c1_limit = _mm512_set1_epi8(char(0xA0));
+  const __m512i first_wide =
+      _mm512_set1_epi8(char(scalar::display_width::first_wide_utf8_byte));
+  const __m512i last_wide =
+      _mm512_set1_epi8(char(scalar::display_width::last_wide_utf8_byte));
+  const __m512i first_table =
+      _mm512_set1_epi8(char(scalar::display_width::first_table_utf8_byte));
+  size_t width = 0;
+  uint64_t pending_c2 = 0;
+  for (size_t pos = 0; pos < length; pos += 64) {
+    const size_t block = length - pos < 64 ? length - pos : 64;
+    // zero bytes are controls: the padding does not contribute to the width
+    const __m512i utf8 = _mm512_maskz_loadu_epi8(
+        ~UINT64_C(0) >> (64 - block), (const __m512i *)(data + pos));
+    const uint64_t printable_ascii = _mm512_cmpge_epu8_mask(utf8, space) &
+                                     _mm512_cmplt_epu8_mask(utf8, del);
+    const uint64_t multibyte_leading =
+        _mm512_cmpgt_epu8_mask(utf8, continuation);
+    const uint64_t c2_mask = _mm512_cmpeq_epi8_mask(utf8, c2);
+    const uint64_t c1 = ((c2_mask << 1) | pending_c2) &
+                        _mm512_cmplt_epu8_mask(utf8, c1_limit) &
+                        _mm512_movepi8_mask(utf8);
+    pending_c2 = c2_mask >> 63;
+    const uint64_t wide = _mm512_cmpge_epu8_mask(utf8, first_wide) &
+                          _mm512_cmple_epu8_mask(utf8, last_wide);
+    uint64_t other = _mm512_cmpge_epu8_mask(utf8, first_table) & ~wide;
+    width += count_ones(printable_ascii | (multibyte_leading & ~other)) -
+             count_ones(c1) + count_ones(wide);
+    while (other != 0) {
+      const size_t i = pos + _tzcnt_u64(other);
+      width += scalar::display_width::utf8_char_width(data + i, length - i);
+      other &= other - 1;
+    }
+  }
+  return width;
+}
+#endif // SIMDUTF_FEATURE_UTF8
+
+#if SIMDUTF_FEATURE_UTF16
+template <endianness big_endian>
+size_t display_width_utf16(const char16_t *input, size_t length) {
+  const __m512i byteflip = _mm512_setr_epi64(
+      0x0607040502030001, 0x0e0f0c0d0a0b0809, 0x0607040502030001,
+      0x0e0f0c0d0a0b0809, 0x0607040502030001, 0x0e0f0c0d0a0b0809,
+      0x0607040502030001, 0x0e0f0c0d0a0b0809);
+  const __m512i space = _mm512_set1_epi16(0x20);
+  const __m512i del = _mm512_set1_epi16(0x7F);
+  const __m512i nbsp = _mm512_set1_epi16(0xA0);
+  const __m512i first_table = _mm512_set1_epi16(
+      int16_t(scalar::display_width::first_table_code_point));
+  const __m512i first_wide = _mm512_set1_epi16(
+      int16_t(tables::unicode_width::first_wide_block_code_point));
+  const __m512i last_wide = _mm512_set1_epi16(
+      int16_t(tables::unicode_width::last_wide_block_code_point));
+  const __m512i low_surrogate_mask = _mm512_set1_epi16(int16_t(0xFC00));
+  const __m512i low_surrogate = _mm512_set1_epi16(int16_t(0xDC00));
+  size_t width = 0;
+  for (size_t pos = 0; pos < length; pos += 32) {
+    const size_t block = length - pos < 32 ? length - pos : 32;
+    // zero code units are controls: the padding does not contribute
+    __m512i utf16 = _mm512_maskz_loadu_epi16(
+        __mmask32((UINT64_C(1) << block) - 1), (const __m512i *)(input + pos));
+    if constexpr (!match_system(big_endian)) {
+      utf16 = _mm512_shuffle_epi8(utf16, byteflip);
+    }
+    const uint32_t narrow = (_mm512_cmpge_epu16_mask(utf16, space) &
+                             _mm512_cmplt_epu16_mask(utf16, del)) |
+                            (_mm512_cmpge_epu16_mask(utf16, nbsp) &
+                             _mm512_cmplt_epu16_mask(utf16, first_table));
+    const uint32_t wide = _mm512_cmpge_epu16_mask(utf16, first_wide) &
+                          _mm512_cmple_epu16_mask(utf16, last_wide);
+    const uint32_t low_surrogates = _mm512_cmpeq_epi16_mask(
+        _mm512_and_si512(utf16, low_surrogate_mask), low_surrogate);
+    uint32_t other = _mm512_cmpge_epu16_mask(utf16, first_table) &
+                     ~(wide | low_surrogates);
+    width += count_ones32(narrow) + 2 * count_ones32(wide);
+    while (other != 0) {
+      width += scalar::display_width::utf16_char_width<big_endian>(
+          input, length, pos + _tzcnt_u32(other));
+      other &= other - 1;
+    }
+  }
+  return width;
+}
+#endif // SIMDUTF_FEATURE_UTF16
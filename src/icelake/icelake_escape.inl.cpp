@@ -0,0 +1,71 @@
+// file included directly
+
+// See generic/escape.h for the byte classes.
+template <bool xml>
+simdutf_really_inline uint64_t classify_escape(const __m512i input) {
+  constexpr uint8_t QUOTE_AMP_APOS = 1 << 0;
+  constexpr uint8_t LT_GT = 1 << 1;
+  constexpr uint8_t control_0 = xml ? 1 << 2 : 0;
+  constexpr uint8_t control_1 = xml ? 1 << 3 : 0;
+  constexpr uint8_t lead_ef = xml ? 1 << 4 : 0;
+  constexpr uint8_t c = control_0 | control_1;
+  const __m512i high_table = _mm512_broadcast_i32x4(_mm_setr_epi8(
+      control_0, control_1, QUOTE_AMP_APOS, LT_GT, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, lead_ef, 0));
+  const __m512i low_table = _mm512_broadcast_i32x4(_mm_setr_epi8(
+      c, c, c | QUOTE_AMP_APOS, c, c, c, c | QUOTE_AMP_APOS,
+      c | QUOTE_AMP_APOS, c, control_1, control_1, c, c | LT_GT, control_1,
+      c | LT_GT, c | lead_ef));
+  const __m512i low_nibbles = _mm512_set1_epi8(0x0F);
+  const __m512i high = _mm512_shuffle_epi8(
+      high_table, _mm512_and_si512(_mm512_srli_epi16(input, 4), low_nibbles));
+  const __m512i low =
+      _mm512_shuffle_epi8(low_table, _mm512_and_si512(input, low_nibbles));
+  return _mm512_test_epi8_mask(high, low);
+}
+
+template <bool xml>
+result escape_utf8(const char *input, size_t length, char *output) {
+  const uint8_t *data = reinterpret_cast<const uint8_t *>(input);
+  avx512_utf8_checker checker{};
+  char *out = output;
+  for (size_t pos = 0; pos < length; pos += 64) {
+    const size_t block_length = length - pos < 64 ? length - pos : 64;
+    const __mmask64 load_mask = ~UINT64_C(0) >> (64 - block_length);
+    const __m512i utf8 =
+        _mm512_maskz_loadu_epi8(load_mask, (const __m512i *)(data + pos));
+    checker.check_next_input(utf8);
+    uint64_t flagged = classify_escape<xml>(utf8) & load_mask;
+    if (flagged == 0) {
+      _mm512_mask_storeu_epi8(out, load_mask, utf8);
+      out += block_length;
+      continue;
+    }
+    size_t copied = 0;
+    while (flagged != 0) {
+      const size_t i = _tzcnt_u64(flagged);
+      flagged &= flagged - 1;
+      const uint8_t byte = data[pos + i];
+      if (xml && byte >= 0x80) {
+        if (scalar::escape::is_xml_forbidden_sequence(data + pos + i,
+                                                      length - pos - i)) {
+          return scalar::escape::escape_utf8<xml>(input, length, output);
+        }
+        continue; // copied with the run
+      }
+      if (xml && byte < 0x20) {
+        return scalar::escape::escape_utf8<xml>(input, length, output);
+      }
+      std::memcpy(out, data + pos + copied, i - copied);
+      out = scalar::escape::write_entity<xml>(byte, out + (i - copied));
+      copied = i + 1;
+    }
+    std::memcpy(out, data + pos + copied, block_length - copied);
+    out += block_length - copied;
+  }
+  checker.check_eof();
+  if (checker.errors()) {
+    return scalar::escape::escape_utf8<xml>(input, length, output);
+  }
+  return result(error_code::SUCCESS, size_t(out - output));
+}
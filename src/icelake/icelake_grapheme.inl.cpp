@@ -0,0 +1,64 @@
+// file included directly
+
+// See generic/grapheme.h.
+size_t count_graphemes_utf8(const char *input, size_t length) {
+  const uint8_t *data = reinterpret_cast<const uint8_t *>(input);
+  const __m512i continuation = _mm512_set1_epi8(char(0xBF));
+  const __m512i cr = _mm512_set1_epi8(0x0D);
+  const __m512i lf = _mm512_set1_epi8(0x0A);
+  const __m512i first_complex =
+      _mm512_set1_epi8(char(scalar::grapheme::first_complex_utf8_byte));
+  const __m512i first_simple_two_byte = _mm512_set1_epi8(
+      char(scalar::grapheme::first_simple_two_byte_leading_byte));
+  const __m512i last_simple_two_byte = _mm512_set1_epi8(
+      char(scalar::grapheme::last_simple_two_byte_leading_byte));
+  const __m512i first_simple_three_byte = _mm512_set1_epi8(
+      char(scalar::grapheme::first_simple_three_byte_leading_byte));
+  const __m512i last_simple_three_byte = _mm512_set1_epi8(
+      char(scalar::grapheme::last_simple_three_byte_leading_byte));
+  size_t count = 0;
+  size_t pos = 0;
+  while (pos + 64 <= length) {
+    const __m512i utf8 = _mm512_loadu_si512((const __m512i *)(data + pos));
+    const uint64_t ascii = ~uint64_t(_mm512_movepi8_mask(utf8));
+    const uint64_t leading =
+        ascii | _mm512_cmpgt_epu8_mask(utf8, continuation);
+    const uint64_t simple_leading =
+        (_mm512_cmpge_epu8_mask(utf8, first_simple_two_byte) &
+         _mm512_cmple_epu8_mask(utf8, last_simple_two_byte)) |
+        (_mm512_cmpge_epu8_mask(utf8, first_simple_three_byte) &
+         _mm512_cmple_epu8_mask(utf8, last_simple_three_byte));
+    uint64_t unknown =
+        _mm512_cmpge_epu8_mask(utf8, first_complex) & ~simple_leading;
+    bool simple = (leading >> 60) != 0;
+    while (simple && unknown != 0) {
+      const size_t i = pos + _tzcnt_u64(unknown);
+      size_t consumed;
+      simple = scalar::grapheme::is_simple(
+          scalar::grapheme::utf8_property(data + i, length - i, consumed));
+      unknown &= unknown - 1;
+    }
+    if (simple) {
+      size_t end = 60 + _tzcnt_u64(leading >> 60);
+      const uint64_t crlf = (_mm512_cmpeq_epi8_mask(utf8, cr) << 1) &
+                            _mm512_cmpeq_epi8_mask(utf8, lf);
+      if ((crlf >> end) & 1) {
+        end--;
+      }
+      const uint64_t before_end = (uint64_t(1) << end) - 1;
+      count += count_ones(leading & before_end) - count_ones(crlf & before_end);
+      pos += end;
+    } else {
+      const size_t block_end = pos + 64;
+      while (pos < block_end) {
+        pos = scalar::grapheme::next_boundary_utf8(data, length, pos);
+        count++;
+      }
+    }
+  }
+  while (pos < length) {
+    pos = scalar::grapheme::next_boundary_utf8(data, length, pos);
+    count++;
+  }
+  return count;
+}
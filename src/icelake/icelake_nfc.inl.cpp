@@ -0,0 +1,82 @@
+// file included directly
+
+#if SIMDUTF_FEATURE_UTF8
+// See generic/nfc.h: the bytes at or above 0xCC start the only code points
+// that need a table lookup, the other bytes are only validated.
+nfc_quick_check_result is_nfc_quick_utf8(const char *input, size_t length) {
+  const uint8_t *data = reinterpret_cast<const uint8_t *>(input);
+  const __m512i threshold =
+      _mm512_set1_epi8(char(scalar::nfc::first_nfc_relevant_utf8_byte));
+  avx512_utf8_checker checker{};
+  nfc_quick_check_result result = nfc_quick_check_yes;
+  // the code points before 'checked' have been processed
+  size_t checked = 0;
+  for (size_t pos = 0; pos < length; pos += 64) {
+    const size_t block = length - pos < 64 ? length - pos : 64;
+    const __m512i utf8 = _mm512_maskz_loadu_epi8(
+        ~UINT64_C(0) >> (64 - block), (const __m512i *)(data + pos));
+    if (checker.check_next_input(utf8) || checked >= pos + block) {
+      continue;
+    }
+    uint64_t relevant = _mm512_cmpge_epu8_mask(utf8, threshold);
+    if (checked > pos) {
+      relevant &= ~UINT64_C(0) << (checked - pos);
+    }
+    while (relevant != 0) {
+      checked = scalar::nfc::check_run_utf8(
+          data, length, pos + _tzcnt_u64(relevant), result);
+      if (result == nfc_quick_check_no) {
+        return result;
+      }
+      if (checked >= pos + 64) {
+        break;
+      }
+      relevant &= ~UINT64_C(0) << (checked - pos);
+    }
+  }
+  checker.check_eof();
+  return checker.errors() ? nfc_quick_check_no : result;
+}
+#endif // SIMDUTF_FEATURE_UTF8
+
+#if SIMDUTF_FEATURE_UTF16
+template <endianness big_endian>
+nfc_quick_check_result is_nfc_quick_utf16(const char16_t *input,
+                                          size_t length) {
+  const __m512i byteflip = _mm512_setr_epi64(
+      0x0607040502030001, 0x0e0f0c0d0a0b0809, 0x0607040502030001,
+      0x0e0f0c0d0a0b0809, 0x0607040502030001, 0x0e0f0c0d0a0b0809,
+      0x0607040502030001, 0x0e0f0c0d0a0b0809);
+  const __m512i threshold =
+      _mm512_set1_epi16(int16_t(scalar::nfc::first_nfc_relevant_code_point));
+  nfc_quick_check_result result = nfc_quick_check_yes;
+  size_t checked = 0;
+  for (size_t pos = 0; pos < length; pos += 32) {
+    const size_t block = length - pos < 32 ? length - pos : 32;
+    if (checked >= pos + block) {
+      continue;
+    }
+    __m512i utf16 = _mm512_maskz_loadu_epi16(
+        __mmask32((UINT64_C(1) << block) - 1), (const __m512i *)(input + pos));
+    if constexpr (!match_system(big_endian)) {
+      utf16 = _mm512_shuffle_epi8(utf16, byteflip);
+    }
+    uint32_t relevant = _mm512_cmpge_epu16_mask(utf16, threshold);
+    if (checked > pos) {
+      relevant &= ~uint32_t(0) << (checked - pos);
+    }
+    while (relevant != 0) {
+      checked = scalar::nfc::check_run_utf16<big_endian>(
+          input, length, pos + _tzcnt_u32(relevant), result);
+      if (result == nfc_quick_check_no) {
+        return result;
+      }
+      if (checked >= pos + 32) {
+        break;
+      }
+      relevant &= ~uint32_t(0) << (checked - pos);
+    }
+  }
+  return result;
+}
+#endif // SIMDUTF_FEATURE_UTF16
@@ -0,0 +1,74 @@
+// file included directly
+
+// Maps the ASCII letters of a 64-byte register; the input must be ASCII.
+template <scalar::utf8_case::case_mapping mapping>
+simdutf_really_inline __m512i map_ascii_case(__m512i in) {
+  constexpr bool to_upper =
+      mapping == scalar::utf8_case::case_mapping::upper;
+  const __m512i first = _mm512_set1_epi8(to_upper ? 'a' : 'A');
+  const __mmask64 letters = _mm512_cmplt_epu8_mask(
+      _mm512_sub_epi8(in, first), _mm512_set1_epi8(26));
+  const __m512i case_bit = _mm512_set1_epi8(0x20);
+  return to_upper ? _mm512_mask_sub_epi8(in, letters, in, case_bit)
+                  : _mm512_mask_add_epi8(in, letters, in, case_bit);
+}
+
+template <scalar::utf8_case::case_mapping mapping>
+size_t utf8_case_map(const char *input, size_t length, char *output) {
+  const uint8_t *data = reinterpret_cast<const uint8_t *>(input);
+  uint8_t *out = reinterpret_cast<uint8_t *>(output);
+  size_t pos = 0;
+  while (pos < length) {
+    const size_t block = length - pos < 64 ? length - pos : 64;
+    const __mmask64 load_mask = 0xFFFFFFFFFFFFFFFF >> (64 - block);
+    const __m512i in = _mm512_maskz_loadu_epi8(load_mask, data + pos);
+    if (_mm512_movepi8_mask(in) == 0) {
+      _mm512_mask_storeu_epi8(out, load_mask, map_ascii_case<mapping>(in));
+      pos += block;
+      out += block;
+    } else {
+      const size_t block_end = pos + block;
+      while (pos < block_end) {
+        size_t consumed;
+        out += scalar::utf8_case::map_one<mapping>(data + pos, length - pos,
+                                                   out, consumed);
+        pos += consumed;
+      }
+    }
+  }
+  return size_t(out - reinterpret_cast<uint8_t *>(output));
+}
+
+bool utf8_equals_ignore_case(const char *a, size_t a_length, const char *b,
+                             size_t b_length) {
+  const uint8_t *a_data = reinterpret_cast<const uint8_t *>(a);
+  const uint8_t *b_data = reinterpret_cast<const uint8_t *>(b);
+  size_t a_pos = 0;
+  size_t b_pos = 0;
+  while (a_pos < a_length && b_pos < b_length) {
+    size_t block = a_length - a_pos < b_length - b_pos ? a_length - a_pos
+                                                       : b_length - b_pos;
+    if (block > 64) {
+      block = 64;
+    }
+    const __mmask64 load_mask = 0xFFFFFFFFFFFFFFFF >> (64 - block);
+    const __m512i in_a = _mm512_maskz_loadu_epi8(load_mask, a_data + a_pos);
+    const __m512i in_b = _mm512_maskz_loadu_epi8(load_mask, b_data + b_pos);
+    if (_mm512_movepi8_mask(_mm512_or_si512(in_a, in_b)) == 0) {
+      const __m512i folded_a =
+          map_ascii_case<scalar::utf8_case::case_mapping::fold>(in_a);
+      const __m512i folded_b =
+          map_ascii_case<scalar::utf8_case::case_mapping::fold>(in_b);
+      if (_mm512_cmpneq_epi8_mask(folded_a, folded_b) != 0) {
+        return false;
+      }
+      a_pos += block;
+      b_pos += block;
+    } else if (!scalar::utf8_case::equals_ignore_case_until(
+                   a_data, a_length, a_pos, a_pos + block, b_data, b_length,
+                   b_pos)) {
+      return false;
+    }
+  }
+  return a_pos == a_length && b_pos == b_length;
+}
@@ -83,6 +83,15 @@ using namespace simd;
 #if SIMDUTF_FEATURE_UTF32
   #include "icelake/icelake_convert_latin1_to_utf32.inl.cpp"
 #endif // SIMDUTF_FEATURE_UTF32
+#if SIMDUTF_FEATURE_UTF8
+  #include "icelake/icelake_utf8_case.inl.cpp"
+  #include "icelake/icelake_grapheme.inl.cpp"
+  #include "icelake/icelake_escape.inl.cpp"
+#endif // SIMDUTF_FEATURE_UTF8
+#if SIMDUTF_FEATURE_UTF8 || SIMDUTF_FEATURE_UTF16
+  #include "icelake/icelake_nfc.inl.cpp"
+  #include "icelake/icelake_display_width.inl.cpp"
+#endif // SIMDUTF_FEATURE_UTF8 || SIMDUTF_FEATURE_UTF16
 #if SIMDUTF_FEATURE_BASE64
   #include "icelake/icelake_base64.inl.cpp"
   #include "icelake/icelake_find.inl.cpp"
@@ -1484,8 +1493,86 @@ implementation::count_utf8(const char *input, size_t length) const noexcept {
   return answer + scalar::utf8::count_code_points(
                       reinterpret_cast<const char *>(str + i), length - i);
 }
+
+simdutf_warn_unused size_t implementation::to_lower_ascii_utf8(
+    const char *input, size_t length, char *output) const noexcept {
+  return utf8_case_map<scalar::utf8_case::case_mapping::lower>(input, length,
+                                                          output);
+}
+
+simdutf_warn_unused size_t implementation::to_upper_ascii_utf8(
+    const char *input, size_t length, char *output) const noexcept {
+  return utf8_case_map<scalar::utf8_case::case_mapping::upper>(input, length,
+                                                          output);
+}
+
+simdutf_warn_unused bool implementation::equals_ignore_case_utf8(
+    const char *input1, size_t length1, const char *input2,
+    size_t length2) const noexcept {
+  return utf8_equals_ignore_case(input1, length1, input2, length2);
+}
+#endif // SIMDUTF_FEATURE_UTF8
+
+#if SIMDUTF_FEATURE_UTF8
+simdutf_warn_unused nfc_quick_check_result
+implementation::is_nfc_quick_utf8(const char *input,
+                                  size_t length) const noexcept {
+  return icelake::is_nfc_quick_utf8(input, length);
+}
+#endif // SIMDUTF_FEATURE_UTF8
+
+#if SIMDUTF_FEATURE_UTF16
+simdutf_warn_unused nfc_quick_check_result
+implementation::is_nfc_quick_utf16le(const char16_t *input,
+                                     size_t length) const noexcept {
+  return icelake::is_nfc_quick_utf16<endianness::LITTLE>(input, length);
+}
+
+simdutf_warn_unused nfc_quick_check_result
+implementation::is_nfc_quick_utf16be(const char16_t *input,
+                                     size_t length) const noexcept {
+  return icelake::is_nfc_quick_utf16<endianness::BIG>(input, length);
+}
+#endif // SIMDUTF_FEATURE_UTF16
+
+#if SIMDUTF_FEATURE_UTF8
+simdutf_warn_unused size_t
+implementation::display_width_utf8(const char *input,
+                                   size_t length) const noexcept {
+  return icelake::display_width_utf8(input, length);
+}
+
+simdutf_warn_unused size_t
+implementation::count_graphemes_utf8(const char *input,
+                                     size_t length) const noexcept {
+  return icelake::count_graphemes_utf8(input, length);
+}
+
+simdutf_warn_unused result implementation::escape_html_utf8(
+    const char *input, size_t length, char *output) const noexcept {
+  return icelake::escape_utf8<false>(input, length, output);
+}
+
+simdutf_warn_unused result implementation::escape_xml_utf8(
+    const char *input, size_t length, char *output) const noexcept {
+  return icelake::escape_utf8<true>(input, length, output);
+}
 #endif // SIMDUTF_FEATURE_UTF8
 
+#if SIMDUTF_FEATURE_UTF16
+simdutf_warn_unused size_t
+implementation::display_width_utf16le(const char16_t *input,
+                                      size_t length) const noexcept {
+  return icelake::display_width_utf16<endianness::LITTLE>(input, length);
+}
+
+simdutf_warn_unused size_t
+implementation::display_width_utf16be(const char16_t *input,
+                                      size_t length) const noexcept {
+  return icelake::display_width_utf16<endianness::BIG>(input, length);
+}
+#endif // SIMDUTF_FEATURE_UTF16
+
 #if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_LATIN1
 simdutf_warn_unused size_t implementation::latin1_length_from_utf8(
     const char *buf, size_t len) const noexcept {
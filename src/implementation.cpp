@@ -1,11 +1,26 @@
 #include "simdutf.h"
+#include <atomic>
+#include <cerrno>
+#include <chrono>
 #include <climits>
+#include <cstdio>
+#include <cstring>
 #include <initializer_list>
+#include <new>
 #include <type_traits>
+#include <vector>
 #if SIMDUTF_ATOMIC_REF
   #include <array>
   #include "simdutf/scalar/atomic_util.h"
 #endif
+#if defined(SIMDUTF_IS_X86_64)
+  #include <emmintrin.h>
+#endif
+#if SIMDUTF_USDT
+  // The static probes (see the CMake option SIMDUTF_USDT) are no-op
+  // instructions until a tracer such as perf or bpftrace attaches to them.
+  #include <sys/sdt.h>
+#endif
 
 // The macro SIMDUTF_USE_STATIC_INITIALIZATION, when set to 1, means that we
 // will use translation-unit-scope variables to hold our implementations.
@@ -35,6 +50,27 @@
   #endif // SIMDUTF_NO_LIBCXX
 #endif   // SIMDUTF_USE_STATIC_INITIALIZATION
 
+// The macro SIMDUTF_SIZE_AWARE_DISPATCH, when set to 1 (the default), lets the
+// most common functions send short inputs to a narrower implementation than
+// the active one: on a few bytes, the AVX-512 and AVX2 kernels spend most of
+// their time in setup and masked tails, and the SSE or scalar code is faster.
+// The length thresholds are set per function and per implementation. They
+// only apply while the active implementation is the one detected
+// automatically, not when it was forced with SIMDUTF_FORCE_IMPLEMENTATION or
+// when another one was selected by hand.
+#ifndef SIMDUTF_SIZE_AWARE_DISPATCH
+  #define SIMDUTF_SIZE_AWARE_DISPATCH 1
+#endif // SIMDUTF_SIZE_AWARE_DISPATCH
+
+// The macro SIMDUTF_AUTOTUNE, when set to 1 (the CMake option of the same
+// name), compiles in simdutf::autotune() and the SIMDUTF_AUTOTUNE environment
+// variable, which time the implementations and pick the fastest one per
+// function. It needs SIMDUTF_SIZE_AWARE_DISPATCH and the C++ standard
+// library.
+#ifndef SIMDUTF_AUTOTUNE
+  #define SIMDUTF_AUTOTUNE 0
+#endif // SIMDUTF_AUTOTUNE
+
 // When building without libc++abi (SIMDUTF_NO_LIBCXX=1) on GCC/Clang, provide
 // a weak stub for __cxa_pure_virtual so the abstract implementation vtable
 // does not drag in libc++abi just for this unreachable hook. Kept weak so a
@@ -251,7 +287,11 @@ static const fallback::implementation *get_fallback_singleton() {
 #endif
 
 #if SIMDUTF_SINGLE_IMPLEMENTATION
-simdutf_really_inline static const implementation *get_single_implementation() {
+// Returns the implementation as its own (final) class: the free functions
+// then call its methods directly rather than through the vtable, so that the
+// kernels can be inlined into them, and into the callers with link-time
+// optimization.
+simdutf_really_inline static auto get_single_implementation() {
   return
   #if SIMDUTF_IMPLEMENTATION_ICELAKE
       get_icelake_singleton();
@@ -280,6 +320,702 @@ simdutf_really_inline static const implementation *get_single_implementation() {
 }
 #endif
 
+#if SIMDUTF_SINGLE_IMPLEMENTATION
+  #undef SIMDUTF_SIZE_AWARE_DISPATCH
+  #define SIMDUTF_SIZE_AWARE_DISPATCH 0
+#endif
+#if !SIMDUTF_SIZE_AWARE_DISPATCH || SIMDUTF_NO_LIBCXX
+  #undef SIMDUTF_AUTOTUNE
+  #define SIMDUTF_AUTOTUNE 0
+#endif
+
+// The functions whose short inputs may go to a narrower implementation. The
+// UTF-16 entries cover both endiannesses.
+enum class sized_function {
+  validate_utf8,
+  validate_ascii,
+  count_utf8,
+  count_utf16,
+  utf16_length_from_utf8,
+  utf8_length_from_utf16,
+  utf8_length_from_latin1,
+  convert_latin1_to_utf8,
+  convert_utf8_to_latin1,
+  convert_utf8_to_utf16,
+  convert_valid_utf8_to_utf16,
+  convert_utf8_to_utf32,
+  convert_utf16_to_utf8,
+  convert_valid_utf16_to_utf8,
+  convert_utf32_to_utf8,
+  convert_utf16_to_utf32,
+  base64_to_binary,
+  binary_to_base64,
+  count // the number of functions
+};
+
+// The names of the functions in the autotuning profiles, the statistics, the
+// probes and the dispatch reports, in the order of sized_function.
+static const char *const sized_function_names[] = {
+    "validate_utf8",
+    "validate_ascii",
+    "count_utf8",
+    "count_utf16",
+    "utf16_length_from_utf8",
+    "utf8_length_from_utf16",
+    "utf8_length_from_latin1",
+    "convert_latin1_to_utf8",
+    "convert_utf8_to_latin1",
+    "convert_utf8_to_utf16",
+    "convert_valid_utf8_to_utf16",
+    "convert_utf8_to_utf32",
+    "convert_utf16_to_utf8",
+    "convert_valid_utf16_to_utf8",
+    "convert_utf32_to_utf8",
+    "convert_utf16_to_utf32",
+    "base64_to_binary",
+    "binary_to_base64",
+};
+static_assert(sizeof(sized_function_names) / sizeof(sized_function_names[0]) ==
+                  size_t(sized_function::count),
+              "each function needs a name");
+
+#if SIMDUTF_STATISTICS
+  #if SIMDUTF_NO_LIBCXX
+    #error "SIMDUTF_STATISTICS requires the C++ standard library"
+  #endif
+// The size of the code units of the input of each function, to count bytes.
+// The base64 decoding counts characters, whatever their type.
+static const uint8_t sized_function_unit_sizes[] = {
+    1, 1, 1, 2, 1, 2, 1, 1, 1, 1, 1, 1, 2, 2, 4, 2, 1, 1,
+};
+static_assert(sizeof(sized_function_unit_sizes) ==
+                  size_t(sized_function::count),
+              "each function needs a code unit size");
+
+// The counters of a thread, updated with relaxed atomic additions and read by
+// get_statistics() from another thread. Usually only their thread updates
+// them, but the threads which could not allocate their own share the
+// overflow counters. They are never freed: when their thread exits, another
+// thread takes them over and keeps counting.
+struct thread_counters {
+  std::atomic<uint64_t> calls[size_t(sized_function::count)];
+  std::atomic<uint64_t> bytes[size_t(sized_function::count)];
+  std::atomic<uint64_t> errors[size_t(sized_function::count)];
+  std::atomic<uint64_t> sizes[size_t(sized_function::count)]
+                             [statistics_size_buckets];
+  std::atomic<bool> in_use;
+  thread_counters *next;
+};
+
+// Shared by the threads which could not allocate their own counters.
+static thread_counters overflow_thread_counters{};
+static std::atomic<thread_counters *> all_thread_counters{
+    &overflow_thread_counters};
+
+simdutf_really_inline void increment(std::atomic<uint64_t> &counter,
+                                     uint64_t value) noexcept {
+  counter.fetch_add(value, std::memory_order_relaxed);
+}
+
+static thread_counters *acquire_thread_counters() noexcept {
+  for (thread_counters *counters = all_thread_counters.load();
+       counters != nullptr; counters = counters->next) {
+    bool in_use = false;
+    if (counters != &overflow_thread_counters &&
+        counters->in_use.compare_exchange_strong(in_use, true)) {
+      return counters;
+    }
+  }
+  thread_counters *counters = new (std::nothrow) thread_counters{};
+  if (counters == nullptr) {
+    return &overflow_thread_counters;
+  }
+  counters->in_use.store(true);
+  counters->next = all_thread_counters.load();
+  while (!all_thread_counters.compare_exchange_weak(counters->next,
+                                                    counters)) {
+  }
+  return counters;
+}
+
+struct thread_counters_owner {
+  thread_counters *counters{acquire_thread_counters()};
+  thread_counters_owner() = default;
+  thread_counters_owner(const thread_counters_owner &) = delete;
+  thread_counters_owner &operator=(const thread_counters_owner &) = delete;
+  ~thread_counters_owner() {
+    if (counters != &overflow_thread_counters) {
+      counters->in_use.store(false);
+    }
+  }
+};
+
+static thread_counters &get_thread_counters() noexcept {
+  static thread_local thread_counters_owner owner;
+  return *owner.counters;
+}
+
+// Index in the histogram: 0 for empty inputs, k for 2^(k-1) to 2^k - 1 bytes.
+simdutf_really_inline size_t size_bucket(uint64_t bytes) noexcept {
+  #if defined(__GNUC__) || defined(__clang__)
+  return bytes == 0 ? 0 : size_t(64 - __builtin_clzll(bytes));
+  #else
+  size_t bucket = 0;
+  while (bytes != 0) {
+    bucket++;
+    bytes >>= 1;
+  }
+  return bucket;
+  #endif
+}
+
+static void count_call(sized_function function, size_t length) noexcept {
+  thread_counters &counters = get_thread_counters();
+  const size_t f = size_t(function);
+  const uint64_t bytes = uint64_t(length) * sized_function_unit_sizes[f];
+  increment(counters.calls[f], 1);
+  increment(counters.bytes[f], bytes);
+  increment(counters.sizes[f][size_bucket(bytes)], 1);
+}
+
+static void count_error(sized_function function) noexcept {
+  increment(get_thread_counters().errors[size_t(function)], 1);
+}
+
+// The totals at the last reset_statistics(), and the lock serializing the
+// snapshots and resets (the counting itself takes no lock).
+static function_statistics statistics_baseline[size_t(sized_function::count)];
+static std::atomic_flag statistics_lock = ATOMIC_FLAG_INIT;
+
+static void sum_thread_counters(function_statistics *totals) noexcept {
+  for (size_t f = 0; f < size_t(sized_function::count); f++) {
+    totals[f] = function_statistics{};
+    totals[f].name = sized_function_names[f];
+  }
+  for (thread_counters *counters = all_thread_counters.load();
+       counters != nullptr; counters = counters->next) {
+    for (size_t f = 0; f < size_t(sized_function::count); f++) {
+      totals[f].calls += counters->calls[f].load(std::memory_order_relaxed);
+      totals[f].bytes += counters->bytes[f].load(std::memory_order_relaxed);
+      totals[f].errors += counters->errors[f].load(std::memory_order_relaxed);
+      for (size_t b = 0; b < statistics_size_buckets; b++) {
+        totals[f].size_histogram[b] +=
+            counters->sizes[f][b].load(std::memory_order_relaxed);
+      }
+    }
+  }
+}
+#endif // SIMDUTF_STATISTICS
+
+#if SIMDUTF_SIZE_AWARE_DISPATCH
+// When 'wide' is the active implementation, the inputs of a function that are
+// shorter than below[function] code units go to narrow[function], and the
+// other ones to fastest[function] (set by autotuning) or else to 'wide'.
+// The flag 'tuned' tells that autotuning made the choice of fastest.
+struct size_aware_dispatch {
+  const implementation *wide;
+  const implementation *narrow[size_t(sized_function::count)];
+  size_t below[size_t(sized_function::count)];
+  const implementation *fastest[size_t(sized_function::count)];
+  bool tuned;
+
+  void set(sized_function function, const implementation *impl,
+           size_t length) noexcept {
+    narrow[size_t(function)] = impl;
+    below[size_t(function)] = length;
+  }
+};
+
+// No threshold is larger, so that longer inputs skip the lookup.
+constexpr size_t max_size_aware_length = 64;
+
+// The thresholds below were measured by timing each implementation on every
+// length from 1 to 128 code units of mostly ASCII text, on an Intel Xeon
+// processor supporting AVX-512. A function only gets a threshold when the
+// narrower implementation saves at least 10% over the shorter lengths in
+// repeated runs, the per-call lookup included. The other processors (ARM,
+// POWER, LoongArch, RISC-V) have no thresholds yet.
+  #if SIMDUTF_IMPLEMENTATION_ICELAKE
+static size_aware_dispatch make_icelake_size_aware_dispatch() noexcept {
+  size_aware_dispatch dispatch{};
+  dispatch.wide = get_icelake_singleton();
+    #if SIMDUTF_IMPLEMENTATION_WESTMERE
+  const implementation *westmere = get_westmere_singleton();
+  dispatch.set(sized_function::utf16_length_from_utf8, westmere, 64);
+  dispatch.set(sized_function::utf8_length_from_utf16, westmere, 32);
+  dispatch.set(sized_function::utf8_length_from_latin1, westmere, 64);
+  dispatch.set(sized_function::convert_utf32_to_utf8, westmere, 64);
+    #endif
+    #if SIMDUTF_IMPLEMENTATION_FALLBACK
+  // validate_utf8 and convert_utf8_to_utf16 need no threshold: their masked
+  // loads make them two to three times faster than the scalar code at every
+  // length, unlike the AVX2 kernels.
+  const implementation *fallback = get_fallback_singleton();
+  dispatch.set(sized_function::convert_utf8_to_utf32, fallback, 64);
+    #endif
+  return dispatch;
+}
+    #if SIMDUTF_USE_STATIC_INITIALIZATION
+static const size_aware_dispatch icelake_size_aware_dispatch =
+    make_icelake_size_aware_dispatch();
+    #endif
+  #endif // SIMDUTF_IMPLEMENTATION_ICELAKE
+  #if SIMDUTF_IMPLEMENTATION_HASWELL
+static size_aware_dispatch make_haswell_size_aware_dispatch() noexcept {
+  size_aware_dispatch dispatch{};
+  dispatch.wide = get_haswell_singleton();
+    #if SIMDUTF_IMPLEMENTATION_WESTMERE
+  const implementation *westmere = get_westmere_singleton();
+  dispatch.set(sized_function::utf16_length_from_utf8, westmere, 64);
+  dispatch.set(sized_function::utf8_length_from_utf16, westmere, 64);
+  dispatch.set(sized_function::convert_utf32_to_utf8, westmere, 64);
+    #endif
+    #if SIMDUTF_IMPLEMENTATION_FALLBACK
+  const implementation *fallback = get_fallback_singleton();
+  dispatch.set(sized_function::validate_utf8, fallback, 32);
+  dispatch.set(sized_function::validate_ascii, fallback, 64);
+  dispatch.set(sized_function::convert_utf8_to_latin1, fallback, 64);
+  dispatch.set(sized_function::convert_utf8_to_utf16, fallback, 64);
+  dispatch.set(sized_function::convert_utf8_to_utf32, fallback, 64);
+    #endif
+  return dispatch;
+}
+    #if SIMDUTF_USE_STATIC_INITIALIZATION
+static const size_aware_dispatch haswell_size_aware_dispatch =
+    make_haswell_size_aware_dispatch();
+    #endif
+  #endif // SIMDUTF_IMPLEMENTATION_HASWELL
+  #if SIMDUTF_IMPLEMENTATION_WESTMERE
+static size_aware_dispatch make_westmere_size_aware_dispatch() noexcept {
+  size_aware_dispatch dispatch{};
+  dispatch.wide = get_westmere_singleton();
+    #if SIMDUTF_IMPLEMENTATION_FALLBACK
+  const implementation *fallback = get_fallback_singleton();
+  dispatch.set(sized_function::validate_utf8, fallback, 32);
+  dispatch.set(sized_function::validate_ascii, fallback, 64);
+  dispatch.set(sized_function::convert_utf8_to_latin1, fallback, 64);
+  dispatch.set(sized_function::convert_utf8_to_utf16, fallback, 64);
+  dispatch.set(sized_function::convert_utf8_to_utf32, fallback, 64);
+  dispatch.set(sized_function::convert_utf32_to_utf8, fallback, 16);
+    #endif
+  return dispatch;
+}
+    #if SIMDUTF_USE_STATIC_INITIALIZATION
+static const size_aware_dispatch westmere_size_aware_dispatch =
+    make_westmere_size_aware_dispatch();
+    #endif
+  #endif // SIMDUTF_IMPLEMENTATION_WESTMERE
+
+// The dispatch in use before detection, or for implementations without
+// thresholds.
+static const size_aware_dispatch no_size_aware_dispatch{};
+
+static const size_aware_dispatch *
+get_size_aware_dispatch_for(const implementation *impl) noexcept {
+  #if SIMDUTF_IMPLEMENTATION_ICELAKE
+  if (impl == get_icelake_singleton()) {
+    #if !SIMDUTF_USE_STATIC_INITIALIZATION
+    static const size_aware_dispatch icelake_size_aware_dispatch =
+        make_icelake_size_aware_dispatch();
+    #endif
+    return &icelake_size_aware_dispatch;
+  }
+  #endif
+  #if SIMDUTF_IMPLEMENTATION_HASWELL
+  if (impl == get_haswell_singleton()) {
+    #if !SIMDUTF_USE_STATIC_INITIALIZATION
+    static const size_aware_dispatch haswell_size_aware_dispatch =
+        make_haswell_size_aware_dispatch();
+    #endif
+    return &haswell_size_aware_dispatch;
+  }
+  #endif
+  #if SIMDUTF_IMPLEMENTATION_WESTMERE
+  if (impl == get_westmere_singleton()) {
+    #if !SIMDUTF_USE_STATIC_INITIALIZATION
+    static const size_aware_dispatch westmere_size_aware_dispatch =
+        make_westmere_size_aware_dispatch();
+    #endif
+    return &westmere_size_aware_dispatch;
+  }
+  #endif
+  (void)impl;
+  return &no_size_aware_dispatch;
+}
+
+  #if SIMDUTF_USE_STATIC_INITIALIZATION
+static atomic_ptr<const size_aware_dispatch> active_size_aware_dispatch{
+    &no_size_aware_dispatch};
+  #endif
+static atomic_ptr<const size_aware_dispatch> &
+get_active_size_aware_dispatch() noexcept {
+  #if !SIMDUTF_USE_STATIC_INITIALIZATION
+  static atomic_ptr<const size_aware_dispatch> active_size_aware_dispatch{
+      &no_size_aware_dispatch};
+  #endif
+  return active_size_aware_dispatch;
+}
+
+  #if SIMDUTF_AUTOTUNE
+// The synthetic inputs on which the implementations are timed: a few
+// kilobytes of text, mostly ASCII with some accented letters, Greek and CJK.
+// The Latin 1 input only keeps the ASCII and accented pieces.
+struct autotune_inputs {
+  std::vector<char> ascii{};
+  std::vector<char> utf8{};
+  std::vector<char> latin1_utf8{};
+  std::vector<char> latin1{};
+  std::vector<char16_t> utf16{};
+  std::vector<char32_t> utf32{};
+  std::vector<char> base64{};
+  std::vector<char> output{};
+  std::vector<char16_t> output16{};
+  std::vector<char32_t> output32{};
+  size_t sink{0};
+
+  autotune_inputs() {
+    static const char32_t *const pieces[] = {
+        U"The quick brown fox jumps over the lazy dog. ",
+        U"d\u00e9j\u00e0 vu, ", U"\u03b1\u03b2\u03b3 ", U"\u4e2d\u6587 "};
+    constexpr size_t length = 4096;
+    for (size_t i = 0; utf32.size() < length; i++) {
+      const size_t piece = i % 8 < 5 ? 0 : i % 8 - 4; // mostly ASCII
+      for (const char32_t *c = pieces[piece]; *c != 0; c++) {
+        append(*c, piece < 2);
+      }
+    }
+    const size_t sentence = std::char_traits<char32_t>::length(pieces[0]);
+    for (size_t i = 0; i < length; i++) {
+      ascii.push_back(char(pieces[0][i % sentence]));
+    }
+    base64.resize(length / 3 * 4);
+    output.resize(4 * utf32.size());
+    output16.resize(utf32.size());
+    output32.resize(utf32.size());
+  }
+
+  void append(char32_t c, bool in_latin1) {
+    utf32.push_back(c);
+    if (c < 0x10000) {
+      utf16.push_back(char16_t(c));
+    }
+    if (in_latin1) {
+      latin1.push_back(char(c));
+    }
+    char encoded[3];
+    size_t bytes = 1;
+    if (c < 0x80) {
+      encoded[0] = char(c);
+    } else if (c < 0x800) {
+      encoded[0] = char(0xc0 | (c >> 6));
+      encoded[1] = char(0x80 | (c & 0x3f));
+      bytes = 2;
+    } else {
+      encoded[0] = char(0xe0 | (c >> 12));
+      encoded[1] = char(0x80 | ((c >> 6) & 0x3f));
+      encoded[2] = char(0x80 | (c & 0x3f));
+      bytes = 3;
+    }
+    utf8.insert(utf8.end(), encoded, encoded + bytes);
+    if (in_latin1) {
+      latin1_utf8.insert(latin1_utf8.end(), encoded, encoded + bytes);
+    }
+  }
+};
+
+// Runs a function on the synthetic inputs, returns false if it is not
+// compiled in.
+static bool run_sized_function(const implementation *impl,
+                               sized_function function,
+                               autotune_inputs &in) noexcept {
+  size_t r = 0;
+  switch (function) {
+    #if SIMDUTF_FEATURE_UTF8
+  case sized_function::validate_utf8:
+    r = impl->validate_utf8(in.utf8.data(), in.utf8.size());
+    break;
+  case sized_function::count_utf8:
+    r = impl->count_utf8(in.utf8.data(), in.utf8.size());
+    break;
+    #endif // SIMDUTF_FEATURE_UTF8
+    #if SIMDUTF_FEATURE_ASCII
+  case sized_function::validate_ascii:
+    r = impl->validate_ascii(in.ascii.data(), in.ascii.size());
+    break;
+    #endif // SIMDUTF_FEATURE_ASCII
+    #if SIMDUTF_FEATURE_UTF16
+  case sized_function::count_utf16:
+    r = impl->count_utf16le(in.utf16.data(), in.utf16.size());
+    break;
+    #endif // SIMDUTF_FEATURE_UTF16
+    #if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+  case sized_function::utf16_length_from_utf8:
+    r = impl->utf16_length_from_utf8(in.utf8.data(), in.utf8.size());
+    break;
+  case sized_function::utf8_length_from_utf16:
+    r = impl->utf8_length_from_utf16le(in.utf16.data(), in.utf16.size());
+    break;
+  case sized_function::convert_utf8_to_utf16:
+    r = impl->convert_utf8_to_utf16le(in.utf8.data(), in.utf8.size(),
+                                      in.output16.data());
+    break;
+  case sized_function::convert_valid_utf8_to_utf16:
+    r = impl->convert_valid_utf8_to_utf16le(in.utf8.data(), in.utf8.size(),
+                                            in.output16.data());
+    break;
+  case sized_function::convert_utf16_to_utf8:
+    r = impl->convert_utf16le_to_utf8(in.utf16.data(), in.utf16.size(),
+                                      in.output.data());
+    break;
+  case sized_function::convert_valid_utf16_to_utf8:
+    r = impl->convert_valid_utf16le_to_utf8(in.utf16.data(), in.utf16.size(),
+                                            in.output.data());
+    break;
+    #endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+    #if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_LATIN1
+  case sized_function::utf8_length_from_latin1:
+    r = impl->utf8_length_from_latin1(in.latin1.data(), in.latin1.size());
+    break;
+  case sized_function::convert_latin1_to_utf8:
+    r = impl->convert_latin1_to_utf8(in.latin1.data(), in.latin1.size(),
+                                     in.output.data());
+    break;
+  case sized_function::convert_utf8_to_latin1:
+    r = impl->convert_utf8_to_latin1(in.latin1_utf8.data(),
+                                     in.latin1_utf8.size(), in.output.data());
+    break;
+    #endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_LATIN1
+    #if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
+  case sized_function::convert_utf8_to_utf32:
+    r = impl->convert_utf8_to_utf32(in.utf8.data(), in.utf8.size(),
+                                    in.output32.data());
+    break;
+  case sized_function::convert_utf32_to_utf8:
+    r = impl->convert_utf32_to_utf8(in.utf32.data(), in.utf32.size(),
+                                    in.output.data());
+    break;
+    #endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
+    #if SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32
+  case sized_function::convert_utf16_to_utf32:
+    r = impl->convert_utf16le_to_utf32(in.utf16.data(), in.utf16.size(),
+                                       in.output32.data());
+    break;
+    #endif // SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32
+    #if SIMDUTF_FEATURE_BASE64
+  case sized_function::base64_to_binary:
+    r = impl->base64_to_binary(in.base64.data(), in.base64.size(),
+                               in.output.data())
+            .count;
+    break;
+  case sized_function::binary_to_base64:
+    r = impl->binary_to_base64(in.utf8.data(), in.base64.size() / 4 * 3,
+                               in.output.data());
+    break;
+    #endif // SIMDUTF_FEATURE_BASE64
+  default:
+    return false;
+  }
+  in.sink += r;
+  return true;
+}
+
+// Returns the best of a few timings of a function, in nanoseconds.
+static double time_sized_function(const implementation *impl,
+                                  sized_function function,
+                                  autotune_inputs &in) noexcept {
+  double best = 0;
+  for (int trial = 0; trial < 8; trial++) {
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < 4; i++) {
+      run_sized_function(impl, function, in);
+    }
+    const double elapsed = std::chrono::duration<double, std::nano>(
+                               std::chrono::steady_clock::now() - start)
+                               .count();
+    if (trial == 0 || elapsed < best) {
+      best = elapsed;
+    }
+  }
+  return best;
+}
+
+// The autotuned dispatch. Other threads may read it at any time once it is
+// published, so it is made at most once per process: the state goes from
+// free (0) to being made (1), and to published (2), or back to free if the
+// profile was malformed. The free functions only look for autotuned choices
+// on the longer inputs once the flag autotuned is set.
+static size_aware_dispatch tuned_dispatch{};
+static std::atomic<int> tuned_dispatch_state{0};
+static std::atomic<bool> autotuned{false};
+
+// Returns the autotuned dispatch, a copy of the dispatch of an implementation
+// whose fastest implementations can be filled, or nullptr if it was already
+// made.
+static size_aware_dispatch *
+make_tunable_dispatch(const implementation *active) noexcept {
+  int expected = 0;
+  if (!tuned_dispatch_state.compare_exchange_strong(expected, 1)) {
+    return nullptr;
+  }
+  tuned_dispatch = *get_size_aware_dispatch_for(active);
+  tuned_dispatch.wide = active;
+  tuned_dispatch.tuned = true;
+  return &tuned_dispatch;
+}
+
+static void discard_tuned_dispatch() noexcept {
+  tuned_dispatch_state.store(0);
+}
+
+static void
+publish_tuned_dispatch(const size_aware_dispatch *dispatch) noexcept {
+  get_active_size_aware_dispatch() = dispatch;
+  tuned_dispatch_state.store(2);
+  autotuned.store(true);
+}
+
+// Times every supported implementation on each function and returns the
+// resulting dispatch. Another implementation only replaces the active one
+// when it saves at least 10%, so that noise does not move the choice.
+static const size_aware_dispatch *
+make_tuned_dispatch(const implementation *active) noexcept {
+  size_aware_dispatch *dispatch = make_tunable_dispatch(active);
+  if (dispatch == nullptr) {
+    return nullptr;
+  }
+  autotune_inputs in;
+    #if SIMDUTF_FEATURE_BASE64
+  active->binary_to_base64(in.utf8.data(), in.base64.size() / 4 * 3,
+                           in.base64.data());
+    #endif // SIMDUTF_FEATURE_BASE64
+  for (size_t f = 0; f < size_t(sized_function::count); f++) {
+    const sized_function function = sized_function(f);
+    if (!run_sized_function(active, function, in)) {
+      continue;
+    }
+    const double active_time = time_sized_function(active, function, in);
+    double best_time = active_time;
+    for (const implementation *impl : get_available_implementations()) {
+      if (impl == active || !impl->supported_by_runtime_system()) {
+        continue;
+      }
+      const double time = time_sized_function(impl, function, in);
+      if (time < best_time && time < 0.9 * active_time) {
+        best_time = time;
+        dispatch->fastest[f] = impl;
+      }
+    }
+  }
+  return dispatch;
+}
+
+// Reads a profile written by save_autotune_profile: one line per function,
+// with its name and that of its implementation. The functions and the
+// implementations unknown to this build or unsupported by this processor
+// are skipped. The last line may lack its newline, and the lines may end with
+// "\r\n". When missing is not null, it tells whether the file does not exist,
+// as opposed to a file that could not be read or parsed.
+static const size_aware_dispatch *
+load_tuned_dispatch(const implementation *active, const char *filename,
+                    bool *missing = nullptr) noexcept {
+  errno = 0;
+  SIMDUTF_PUSH_DISABLE_WARNINGS
+  SIMDUTF_DISABLE_DEPRECATED_WARNING // fopen is safe here
+      std::FILE *file = std::fopen(filename, "r");
+  SIMDUTF_POP_DISABLE_WARNINGS
+  if (missing != nullptr) {
+    *missing = file == nullptr && errno == ENOENT;
+  }
+  if (file == nullptr) {
+    return nullptr;
+  }
+  size_aware_dispatch *dispatch = make_tunable_dispatch(active);
+  char line[128];
+  while (dispatch != nullptr && std::fgets(line, sizeof(line), file)) {
+    char *separator = std::strchr(line, ' ');
+    char *end = std::strchr(line, '\n');
+    if (end == nullptr && std::feof(file)) {
+      end = line + std::strlen(line); // the last line
+    }
+    if (end != nullptr && end > line && end[-1] == '\r') {
+      end--;
+    }
+    if (separator == nullptr || end == nullptr || separator > end) {
+      discard_tuned_dispatch(); // malformed, or a line too long
+      dispatch = nullptr;
+      break;
+    }
+    *separator = '\0';
+    const implementation *impl = get_available_implementations()[
+        std::string_view(separator + 1, size_t(end - separator - 1))];
+    for (size_t f = 0; f < size_t(sized_function::count); f++) {
+      if (std::strcmp(line, sized_function_names[f]) == 0 &&
+          impl != nullptr && impl != active &&
+          impl->supported_by_runtime_system()) {
+        dispatch->fastest[f] = impl;
+      }
+    }
+  }
+  if (dispatch != nullptr && std::ferror(file)) {
+    discard_tuned_dispatch();
+    dispatch = nullptr;
+  }
+  std::fclose(file);
+  return dispatch;
+}
+
+// Writes the profile of a dispatch. Unless replace, an existing file is left
+// as it is and the function returns false.
+static bool save_tuned_dispatch(const implementation *active,
+                                const size_aware_dispatch *dispatch,
+                                const char *filename,
+                                bool replace = true) noexcept {
+  SIMDUTF_PUSH_DISABLE_WARNINGS
+  SIMDUTF_DISABLE_DEPRECATED_WARNING // fopen is safe here
+      std::FILE *file = std::fopen(filename, replace ? "w" : "wx");
+  SIMDUTF_POP_DISABLE_WARNINGS
+  if (file == nullptr) {
+    return false;
+  }
+  bool ok = true;
+  for (size_t f = 0; f < size_t(sized_function::count); f++) {
+    const implementation *impl =
+        dispatch->wide == active && dispatch->fastest[f] != nullptr
+            ? dispatch->fastest[f]
+            : active;
+    const std::string_view name = impl->name();
+    ok = ok && std::fprintf(file, "%s %.*s\n", sized_function_names[f],
+                            int(name.size()), name.data()) > 0;
+  }
+  return std::fclose(file) == 0 && ok;
+}
+
+// Applies the SIMDUTF_AUTOTUNE environment variable once the best
+// implementation is detected: "1" times the implementations, and any other
+// value is the path of a profile, loaded if it exists and saved if it does
+// not. A profile that exists but cannot be loaded is left as it is, and the
+// implementations are timed.
+static void autotune_on_first_use(const implementation *best,
+                                  const char *setting) noexcept {
+  const size_aware_dispatch *dispatch = nullptr;
+  const bool has_profile = std::strcmp(setting, "1") != 0;
+  bool missing = false;
+  if (has_profile) {
+    dispatch = load_tuned_dispatch(best, setting, &missing);
+  }
+  if (dispatch == nullptr) {
+    dispatch = make_tuned_dispatch(best);
+    if (dispatch != nullptr && has_profile && missing) {
+      save_tuned_dispatch(best, dispatch, setting, false);
+    }
+  }
+  if (dispatch != nullptr) {
+    publish_tuned_dispatch(dispatch);
+  }
+}
+  #endif // SIMDUTF_AUTOTUNE
+#endif // SIMDUTF_SIZE_AWARE_DISPATCH
+
 /**
  * @private Detects best supported implementation on first use, and sets it
  */
@@ -745,8 +1481,90 @@ public:
   count_utf8(const char *buf, size_t len) const noexcept final override {
     return set_best()->count_utf8(buf, len);
   }
+
+  simdutf_warn_unused size_t
+  to_lower_ascii_utf8(const char *input, size_t length,
+                      char *output) const noexcept final override {
+    return set_best()->to_lower_ascii_utf8(input, length, output);
+  }
+
+  simdutf_warn_unused size_t
+  to_upper_ascii_utf8(const char *input, size_t length,
+                      char *output) const noexcept final override {
+    return set_best()->to_upper_ascii_utf8(input, length, output);
+  }
+
+  simdutf_warn_unused bool
+  equals_ignore_case_utf8(const char *input1, size_t length1,
+                          const char *input2,
+                          size_t length2) const noexcept final override {
+    return set_best()->equals_ignore_case_utf8(input1, length1, input2,
+                                               length2);
+  }
+#endif // SIMDUTF_FEATURE_UTF8
+
+#if SIMDUTF_FEATURE_UTF8
+  simdutf_warn_unused nfc_quick_check_result
+  is_nfc_quick_utf8(const char *input,
+                    size_t length) const noexcept final override {
+    return set_best()->is_nfc_quick_utf8(input, length);
+  }
 #endif // SIMDUTF_FEATURE_UTF8
 
+#if SIMDUTF_FEATURE_UTF16
+  simdutf_warn_unused nfc_quick_check_result
+  is_nfc_quick_utf16le(const char16_t *input,
+                       size_t length) const noexcept final override {
+    return set_best()->is_nfc_quick_utf16le(input, length);
+  }
+
+  simdutf_warn_unused nfc_quick_check_result
+  is_nfc_quick_utf16be(const char16_t *input,
+                       size_t length) const noexcept final override {
+    return set_best()->is_nfc_quick_utf16be(input, length);
+  }
+#endif // SIMDUTF_FEATURE_UTF16
+
+#if SIMDUTF_FEATURE_UTF8
+  simdutf_warn_unused size_t
+  display_width_utf8(const char *input,
+                     size_t length) const noexcept final override {
+    return set_best()->display_width_utf8(input, length);
+  }
+
+  simdutf_warn_unused size_t
+  count_graphemes_utf8(const char *input,
+                       size_t length) const noexcept final override {
+    return set_best()->count_graphemes_utf8(input, length);
+  }
+
+  simdutf_warn_unused result
+  escape_html_utf8(const char *input, size_t length,
+                   char *output) const noexcept final override {
+    return set_best()->escape_html_utf8(input, length, output);
+  }
+
+  simdutf_warn_unused result
+  escape_xml_utf8(const char *input, size_t length,
+                  char *output) const noexcept final override {
+    return set_best()->escape_xml_utf8(input, length, output);
+  }
+#endif // SIMDUTF_FEATURE_UTF8
+
+#if SIMDUTF_FEATURE_UTF16
+  simdutf_warn_unused size_t
+  display_width_utf16le(const char16_t *input,
+                        size_t length) const noexcept final override {
+    return set_best()->display_width_utf16le(input, length);
+  }
+
+  simdutf_warn_unused size_t
+  display_width_utf16be(const char16_t *input,
+                        size_t length) const noexcept final override {
+    return set_best()->display_width_utf16be(input, length);
+  }
+#endif // SIMDUTF_FEATURE_UTF16
+
 #if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_LATIN1
   simdutf_warn_unused size_t
   latin1_length_from_utf8(const char *buf, size_t len) const noexcept override {
@@ -1361,8 +2179,79 @@ public:
                                         size_t) const noexcept final override {
     return 0;
   }
+
+  simdutf_warn_unused size_t to_lower_ascii_utf8(
+      const char *, size_t, char *) const noexcept final override {
+    return 0;
+  }
+
+  simdutf_warn_unused size_t to_upper_ascii_utf8(
+      const char *, size_t, char *) const noexcept final override {
+    return 0;
+  }
+
+  simdutf_warn_unused bool
+  equals_ignore_case_utf8(const char *, size_t, const char *,
+                          size_t) const noexcept final override {
+    return false;
+  }
+#endif // SIMDUTF_FEATURE_UTF8
+
+#if SIMDUTF_FEATURE_UTF8
+  simdutf_warn_unused nfc_quick_check_result
+  is_nfc_quick_utf8(const char *, size_t) const noexcept final override {
+    return nfc_quick_check_no;
+  }
+#endif // SIMDUTF_FEATURE_UTF8
+
+#if SIMDUTF_FEATURE_UTF16
+  simdutf_warn_unused nfc_quick_check_result
+  is_nfc_quick_utf16le(const char16_t *, size_t) const noexcept final override {
+    return nfc_quick_check_no;
+  }
+
+  simdutf_warn_unused nfc_quick_check_result
+  is_nfc_quick_utf16be(const char16_t *, size_t) const noexcept final override {
+    return nfc_quick_check_no;
+  }
+#endif // SIMDUTF_FEATURE_UTF16
+
+#if SIMDUTF_FEATURE_UTF8
+  simdutf_warn_unused size_t
+  display_width_utf8(const char *, size_t) const noexcept final override {
+    return 0;
+  }
+
+  simdutf_warn_unused size_t
+  count_graphemes_utf8(const char *, size_t) const noexcept final override {
+    return 0;
+  }
+
+  simdutf_warn_unused result escape_html_utf8(
+      const char *, size_t, char *) const noexcept final override {
+    return result(error_code::OTHER, 0);
+  }
+
+  simdutf_warn_unused result escape_xml_utf8(
+      const char *, size_t, char *) const noexcept final override {
+    return result(error_code::OTHER, 0);
+  }
 #endif // SIMDUTF_FEATURE_UTF8
 
+#if SIMDUTF_FEATURE_UTF16
+  simdutf_warn_unused size_t
+  display_width_utf16le(const char16_t *,
+                        size_t) const noexcept final override {
+    return 0;
+  }
+
+  simdutf_warn_unused size_t
+  display_width_utf16be(const char16_t *,
+                        size_t) const noexcept final override {
+    return 0;
+  }
+#endif // SIMDUTF_FEATURE_UTF16
+
 #if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_LATIN1
   simdutf_warn_unused size_t
   latin1_length_from_utf8(const char *, size_t) const noexcept override {
@@ -1541,8 +2430,27 @@ detect_best_supported_implementation_on_first_use::set_best() const noexcept {
       return get_active_implementation() = get_unsupported_singleton();
     }
   }
-  return get_active_implementation() =
-             get_available_implementations().detect_best_supported();
+  const implementation *best =
+      get_available_implementations().detect_best_supported();
+#if SIMDUTF_SIZE_AWARE_DISPATCH
+  // This runs again when the implementation is called through a reference
+  // taken before the detection: the dispatch of the first run, which may be
+  // autotuned, stays.
+  if (get_active_size_aware_dispatch()->wide != best) {
+    get_active_size_aware_dispatch() = get_size_aware_dispatch_for(best);
+  #if SIMDUTF_AUTOTUNE
+    SIMDUTF_PUSH_DISABLE_WARNINGS
+    SIMDUTF_DISABLE_DEPRECATED_WARNING // Disable CRT_SECURE warning on MSVC:
+                                       // manually verified this is safe
+        char *autotune_setting = getenv("SIMDUTF_AUTOTUNE");
+    SIMDUTF_POP_DISABLE_WARNINGS
+    if (autotune_setting != nullptr && autotune_setting[0] != '\0') {
+      autotune_on_first_use(best, autotune_setting);
+    }
+  #endif
+  }
+#endif
+  return get_active_implementation() = best;
 }
 
 } // namespace internal
@@ -1602,30 +2510,740 @@ get_active_implementation() {
 }
 
 #if SIMDUTF_SINGLE_IMPLEMENTATION
-simdutf_really_inline const implementation *get_default_implementation() {
+simdutf_really_inline auto get_default_implementation() {
   return internal::get_single_implementation();
 }
-#else
-simdutf_really_inline internal::atomic_ptr<const implementation> &
-get_default_implementation() {
-  return get_active_implementation();
-}
-#endif
-#define SIMDUTF_GET_CURRENT_IMPLEMENTATION
 
-#if SIMDUTF_FEATURE_UTF8
-simdutf_warn_unused bool validate_utf8(const char *buf, size_t len) noexcept {
-  return get_default_implementation()->validate_utf8(buf, len);
-}
-simdutf_warn_unused result validate_utf8_with_errors(const char *buf,
-                                                     size_t len) noexcept {
-  return get_default_implementation()->validate_utf8_with_errors(buf, len);
-}
-#endif // SIMDUTF_FEATURE_UTF8
+scoped_implementation::scoped_implementation(const implementation *) noexcept
+    : previous{nullptr} {}
+
+scoped_implementation::~scoped_implementation() noexcept {}
+
+namespace internal {
+simdutf_really_inline const implementation *get_scoped_implementation() {
+  return nullptr;
+}
+} // namespace internal
+#else
+namespace internal {
+// The implementation of the calling thread (see scoped_implementation), and
+// the number of overrides in all threads: while there is none, the free
+// functions skip the thread-local lookup.
+  #if defined(SIMDUTF_NO_THREADS)
+static const implementation *thread_implementation{nullptr};
+static size_t scoped_implementation_count{0};
+  #else
+static thread_local const implementation *thread_implementation{nullptr};
+static std::atomic<size_t> scoped_implementation_count{0};
+  #endif
+
+// The implementation of the calling thread, or nullptr if it uses the active
+// implementation.
+simdutf_really_inline const implementation *get_scoped_implementation() {
+  #if defined(SIMDUTF_NO_THREADS)
+  const bool overridden = scoped_implementation_count != 0;
+  #else
+  // An override made by this thread is always visible to it.
+  const bool overridden =
+      scoped_implementation_count.load(std::memory_order_relaxed) != 0;
+  #endif
+  return simdutf_unlikely(overridden) ? thread_implementation : nullptr;
+}
+} // namespace internal
+
+simdutf_really_inline const implementation *get_default_implementation() {
+  const implementation *scoped = internal::get_scoped_implementation();
+  if (simdutf_unlikely(scoped != nullptr)) {
+    return scoped;
+  }
+  return get_active_implementation();
+}
+
+scoped_implementation::scoped_implementation(
+    const implementation *impl) noexcept
+    : previous{internal::thread_implementation} {
+  internal::thread_implementation = impl;
+  #if defined(SIMDUTF_NO_THREADS)
+  internal::scoped_implementation_count++;
+  #else
+  internal::scoped_implementation_count.fetch_add(1,
+                                                  std::memory_order_relaxed);
+  #endif
+}
+
+scoped_implementation::~scoped_implementation() noexcept {
+  internal::thread_implementation = previous;
+  #if defined(SIMDUTF_NO_THREADS)
+  internal::scoped_implementation_count--;
+  #else
+  internal::scoped_implementation_count.fetch_sub(1,
+                                                  std::memory_order_relaxed);
+  #endif
+}
+#endif
+#define SIMDUTF_GET_CURRENT_IMPLEMENTATION
+
+using internal::sized_function;
+
+// Returns the implementation to run a function on an input of the given
+// length (in code units), see SIMDUTF_SIZE_AWARE_DISPATCH. An implementation
+// named by a scoped_implementation runs all the inputs of its thread. With a
+// single implementation, it is returned as its own class (see
+// get_single_implementation).
+simdutf_really_inline auto get_implementation_for(sized_function function,
+                                                  size_t length) {
+#if SIMDUTF_STATISTICS
+  internal::count_call(function, length);
+#endif
+#if SIMDUTF_USDT
+  STAP_PROBE2(simdutf, call_entry,
+              internal::sized_function_names[size_t(function)], length);
+#endif
+#if SIMDUTF_SIZE_AWARE_DISPATCH
+  const implementation *scoped = internal::get_scoped_implementation();
+  if (simdutf_unlikely(scoped != nullptr)) {
+    return scoped;
+  }
+  const implementation *active = get_active_implementation();
+  #if SIMDUTF_AUTOTUNE
+  if (length < internal::max_size_aware_length ||
+      simdutf_unlikely(internal::autotuned.load(std::memory_order_relaxed))) {
+  #else
+  if (length < internal::max_size_aware_length) {
+  #endif
+    const internal::size_aware_dispatch *dispatch =
+        internal::get_active_size_aware_dispatch();
+    if (dispatch->wide == active) {
+      if (length < dispatch->below[size_t(function)]) {
+        return dispatch->narrow[size_t(function)];
+      }
+      if (dispatch->tuned && dispatch->fastest[size_t(function)] != nullptr) {
+        return dispatch->fastest[size_t(function)];
+      }
+    }
+  }
+  return active;
+#else
+  (void)function;
+  (void)length;
+  return get_default_implementation();
+#endif
+}
+
+// Records the end of a call that may have failed: the statistics count the
+// failure (see SIMDUTF_STATISTICS) and the return probe reports the call
+// (see SIMDUTF_USDT).
+simdutf_really_inline void record_return(sized_function function,
+                                         size_t length, size_t value,
+                                         bool failed) {
+#if SIMDUTF_STATISTICS
+  if (failed) {
+    internal::count_error(function);
+  }
+#endif
+#if SIMDUTF_USDT
+  STAP_PROBE4(simdutf, call_return,
+              internal::sized_function_names[size_t(function)], length, value,
+              int(failed));
+#endif
+  (void)function;
+  (void)length;
+  (void)value;
+  (void)failed;
+}
+
+// Returns the result of a function, recording it. The functions returning a
+// size (counts, lengths, conversions of valid inputs) never fail: zero may be
+// a valid answer, as for count_utf8 on continuation bytes.
+simdutf_really_inline bool record_result(sized_function function,
+                                         size_t length, bool valid) {
+  record_return(function, length, valid, !valid);
+  return valid;
+}
+
+simdutf_really_inline size_t record_result(sized_function function,
+                                           size_t length, size_t value) {
+  record_return(function, length, value, false);
+  return value;
+}
+
+// Returns the result of a conversion validating its input, which fails when
+// it writes nothing from a non-empty input.
+simdutf_really_inline size_t record_conversion(sized_function function,
+                                               size_t length, size_t written) {
+  record_return(function, length, written, written == 0 && length != 0);
+  return written;
+}
+
+simdutf_really_inline result record_result(sized_function function,
+                                           size_t length, result r) {
+  record_return(function, length, r.count, r.error != error_code::SUCCESS);
+  return r;
+}
+
+#if (SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_LATIN1) ||                        \
+    (SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16)
+namespace internal {
+// The _nt conversions convert chunks of this many input bytes into a buffer
+// small enough to stay in the L1 cache.
+constexpr size_t non_temporal_chunk = 8192;
+
+// Copies a converted chunk to the output with non-temporal stores where
+// they are available, so that the output does not go through the caches.
+static void copy_non_temporal(char *output, const char *input,
+                              size_t length) noexcept {
+  #if defined(SIMDUTF_IS_X86_64)
+  size_t head = size_t(0 - reinterpret_cast<uintptr_t>(output)) & 15;
+  head = head < length ? head : length;
+  std::memcpy(output, input, head);
+  output += head;
+  input += head;
+  length -= head;
+  for (; length >= 64; length -= 64, input += 64, output += 64) {
+    for (size_t i = 0; i < 64; i += 16) {
+      _mm_stream_si128(
+          reinterpret_cast<__m128i *>(output + i),
+          _mm_loadu_si128(reinterpret_cast<const __m128i *>(input + i)));
+    }
+  }
+  #elif defined(SIMDUTF_IS_ARM64) && defined(__clang__)
+  size_t head = size_t(0 - reinterpret_cast<uintptr_t>(output)) & 7;
+  head = head < length ? head : length;
+  std::memcpy(output, input, head);
+  output += head;
+  input += head;
+  length -= head;
+  for (; length >= 16; length -= 16, input += 16, output += 16) {
+    uint64_t words[2];
+    std::memcpy(words, input, 16);
+    __builtin_nontemporal_store(words[0], reinterpret_cast<uint64_t *>(output));
+    __builtin_nontemporal_store(words[1],
+                                reinterpret_cast<uint64_t *>(output + 8));
+  }
+  #endif
+  std::memcpy(output, input, length);
+}
+
+// Orders the non-temporal stores before the stores that follow.
+static void end_non_temporal() noexcept {
+  #if defined(SIMDUTF_IS_X86_64)
+  _mm_sfence();
+  #endif
+}
+
+// Asks for the next chunk of input to be loaded into the caches.
+static void prefetch_chunk(const char *input, size_t length) noexcept {
+  #if defined(__GNUC__) || defined(__clang__)
+  for (size_t i = 0; i < length; i += 64) {
+    __builtin_prefetch(input + i, 0, 3);
+  }
+  #elif defined(SIMDUTF_IS_X86_64)
+  for (size_t i = 0; i < length; i += 64) {
+    _mm_prefetch(input + i, _MM_HINT_T0);
+  }
+  #else
+  (void)input;
+  (void)length;
+  #endif
+}
+} // namespace internal
+#endif // (SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_LATIN1) ||
+       // (SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16)
+
+// Returns the active implementation, detecting it on first use.
+static const implementation *get_detected_implementation() noexcept {
+  // a first call replaces the detecting implementation by the detected one
+  (void)get_default_implementation()->name();
+  return get_default_implementation();
+}
+
+SIMDUTF_DLLIMPORTEXPORT bool autotune() noexcept {
+#if SIMDUTF_AUTOTUNE
+  const internal::size_aware_dispatch *dispatch =
+      internal::make_tuned_dispatch(get_detected_implementation());
+  if (dispatch == nullptr) {
+    return false;
+  }
+  internal::publish_tuned_dispatch(dispatch);
+  return true;
+#else
+  return false;
+#endif // SIMDUTF_AUTOTUNE
+}
+
+SIMDUTF_DLLIMPORTEXPORT bool
+save_autotune_profile(const char *filename) noexcept {
+#if SIMDUTF_AUTOTUNE
+  return internal::save_tuned_dispatch(
+      get_detected_implementation(),
+      internal::get_active_size_aware_dispatch(), filename);
+#else
+  (void)filename;
+  return false;
+#endif // SIMDUTF_AUTOTUNE
+}
+
+SIMDUTF_DLLIMPORTEXPORT bool
+load_autotune_profile(const char *filename) noexcept {
+#if SIMDUTF_AUTOTUNE
+  const internal::size_aware_dispatch *dispatch =
+      internal::load_tuned_dispatch(get_detected_implementation(), filename);
+  if (dispatch == nullptr) {
+    return false;
+  }
+  internal::publish_tuned_dispatch(dispatch);
+  return true;
+#else
+  (void)filename;
+  return false;
+#endif // SIMDUTF_AUTOTUNE
+}
+
+namespace internal {
+// The functions of the resolved tables call the final class of an
+// implementation by qualified name, which is not a virtual call.
+template <class Impl, const Impl *(*singleton)()> struct resolved_thunks {
+#if SIMDUTF_FEATURE_UTF8
+  static bool validate_utf8(const char *buf, size_t len) noexcept {
+    return singleton()->Impl::validate_utf8(buf, len);
+  }
+  static result validate_utf8_with_errors(const char *buf,
+                                          size_t len) noexcept {
+    return singleton()->Impl::validate_utf8_with_errors(buf, len);
+  }
+  static size_t count_utf8(const char *buf, size_t length) noexcept {
+    return singleton()->Impl::count_utf8(buf, length);
+  }
+#endif // SIMDUTF_FEATURE_UTF8
+#if SIMDUTF_FEATURE_ASCII
+  static bool validate_ascii(const char *buf, size_t len) noexcept {
+    return singleton()->Impl::validate_ascii(buf, len);
+  }
+#endif // SIMDUTF_FEATURE_ASCII
+#if SIMDUTF_FEATURE_UTF16
+  static bool validate_utf16le(const char16_t *buf, size_t len) noexcept {
+    return singleton()->Impl::validate_utf16le(buf, len);
+  }
+  static size_t count_utf16le(const char16_t *buf, size_t length) noexcept {
+    return singleton()->Impl::count_utf16le(buf, length);
+  }
+#endif // SIMDUTF_FEATURE_UTF16
+#if SIMDUTF_FEATURE_UTF32
+  static bool validate_utf32(const char32_t *buf, size_t len) noexcept {
+    return singleton()->Impl::validate_utf32(buf, len);
+  }
+#endif // SIMDUTF_FEATURE_UTF32
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+  static size_t utf16_length_from_utf8(const char *input,
+                                       size_t length) noexcept {
+    return singleton()->Impl::utf16_length_from_utf8(input, length);
+  }
+  static size_t utf8_length_from_utf16le(const char16_t *input,
+                                         size_t length) noexcept {
+    return singleton()->Impl::utf8_length_from_utf16le(input, length);
+  }
+  static size_t convert_utf8_to_utf16le(const char *input, size_t length,
+                                        char16_t *output) noexcept {
+    return singleton()->Impl::convert_utf8_to_utf16le(input, length, output);
+  }
+  static size_t convert_valid_utf8_to_utf16le(const char *input, size_t length,
+                                              char16_t *output) noexcept {
+    return singleton()->Impl::convert_valid_utf8_to_utf16le(input, length,
+                                                            output);
+  }
+  static size_t convert_utf16le_to_utf8(const char16_t *input, size_t length,
+                                        char *output) noexcept {
+    return singleton()->Impl::convert_utf16le_to_utf8(input, length, output);
+  }
+  static size_t convert_valid_utf16le_to_utf8(const char16_t *input,
+                                              size_t length,
+                                              char *output) noexcept {
+    return singleton()->Impl::convert_valid_utf16le_to_utf8(input, length,
+                                                            output);
+  }
+#endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
+  static size_t utf32_length_from_utf8(const char *input,
+                                       size_t length) noexcept {
+    return singleton()->Impl::utf32_length_from_utf8(input, length);
+  }
+  static size_t utf8_length_from_utf32(const char32_t *input,
+                                       size_t length) noexcept {
+    return singleton()->Impl::utf8_length_from_utf32(input, length);
+  }
+  static size_t convert_utf8_to_utf32(const char *input, size_t length,
+                                      char32_t *output) noexcept {
+    return singleton()->Impl::convert_utf8_to_utf32(input, length, output);
+  }
+  static size_t convert_utf32_to_utf8(const char32_t *input, size_t length,
+                                      char *output) noexcept {
+    return singleton()->Impl::convert_utf32_to_utf8(input, length, output);
+  }
+#endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_LATIN1
+  static size_t utf8_length_from_latin1(const char *input,
+                                        size_t length) noexcept {
+    return singleton()->Impl::utf8_length_from_latin1(input, length);
+  }
+  static size_t convert_latin1_to_utf8(const char *input, size_t length,
+                                       char *output) noexcept {
+    return singleton()->Impl::convert_latin1_to_utf8(input, length, output);
+  }
+  static size_t convert_utf8_to_latin1(const char *input, size_t length,
+                                       char *output) noexcept {
+    return singleton()->Impl::convert_utf8_to_latin1(input, length, output);
+  }
+#endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_LATIN1
+#if SIMDUTF_FEATURE_BASE64
+  static result base64_to_binary(const char *input, size_t length, char *output,
+                                 base64_options options,
+                                 last_chunk_handling_options
+                                     last_chunk_options) noexcept {
+    return singleton()->Impl::base64_to_binary(input, length, output, options,
+                                               last_chunk_options);
+  }
+  static size_t binary_to_base64(const char *input, size_t length, char *output,
+                                 base64_options options) noexcept {
+    return singleton()->Impl::binary_to_base64(input, length, output, options);
+  }
+#endif // SIMDUTF_FEATURE_BASE64
+
+  static constexpr resolved_functions make() noexcept {
+    return resolved_functions{
+#if SIMDUTF_FEATURE_UTF8
+        &validate_utf8,
+        &validate_utf8_with_errors,
+        &count_utf8,
+#endif // SIMDUTF_FEATURE_UTF8
+#if SIMDUTF_FEATURE_ASCII
+        &validate_ascii,
+#endif // SIMDUTF_FEATURE_ASCII
+#if SIMDUTF_FEATURE_UTF16
+        &validate_utf16le,
+        &count_utf16le,
+#endif // SIMDUTF_FEATURE_UTF16
+#if SIMDUTF_FEATURE_UTF32
+        &validate_utf32,
+#endif // SIMDUTF_FEATURE_UTF32
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+        &utf16_length_from_utf8,
+        &utf8_length_from_utf16le,
+        &convert_utf8_to_utf16le,
+        &convert_valid_utf8_to_utf16le,
+        &convert_utf16le_to_utf8,
+        &convert_valid_utf16le_to_utf8,
+#endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
+        &utf32_length_from_utf8,
+        &utf8_length_from_utf32,
+        &convert_utf8_to_utf32,
+        &convert_utf32_to_utf8,
+#endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_LATIN1
+        &utf8_length_from_latin1,
+        &convert_latin1_to_utf8,
+        &convert_utf8_to_latin1,
+#endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_LATIN1
+#if SIMDUTF_FEATURE_BASE64
+        &base64_to_binary,
+        &binary_to_base64,
+#endif // SIMDUTF_FEATURE_BASE64
+    };
+  }
+};
+
+// The table for the other implementations (those made active by hand, or
+// the unsupported one) runs the free functions.
+static constexpr resolved_functions virtual_resolved_functions{
+#if SIMDUTF_FEATURE_UTF8
+    &simdutf::validate_utf8,
+    &simdutf::validate_utf8_with_errors,
+    &simdutf::count_utf8,
+#endif // SIMDUTF_FEATURE_UTF8
+#if SIMDUTF_FEATURE_ASCII
+    &simdutf::validate_ascii,
+#endif // SIMDUTF_FEATURE_ASCII
+#if SIMDUTF_FEATURE_UTF16
+    &simdutf::validate_utf16le,
+    &simdutf::count_utf16le,
+#endif // SIMDUTF_FEATURE_UTF16
+#if SIMDUTF_FEATURE_UTF32
+    &simdutf::validate_utf32,
+#endif // SIMDUTF_FEATURE_UTF32
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+    &simdutf::utf16_length_from_utf8,
+    &simdutf::utf8_length_from_utf16le,
+    &simdutf::convert_utf8_to_utf16le,
+    &simdutf::convert_valid_utf8_to_utf16le,
+    &simdutf::convert_utf16le_to_utf8,
+    &simdutf::convert_valid_utf16le_to_utf8,
+#endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
+    &simdutf::utf32_length_from_utf8,
+    &simdutf::utf8_length_from_utf32,
+    &simdutf::convert_utf8_to_utf32,
+    &simdutf::convert_utf32_to_utf8,
+#endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_LATIN1
+    &simdutf::utf8_length_from_latin1,
+    &simdutf::convert_latin1_to_utf8,
+    &simdutf::convert_utf8_to_latin1,
+#endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_LATIN1
+#if SIMDUTF_FEATURE_BASE64
+    &simdutf::base64_to_binary,
+    &simdutf::binary_to_base64,
+#endif // SIMDUTF_FEATURE_BASE64
+};
+
+#if SIMDUTF_IMPLEMENTATION_ICELAKE
+static constexpr resolved_functions icelake_resolved_functions =
+    resolved_thunks<icelake::implementation, get_icelake_singleton>::make();
+#endif
+#if SIMDUTF_IMPLEMENTATION_HASWELL
+static constexpr resolved_functions haswell_resolved_functions =
+    resolved_thunks<haswell::implementation, get_haswell_singleton>::make();
+#endif
+#if SIMDUTF_IMPLEMENTATION_WESTMERE
+static constexpr resolved_functions westmere_resolved_functions =
+    resolved_thunks<westmere::implementation, get_westmere_singleton>::make();
+#endif
+#if SIMDUTF_IMPLEMENTATION_ARM64
+static constexpr resolved_functions arm64_resolved_functions =
+    resolved_thunks<arm64::implementation, get_arm64_singleton>::make();
+#endif
+#if SIMDUTF_IMPLEMENTATION_PPC64
+static constexpr resolved_functions ppc64_resolved_functions =
+    resolved_thunks<ppc64::implementation, get_ppc64_singleton>::make();
+#endif
+#if SIMDUTF_IMPLEMENTATION_RVV
+static constexpr resolved_functions rvv_resolved_functions =
+    resolved_thunks<rvv::implementation, get_rvv_singleton>::make();
+#endif
+#if SIMDUTF_IMPLEMENTATION_LASX
+static constexpr resolved_functions lasx_resolved_functions =
+    resolved_thunks<lasx::implementation, get_lasx_singleton>::make();
+#endif
+#if SIMDUTF_IMPLEMENTATION_LSX
+static constexpr resolved_functions lsx_resolved_functions =
+    resolved_thunks<lsx::implementation, get_lsx_singleton>::make();
+#endif
+#if SIMDUTF_IMPLEMENTATION_FALLBACK
+static constexpr resolved_functions fallback_resolved_functions =
+    resolved_thunks<fallback::implementation, get_fallback_singleton>::make();
+#endif
+
+static const resolved_functions *
+get_resolved_functions_for(const implementation *impl) noexcept {
+#if SIMDUTF_IMPLEMENTATION_ICELAKE
+  if (impl == get_icelake_singleton()) {
+    return &icelake_resolved_functions;
+  }
+#endif
+#if SIMDUTF_IMPLEMENTATION_HASWELL
+  if (impl == get_haswell_singleton()) {
+    return &haswell_resolved_functions;
+  }
+#endif
+#if SIMDUTF_IMPLEMENTATION_WESTMERE
+  if (impl == get_westmere_singleton()) {
+    return &westmere_resolved_functions;
+  }
+#endif
+#if SIMDUTF_IMPLEMENTATION_ARM64
+  if (impl == get_arm64_singleton()) {
+    return &arm64_resolved_functions;
+  }
+#endif
+#if SIMDUTF_IMPLEMENTATION_PPC64
+  if (impl == get_ppc64_singleton()) {
+    return &ppc64_resolved_functions;
+  }
+#endif
+#if SIMDUTF_IMPLEMENTATION_RVV
+  if (impl == get_rvv_singleton()) {
+    return &rvv_resolved_functions;
+  }
+#endif
+#if SIMDUTF_IMPLEMENTATION_LASX
+  if (impl == get_lasx_singleton()) {
+    return &lasx_resolved_functions;
+  }
+#endif
+#if SIMDUTF_IMPLEMENTATION_LSX
+  if (impl == get_lsx_singleton()) {
+    return &lsx_resolved_functions;
+  }
+#endif
+#if SIMDUTF_IMPLEMENTATION_FALLBACK
+  if (impl == get_fallback_singleton()) {
+    return &fallback_resolved_functions;
+  }
+#endif
+  return &virtual_resolved_functions;
+}
+} // namespace internal
+
+SIMDUTF_DLLIMPORTEXPORT const resolved_functions &
+resolved_dispatch() noexcept {
+  return *internal::get_resolved_functions_for(get_detected_implementation());
+}
+
+namespace internal {
+// The names of the instruction sets, see instruction_set_name().
+struct instruction_set_entry {
+  uint32_t bit;
+  const char *name;
+};
+static const instruction_set_entry instruction_set_names[] = {
+    {instruction_set::NEON, "NEON"},
+    {instruction_set::AVX2, "AVX2"},
+    {instruction_set::SSE42, "SSE42"},
+    {instruction_set::PCLMULQDQ, "PCLMULQDQ"},
+    {instruction_set::BMI1, "BMI1"},
+    {instruction_set::BMI2, "BMI2"},
+    {instruction_set::ALTIVEC, "ALTIVEC"},
+    {instruction_set::AVX512F, "AVX512F"},
+    {instruction_set::AVX512DQ, "AVX512DQ"},
+    {instruction_set::AVX512IFMA, "AVX512IFMA"},
+    {instruction_set::AVX512PF, "AVX512PF"},
+    {instruction_set::AVX512ER, "AVX512ER"},
+    {instruction_set::AVX512CD, "AVX512CD"},
+    {instruction_set::AVX512BW, "AVX512BW"},
+    {instruction_set::AVX512VL, "AVX512VL"},
+    {instruction_set::AVX512VBMI2, "AVX512VBMI2"},
+    {instruction_set::AVX512VPOPCNTDQ, "AVX512VPOPCNTDQ"},
+    {instruction_set::LSX, "LSX"},
+    {instruction_set::LASX, "LASX"},
+    {instruction_set::RVV, "RVV"},
+    {instruction_set::ZVBB, "ZVBB"},
+};
+
+// Returns the implementations running a function in the calling thread, as
+// get_implementation_for picks them, and whether autotuning chose them.
+static function_dispatch get_function_dispatch(sized_function function,
+                                               bool *tuned) noexcept {
+  function_dispatch entry{sized_function_names[size_t(function)],
+                          get_detected_implementation(), nullptr, 0};
+  *tuned = false;
+  #if SIMDUTF_SIZE_AWARE_DISPATCH
+  const size_aware_dispatch *dispatch = get_active_size_aware_dispatch();
+  if (get_scoped_implementation() == nullptr &&
+      dispatch->wide == entry.chosen) {
+    if (dispatch->below[size_t(function)] != 0) {
+      entry.short_inputs = dispatch->narrow[size_t(function)];
+      entry.below = dispatch->below[size_t(function)];
+    }
+    if (dispatch->fastest[size_t(function)] != nullptr) {
+      entry.chosen = dispatch->fastest[size_t(function)];
+    }
+    *tuned = dispatch->tuned;
+  }
+  #endif // SIMDUTF_SIZE_AWARE_DISPATCH
+  return entry;
+}
+} // namespace internal
+
+SIMDUTF_DLLIMPORTEXPORT uint32_t get_detected_instruction_sets() noexcept {
+  return internal::detect_supported_architectures();
+}
+
+SIMDUTF_DLLIMPORTEXPORT const char *
+instruction_set_name(uint32_t instruction_set) noexcept {
+  for (const internal::instruction_set_entry &entry :
+       internal::instruction_set_names) {
+    if (entry.bit == instruction_set) {
+      return entry.name;
+    }
+  }
+  return nullptr;
+}
+
+SIMDUTF_DLLIMPORTEXPORT size_t
+get_dispatch_report(function_dispatch *output, size_t capacity) noexcept {
+  constexpr size_t count = size_t(sized_function::count);
+  for (size_t f = 0; f < count && f < capacity; f++) {
+    bool tuned;
+    output[f] = internal::get_function_dispatch(sized_function(f), &tuned);
+  }
+  return count;
+}
+
+SIMDUTF_DLLIMPORTEXPORT dispatch_reason
+get_dispatch_reason(const char *function, const implementation *impl) noexcept {
+  const implementation *active = get_detected_implementation();
+  function_dispatch entry{function, active, nullptr, 0};
+  bool tuned = false;
+  for (size_t f = 0; f < size_t(sized_function::count); f++) {
+    if (std::strcmp(function, internal::sized_function_names[f]) == 0) {
+      entry = internal::get_function_dispatch(sized_function(f), &tuned);
+    }
+  }
+  if (impl == entry.chosen) {
+    return dispatch_reason::chosen;
+  }
+  if (impl == entry.short_inputs) {
+    return dispatch_reason::chosen_for_short_inputs;
+  }
+  if (impl == nullptr || !impl->supported_by_runtime_system()) {
+    return dispatch_reason::unsupported;
+  }
+  if (active != get_available_implementations().detect_best_supported() ||
+      internal::get_scoped_implementation() != nullptr) {
+    return dispatch_reason::overridden;
+  }
+  return tuned ? dispatch_reason::slower_when_tuned
+               : dispatch_reason::lower_priority;
+}
+
+#if SIMDUTF_STATISTICS
+SIMDUTF_DLLIMPORTEXPORT size_t
+get_statistics(function_statistics *output, size_t capacity) noexcept {
+  constexpr size_t count = size_t(sized_function::count);
+  function_statistics totals[count];
+  while (internal::statistics_lock.test_and_set(std::memory_order_acquire)) {
+  }
+  internal::sum_thread_counters(totals);
+  for (size_t f = 0; f < count && f < capacity; f++) {
+    const function_statistics &baseline = internal::statistics_baseline[f];
+    output[f] = totals[f];
+    output[f].calls -= baseline.calls;
+    output[f].bytes -= baseline.bytes;
+    output[f].errors -= baseline.errors;
+    for (size_t b = 0; b < statistics_size_buckets; b++) {
+      output[f].size_histogram[b] -= baseline.size_histogram[b];
+    }
+  }
+  internal::statistics_lock.clear(std::memory_order_release);
+  return count;
+}
+
+SIMDUTF_DLLIMPORTEXPORT void reset_statistics() noexcept {
+  while (internal::statistics_lock.test_and_set(std::memory_order_acquire)) {
+  }
+  internal::sum_thread_counters(internal::statistics_baseline);
+  internal::statistics_lock.clear(std::memory_order_release);
+}
+#endif // SIMDUTF_STATISTICS
+
+#if SIMDUTF_FEATURE_UTF8
+simdutf_warn_unused bool validate_utf8(const char *buf, size_t len) noexcept {
+  return record_result(
+      sized_function::validate_utf8, len,
+      get_implementation_for(sized_function::validate_utf8, len)
+          ->validate_utf8(buf, len));
+}
+simdutf_warn_unused result validate_utf8_with_errors(const char *buf,
+                                                     size_t len) noexcept {
+  return get_default_implementation()->validate_utf8_with_errors(buf, len);
+}
+#endif // SIMDUTF_FEATURE_UTF8
 
 #if SIMDUTF_FEATURE_ASCII
 simdutf_warn_unused bool validate_ascii(const char *buf, size_t len) noexcept {
-  return get_default_implementation()->validate_ascii(buf, len);
+  return record_result(
+      sized_function::validate_ascii, len,
+      get_implementation_for(sized_function::validate_ascii, len)
+          ->validate_ascii(buf, len));
 }
 simdutf_warn_unused result validate_ascii_with_errors(const char *buf,
                                                       size_t len) noexcept {
@@ -1666,8 +3284,31 @@ simdutf_warn_unused size_t convert_utf8_to_utf16(
 #if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_LATIN1
 simdutf_warn_unused size_t convert_latin1_to_utf8(const char *buf, size_t len,
                                                   char *utf8_output) noexcept {
-  return get_default_implementation()->convert_latin1_to_utf8(buf, len,
-                                                              utf8_output);
+  return record_result(
+      sized_function::convert_latin1_to_utf8, len,
+      get_implementation_for(sized_function::convert_latin1_to_utf8, len)
+          ->convert_latin1_to_utf8(buf, len, utf8_output));
+}
+simdutf_warn_unused size_t convert_latin1_to_utf8_nt(
+    const char *input, size_t length, char *utf8_output) noexcept {
+  if (length < non_temporal_threshold) {
+    return convert_latin1_to_utf8(input, length, utf8_output);
+  }
+  constexpr size_t chunk = internal::non_temporal_chunk;
+  alignas(64) char buffer[2 * chunk];
+  const auto impl = get_default_implementation();
+  size_t written = 0;
+  for (size_t pos = 0; pos < length; pos += chunk) {
+    const size_t count = chunk < length - pos ? chunk : length - pos;
+    const size_t next = length - pos - count;
+    internal::prefetch_chunk(input + pos + count, chunk < next ? chunk : next);
+    const size_t converted =
+        impl->convert_latin1_to_utf8(input + pos, count, buffer);
+    internal::copy_non_temporal(utf8_output + written, buffer, converted);
+    written += converted;
+  }
+  internal::end_non_temporal();
+  return written;
 }
 #endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_LATIN1
 
@@ -1698,8 +3339,10 @@ simdutf_warn_unused size_t convert_latin1_to_utf32(
 #if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_LATIN1
 simdutf_warn_unused size_t convert_utf8_to_latin1(
     const char *buf, size_t len, char *latin1_output) noexcept {
-  return get_default_implementation()->convert_utf8_to_latin1(buf, len,
-                                                              latin1_output);
+  return record_conversion(
+      sized_function::convert_utf8_to_latin1, len,
+      get_implementation_for(sized_function::convert_utf8_to_latin1, len)
+          ->convert_utf8_to_latin1(buf, len, latin1_output));
 }
 simdutf_warn_unused result convert_utf8_to_latin1_with_errors(
     const char *buf, size_t len, char *latin1_output) noexcept {
@@ -1716,13 +3359,54 @@ simdutf_warn_unused size_t convert_valid_utf8_to_latin1(
 #if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
 simdutf_warn_unused size_t convert_utf8_to_utf16le(
     const char *input, size_t length, char16_t *utf16_output) noexcept {
-  return get_default_implementation()->convert_utf8_to_utf16le(input, length,
-                                                               utf16_output);
+  return record_conversion(
+      sized_function::convert_utf8_to_utf16, length,
+      get_implementation_for(sized_function::convert_utf8_to_utf16, length)
+          ->convert_utf8_to_utf16le(input, length, utf16_output));
+}
+simdutf_warn_unused size_t convert_utf8_to_utf16le_nt(
+    const char *input, size_t length, char16_t *utf16_output) noexcept {
+  if (length < non_temporal_threshold) {
+    return convert_utf8_to_utf16le(input, length, utf16_output);
+  }
+  constexpr size_t chunk = internal::non_temporal_chunk;
+  // There are at most as many UTF-16 code units as UTF-8 bytes.
+  alignas(64) char16_t buffer[chunk];
+  const auto impl = get_default_implementation();
+  size_t written = 0;
+  for (size_t pos = 0; pos < length;) {
+    size_t end = chunk < length - pos ? pos + chunk : length;
+    // Cut the input before the leading byte of a character: more than three
+    // continuation bytes in a row are an error anyway.
+    for (int i = 0; i < 3 && end < length &&
+                    (uint8_t(input[end]) & 0xc0) == 0x80;
+         i++) {
+      end--;
+    }
+    const size_t next = length - end;
+    internal::prefetch_chunk(input + end, chunk < next ? chunk : next);
+    const size_t converted =
+        impl->convert_utf8_to_utf16le(input + pos, end - pos, buffer);
+    if (converted == 0) {
+      internal::end_non_temporal();
+      return 0;
+    }
+    internal::copy_non_temporal(
+        reinterpret_cast<char *>(utf16_output + written),
+        reinterpret_cast<const char *>(buffer),
+        converted * sizeof(char16_t));
+    written += converted;
+    pos = end;
+  }
+  internal::end_non_temporal();
+  return written;
 }
 simdutf_warn_unused size_t convert_utf8_to_utf16be(
     const char *input, size_t length, char16_t *utf16_output) noexcept {
-  return get_default_implementation()->convert_utf8_to_utf16be(input, length,
-                                                               utf16_output);
+  return record_conversion(
+      sized_function::convert_utf8_to_utf16, length,
+      get_implementation_for(sized_function::convert_utf8_to_utf16, length)
+          ->convert_utf8_to_utf16be(input, length, utf16_output));
 }
 simdutf_warn_unused result convert_utf8_to_utf16_with_errors(
     const char *input, size_t length, char16_t *utf16_output) noexcept {
@@ -1747,8 +3431,10 @@ simdutf_warn_unused result convert_utf8_to_utf16be_with_errors(
 #if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
 simdutf_warn_unused size_t convert_utf8_to_utf32(
     const char *input, size_t length, char32_t *utf32_output) noexcept {
-  return get_default_implementation()->convert_utf8_to_utf32(input, length,
-                                                             utf32_output);
+  return record_conversion(
+      sized_function::convert_utf8_to_utf32, length,
+      get_implementation_for(sized_function::convert_utf8_to_utf32, length)
+          ->convert_utf8_to_utf32(input, length, utf32_output));
 }
 simdutf_warn_unused result convert_utf8_to_utf32_with_errors(
     const char *input, size_t length, char32_t *utf32_output) noexcept {
@@ -1930,13 +3616,19 @@ simdutf_warn_unused size_t convert_valid_utf8_to_utf16(
 }
 simdutf_warn_unused size_t convert_valid_utf8_to_utf16le(
     const char *input, size_t length, char16_t *utf16_buffer) noexcept {
-  return get_default_implementation()->convert_valid_utf8_to_utf16le(
-      input, length, utf16_buffer);
+  return record_result(
+      sized_function::convert_valid_utf8_to_utf16, length,
+      get_implementation_for(sized_function::convert_valid_utf8_to_utf16,
+                             length)
+          ->convert_valid_utf8_to_utf16le(input, length, utf16_buffer));
 }
 simdutf_warn_unused size_t convert_valid_utf8_to_utf16be(
     const char *input, size_t length, char16_t *utf16_buffer) noexcept {
-  return get_default_implementation()->convert_valid_utf8_to_utf16be(
-      input, length, utf16_buffer);
+  return record_result(
+      sized_function::convert_valid_utf8_to_utf16, length,
+      get_implementation_for(sized_function::convert_valid_utf8_to_utf16,
+                             length)
+          ->convert_valid_utf8_to_utf16be(input, length, utf16_buffer));
 }
 #endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
 
@@ -2072,14 +3764,18 @@ simdutf_warn_unused result convert_utf16be_to_latin1_with_errors(
 simdutf_warn_unused size_t convert_utf16le_to_utf8(const char16_t *buf,
                                                    size_t len,
                                                    char *utf8_buffer) noexcept {
-  return get_default_implementation()->convert_utf16le_to_utf8(buf, len,
-                                                               utf8_buffer);
+  return record_conversion(
+      sized_function::convert_utf16_to_utf8, len,
+      get_implementation_for(sized_function::convert_utf16_to_utf8, len)
+          ->convert_utf16le_to_utf8(buf, len, utf8_buffer));
 }
 simdutf_warn_unused size_t convert_utf16be_to_utf8(const char16_t *buf,
                                                    size_t len,
                                                    char *utf8_buffer) noexcept {
-  return get_default_implementation()->convert_utf16be_to_utf8(buf, len,
-                                                               utf8_buffer);
+  return record_conversion(
+      sized_function::convert_utf16_to_utf8, len,
+      get_implementation_for(sized_function::convert_utf16_to_utf8, len)
+          ->convert_utf16be_to_utf8(buf, len, utf8_buffer));
 }
 simdutf_warn_unused result convert_utf16_to_utf8_with_errors(
     const char16_t *buf, size_t len, char *utf8_buffer) noexcept {
@@ -2137,13 +3833,17 @@ simdutf_warn_unused size_t convert_valid_utf16_to_latin1(
 #if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
 simdutf_warn_unused size_t convert_valid_utf16le_to_utf8(
     const char16_t *buf, size_t len, char *utf8_buffer) noexcept {
-  return get_default_implementation()->convert_valid_utf16le_to_utf8(
-      buf, len, utf8_buffer);
+  return record_result(
+      sized_function::convert_valid_utf16_to_utf8, len,
+      get_implementation_for(sized_function::convert_valid_utf16_to_utf8, len)
+          ->convert_valid_utf16le_to_utf8(buf, len, utf8_buffer));
 }
 simdutf_warn_unused size_t convert_valid_utf16be_to_utf8(
     const char16_t *buf, size_t len, char *utf8_buffer) noexcept {
-  return get_default_implementation()->convert_valid_utf16be_to_utf8(
-      buf, len, utf8_buffer);
+  return record_result(
+      sized_function::convert_valid_utf16_to_utf8, len,
+      get_implementation_for(sized_function::convert_valid_utf16_to_utf8, len)
+          ->convert_valid_utf16be_to_utf8(buf, len, utf8_buffer));
 }
 #endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
 
@@ -2151,8 +3851,10 @@ simdutf_warn_unused size_t convert_valid_utf16be_to_utf8(
 simdutf_warn_unused size_t convert_utf32_to_utf8(const char32_t *buf,
                                                  size_t len,
                                                  char *utf8_buffer) noexcept {
-  return get_default_implementation()->convert_utf32_to_utf8(buf, len,
-                                                             utf8_buffer);
+  return record_conversion(
+      sized_function::convert_utf32_to_utf8, len,
+      get_implementation_for(sized_function::convert_utf32_to_utf8, len)
+          ->convert_utf32_to_utf8(buf, len, utf8_buffer));
 }
 simdutf_warn_unused result convert_utf32_to_utf8_with_errors(
     const char32_t *buf, size_t len, char *utf8_buffer) noexcept {
@@ -2252,13 +3954,17 @@ simdutf_warn_unused size_t convert_utf16_to_utf32(
 }
 simdutf_warn_unused size_t convert_utf16le_to_utf32(
     const char16_t *buf, size_t len, char32_t *utf32_buffer) noexcept {
-  return get_default_implementation()->convert_utf16le_to_utf32(buf, len,
-                                                                utf32_buffer);
+  return record_conversion(
+      sized_function::convert_utf16_to_utf32, len,
+      get_implementation_for(sized_function::convert_utf16_to_utf32, len)
+          ->convert_utf16le_to_utf32(buf, len, utf32_buffer));
 }
 simdutf_warn_unused size_t convert_utf16be_to_utf32(
     const char16_t *buf, size_t len, char32_t *utf32_buffer) noexcept {
-  return get_default_implementation()->convert_utf16be_to_utf32(buf, len,
-                                                                utf32_buffer);
+  return record_conversion(
+      sized_function::convert_utf16_to_utf32, len,
+      get_implementation_for(sized_function::convert_utf16_to_utf32, len)
+          ->convert_utf16be_to_utf32(buf, len, utf32_buffer));
 }
 simdutf_warn_unused result convert_utf16_to_utf32_with_errors(
     const char16_t *buf, size_t len, char32_t *utf32_buffer) noexcept {
@@ -2313,21 +4019,128 @@ simdutf_warn_unused size_t count_utf16(const char16_t *input,
 }
 simdutf_warn_unused size_t count_utf16le(const char16_t *input,
                                          size_t length) noexcept {
-  return get_default_implementation()->count_utf16le(input, length);
+  return record_result(
+      sized_function::count_utf16, length,
+      get_implementation_for(sized_function::count_utf16, length)
+          ->count_utf16le(input, length));
 }
 simdutf_warn_unused size_t count_utf16be(const char16_t *input,
                                          size_t length) noexcept {
-  return get_default_implementation()->count_utf16be(input, length);
+  return record_result(
+      sized_function::count_utf16, length,
+      get_implementation_for(sized_function::count_utf16, length)
+          ->count_utf16be(input, length));
 }
 #endif // SIMDUTF_FEATURE_UTF16
 
 #if SIMDUTF_FEATURE_UTF8
 simdutf_warn_unused size_t count_utf8(const char *input,
                                       size_t length) noexcept {
-  return get_default_implementation()->count_utf8(input, length);
+  return record_result(
+      sized_function::count_utf8, length,
+      get_implementation_for(sized_function::count_utf8, length)
+          ->count_utf8(input, length));
+}
+
+simdutf_warn_unused size_t to_lower_ascii_utf8(const char *input,
+                                               size_t length,
+                                               char *output) noexcept {
+  return get_default_implementation()->to_lower_ascii_utf8(input, length,
+                                                           output);
+}
+
+simdutf_warn_unused size_t to_upper_ascii_utf8(const char *input,
+                                               size_t length,
+                                               char *output) noexcept {
+  return get_default_implementation()->to_upper_ascii_utf8(input, length,
+                                                           output);
+}
+
+simdutf_warn_unused bool equals_ignore_case_utf8(const char *input1,
+                                                 size_t length1,
+                                                 const char *input2,
+                                                 size_t length2) noexcept {
+  return get_default_implementation()->equals_ignore_case_utf8(
+      input1, length1, input2, length2);
 }
 #endif // SIMDUTF_FEATURE_UTF8
 
+#if SIMDUTF_FEATURE_UTF8
+simdutf_warn_unused nfc_quick_check_result
+is_nfc_quick_utf8(const char *input, size_t length) noexcept {
+  return get_default_implementation()->is_nfc_quick_utf8(input, length);
+}
+#endif // SIMDUTF_FEATURE_UTF8
+
+#if SIMDUTF_FEATURE_UTF16
+simdutf_warn_unused nfc_quick_check_result
+is_nfc_quick_utf16(const char16_t *input, size_t length) noexcept {
+  #if SIMDUTF_IS_BIG_ENDIAN
+  return is_nfc_quick_utf16be(input, length);
+  #else
+  return is_nfc_quick_utf16le(input, length);
+  #endif
+}
+simdutf_warn_unused nfc_quick_check_result
+is_nfc_quick_utf16le(const char16_t *input, size_t length) noexcept {
+  return get_default_implementation()->is_nfc_quick_utf16le(input, length);
+}
+simdutf_warn_unused nfc_quick_check_result
+is_nfc_quick_utf16be(const char16_t *input, size_t length) noexcept {
+  return get_default_implementation()->is_nfc_quick_utf16be(input, length);
+}
+#endif // SIMDUTF_FEATURE_UTF16
+
+#if SIMDUTF_FEATURE_UTF8
+simdutf_warn_unused size_t display_width_utf8(const char *input,
+                                              size_t length) noexcept {
+  return get_default_implementation()->display_width_utf8(input, length);
+}
+
+simdutf_warn_unused size_t count_graphemes_utf8(const char *input,
+                                                size_t length) noexcept {
+  return get_default_implementation()->count_graphemes_utf8(input, length);
+}
+
+simdutf_warn_unused size_t next_grapheme_boundary_utf8(const char *input,
+                                                       size_t length) noexcept {
+  if (length == 0) {
+    return 0;
+  }
+  return scalar::grapheme::next_boundary_utf8(
+      reinterpret_cast<const uint8_t *>(input), length, 0);
+}
+
+simdutf_warn_unused result escape_html_utf8(const char *input, size_t length,
+                                            char *output) noexcept {
+  return get_default_implementation()->escape_html_utf8(input, length, output);
+}
+
+simdutf_warn_unused result escape_xml_utf8(const char *input, size_t length,
+                                           char *output) noexcept {
+  return get_default_implementation()->escape_xml_utf8(input, length, output);
+}
+#endif // SIMDUTF_FEATURE_UTF8
+
+#if SIMDUTF_FEATURE_UTF16
+simdutf_warn_unused size_t display_width_utf16(const char16_t *input,
+                                               size_t length) noexcept {
+  #if SIMDUTF_IS_BIG_ENDIAN
+  return display_width_utf16be(input, length);
+  #else
+  return display_width_utf16le(input, length);
+  #endif
+}
+simdutf_warn_unused size_t display_width_utf16le(const char16_t *input,
+                                                 size_t length) noexcept {
+  return get_default_implementation()->display_width_utf16le(input, length);
+}
+simdutf_warn_unused size_t display_width_utf16be(const char16_t *input,
+                                                 size_t length) noexcept {
+  return get_default_implementation()->display_width_utf16be(input, length);
+}
+#endif // SIMDUTF_FEATURE_UTF16
+
 #if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_LATIN1
 simdutf_warn_unused size_t latin1_length_from_utf8(const char *buf,
                                                    size_t len) noexcept {
@@ -2338,7 +4151,10 @@ simdutf_warn_unused size_t latin1_length_from_utf8(const char *buf,
 #if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_LATIN1
 simdutf_warn_unused size_t utf8_length_from_latin1(const char *buf,
                                                    size_t len) noexcept {
-  return get_default_implementation()->utf8_length_from_latin1(buf, len);
+  return record_result(
+      sized_function::utf8_length_from_latin1, len,
+      get_implementation_for(sized_function::utf8_length_from_latin1, len)
+          ->utf8_length_from_latin1(buf, len));
 }
 #endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_LATIN1
 
@@ -2361,11 +4177,17 @@ simdutf_warn_unused result utf8_length_from_utf16_with_replacement(
 }
 simdutf_warn_unused size_t utf8_length_from_utf16le(const char16_t *input,
                                                     size_t length) noexcept {
-  return get_default_implementation()->utf8_length_from_utf16le(input, length);
+  return record_result(
+      sized_function::utf8_length_from_utf16, length,
+      get_implementation_for(sized_function::utf8_length_from_utf16, length)
+          ->utf8_length_from_utf16le(input, length));
 }
 simdutf_warn_unused size_t utf8_length_from_utf16be(const char16_t *input,
                                                     size_t length) noexcept {
-  return get_default_implementation()->utf8_length_from_utf16be(input, length);
+  return record_result(
+      sized_function::utf8_length_from_utf16, length,
+      get_implementation_for(sized_function::utf8_length_from_utf16, length)
+          ->utf8_length_from_utf16be(input, length));
 }
 #endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
 
@@ -2391,7 +4213,10 @@ simdutf_warn_unused size_t utf32_length_from_utf16be(const char16_t *input,
 #if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
 simdutf_warn_unused size_t utf16_length_from_utf8(const char *input,
                                                   size_t length) noexcept {
-  return get_default_implementation()->utf16_length_from_utf8(input, length);
+  return record_result(
+      sized_function::utf16_length_from_utf8, length,
+      get_implementation_for(sized_function::utf16_length_from_utf8, length)
+          ->utf16_length_from_utf8(input, length));
 }
 simdutf_warn_unused result utf8_length_from_utf16le_with_replacement(
     const char16_t *input, size_t length) noexcept {
@@ -2479,8 +4304,11 @@ maximal_binary_length_from_base64(const char *input, size_t length) noexcept {
 simdutf_warn_unused result base64_to_binary(
     const char *input, size_t length, char *output, base64_options options,
     last_chunk_handling_options last_chunk_handling_options) noexcept {
-  return get_default_implementation()->base64_to_binary(
-      input, length, output, options, last_chunk_handling_options);
+  return record_result(
+      sized_function::base64_to_binary, length,
+      get_implementation_for(sized_function::base64_to_binary, length)
+          ->base64_to_binary(input, length, output, options,
+                             last_chunk_handling_options));
 }
 
 simdutf_warn_unused size_t maximal_binary_length_from_base64(
@@ -2502,8 +4330,11 @@ simdutf_warn_unused size_t binary_length_from_base64(const char16_t *input,
 simdutf_warn_unused result base64_to_binary(
     const char16_t *input, size_t length, char *output, base64_options options,
     last_chunk_handling_options last_chunk_handling_options) noexcept {
-  return get_default_implementation()->base64_to_binary(
-      input, length, output, options, last_chunk_handling_options);
+  return record_result(
+      sized_function::base64_to_binary, length,
+      get_implementation_for(sized_function::base64_to_binary, length)
+          ->base64_to_binary(input, length, output, options,
+                             last_chunk_handling_options));
 }
 
 simdutf_warn_unused full_result base64_to_binary_details(
@@ -2613,8 +4444,10 @@ base64_to_binary_safe(const char16_t *input, size_t length, char *output,
 
 size_t binary_to_base64(const char *input, size_t length, char *output,
                         base64_options options) noexcept {
-  return get_default_implementation()->binary_to_base64(input, length, output,
-                                                        options);
+  return record_result(
+      sized_function::binary_to_base64, length,
+      get_implementation_for(sized_function::binary_to_base64, length)
+          ->binary_to_base64(input, length, output, options));
 }
 
 size_t binary_to_base64_with_lines(const char *input, size_t length,
@@ -204,7 +204,14 @@ convert_utf8_1_to_2_byte_to_utf16(__m128i in, size_t shufutf8_idx) {
 
 #if SIMDUTF_FEATURE_UTF8
   #include "generic/utf8.h"
+  #include "generic/utf8_case.h"
+  #include "generic/grapheme.h"
+  #include "generic/escape.h"
 #endif // SIMDUTF_FEATURE_UTF8
+#if SIMDUTF_FEATURE_UTF8 || SIMDUTF_FEATURE_UTF16
+  #include "generic/nfc.h"
+  #include "generic/display_width.h"
+#endif // SIMDUTF_FEATURE_UTF8 || SIMDUTF_FEATURE_UTF16
 
 #if SIMDUTF_FEATURE_UTF16
   #include "generic/utf16/count_code_points_bytemask.h"
@@ -1224,8 +1231,90 @@ implementation::count_utf8(const char *input, size_t length) const noexcept {
   }
   return count + scalar::utf8::count_code_points(input + pos, length - pos);
 }
+
+simdutf_warn_unused size_t implementation::to_lower_ascii_utf8(
+    const char *input, size_t length, char *output) const noexcept {
+  return utf8_case::generic_map<utf8_case::case_mapping::lower>(input, length,
+                                                                output);
+}
+
+simdutf_warn_unused size_t implementation::to_upper_ascii_utf8(
+    const char *input, size_t length, char *output) const noexcept {
+  return utf8_case::generic_map<utf8_case::case_mapping::upper>(input, length,
+                                                                output);
+}
+
+simdutf_warn_unused bool implementation::equals_ignore_case_utf8(
+    const char *input1, size_t length1, const char *input2,
+    size_t length2) const noexcept {
+  return utf8_case::generic_equals_ignore_case(input1, length1, input2,
+                                                length2);
+}
+#endif // SIMDUTF_FEATURE_UTF8
+
+#if SIMDUTF_FEATURE_UTF8
+simdutf_warn_unused nfc_quick_check_result
+implementation::is_nfc_quick_utf8(const char *input,
+                                  size_t length) const noexcept {
+  return nfc::generic_is_nfc_quick_utf8<utf8_checker>(input, length);
+}
+#endif // SIMDUTF_FEATURE_UTF8
+
+#if SIMDUTF_FEATURE_UTF16
+simdutf_warn_unused nfc_quick_check_result
+implementation::is_nfc_quick_utf16le(const char16_t *input,
+                                     size_t length) const noexcept {
+  return nfc::generic_is_nfc_quick_utf16<endianness::LITTLE>(input,
+                                                             length);
+}
+
+simdutf_warn_unused nfc_quick_check_result
+implementation::is_nfc_quick_utf16be(const char16_t *input,
+                                     size_t length) const noexcept {
+  return nfc::generic_is_nfc_quick_utf16<endianness::BIG>(input, length);
+}
+#endif // SIMDUTF_FEATURE_UTF16
+
+#if SIMDUTF_FEATURE_UTF8
+simdutf_warn_unused size_t
+implementation::display_width_utf8(const char *input,
+                                   size_t length) const noexcept {
+  return display_width::generic_display_width_utf8(input, length);
+}
+
+simdutf_warn_unused size_t
+implementation::count_graphemes_utf8(const char *input,
+                                     size_t length) const noexcept {
+  return grapheme::generic_count_graphemes_utf8(input, length);
+}
+
+simdutf_warn_unused result implementation::escape_html_utf8(
+    const char *input, size_t length, char *output) const noexcept {
+  return escape::generic_escape_utf8<utf8_checker, false>(input, length,
+                                                          output);
+}
+
+simdutf_warn_unused result implementation::escape_xml_utf8(
+    const char *input, size_t length, char *output) const noexcept {
+  return escape::generic_escape_utf8<utf8_checker, true>(input, length,
+                                                         output);
+}
 #endif // SIMDUTF_FEATURE_UTF8
 
+#if SIMDUTF_FEATURE_UTF16
+simdutf_warn_unused size_t
+implementation::display_width_utf16le(const char16_t *input,
+                                      size_t length) const noexcept {
+  return display_width::generic_display_width_utf16<endianness::LITTLE>(input, length);
+}
+
+simdutf_warn_unused size_t
+implementation::display_width_utf16be(const char16_t *input,
+                                      size_t length) const noexcept {
+  return display_width::generic_display_width_utf16<endianness::BIG>(input, length);
+}
+#endif // SIMDUTF_FEATURE_UTF16
+
 #if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_LATIN1
 simdutf_warn_unused size_t implementation::latin1_length_from_utf8(
     const char *buf, size_t len) const noexcept {
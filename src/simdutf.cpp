@@ -52,6 +52,15 @@ SIMDUTF_POP_DISABLE_WARNINGS
 #if SIMDUTF_FEATURE_BASE64
   #include "simdutf/scalar/base64.h"
 #endif // SIMDUTF_FEATURE_BASE64
+#if SIMDUTF_FEATURE_UTF8
+  #include "simdutf/scalar/utf8_case.h"
+  #include "simdutf/scalar/grapheme.h"
+  #include "simdutf/scalar/escape.h"
+#endif // SIMDUTF_FEATURE_UTF8
+#if SIMDUTF_FEATURE_UTF8 || SIMDUTF_FEATURE_UTF16
+  #include "simdutf/scalar/nfc.h"
+  #include "simdutf/scalar/display_width.h"
+#endif // SIMDUTF_FEATURE_UTF8 || SIMDUTF_FEATURE_UTF16
 
 #if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
   #include "simdutf/scalar/utf32_to_utf8/valid_utf32_to_utf8.h"
@@ -243,7 +243,50 @@ public:
 #if SIMDUTF_FEATURE_UTF8
   simdutf_warn_unused size_t count_utf8(const char *buf,
                                         size_t length) const noexcept override;
+  simdutf_warn_unused size_t
+  to_lower_ascii_utf8(const char *input, size_t length,
+                      char *output) const noexcept override;
+  simdutf_warn_unused size_t
+  to_upper_ascii_utf8(const char *input, size_t length,
+                      char *output) const noexcept override;
+  simdutf_warn_unused bool
+  equals_ignore_case_utf8(const char *input1, size_t length1,
+                          const char *input2,
+                          size_t length2) const noexcept override;
+#endif // SIMDUTF_FEATURE_UTF8
+#if SIMDUTF_FEATURE_UTF8
+  simdutf_warn_unused nfc_quick_check_result
+  is_nfc_quick_utf8(const char *input, size_t length) const noexcept override;
 #endif // SIMDUTF_FEATURE_UTF8
+#if SIMDUTF_FEATURE_UTF16
+  simdutf_warn_unused nfc_quick_check_result
+  is_nfc_quick_utf16le(const char16_t *input,
+                       size_t length) const noexcept override;
+  simdutf_warn_unused nfc_quick_check_result
+  is_nfc_quick_utf16be(const char16_t *input,
+                       size_t length) const noexcept override;
+#endif // SIMDUTF_FEATURE_UTF16
+#if SIMDUTF_FEATURE_UTF8
+  simdutf_warn_unused size_t
+  display_width_utf8(const char *input, size_t length) const noexcept override;
+  simdutf_warn_unused size_t
+  count_graphemes_utf8(const char *input,
+                       size_t length) const noexcept override;
+  simdutf_warn_unused result
+  escape_html_utf8(const char *input, size_t length,
+                   char *output) const noexcept override;
+  simdutf_warn_unused result
+  escape_xml_utf8(const char *input, size_t length,
+                  char *output) const noexcept override;
+#endif // SIMDUTF_FEATURE_UTF8
+#if SIMDUTF_FEATURE_UTF16
+  simdutf_warn_unused size_t
+  display_width_utf16le(const char16_t *input,
+                        size_t length) const noexcept override;
+  simdutf_warn_unused size_t
+  display_width_utf16be(const char16_t *input,
+                        size_t length) const noexcept override;
+#endif // SIMDUTF_FEATURE_UTF16
 
 #if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
   simdutf_warn_unused size_t utf8_length_from_utf16le(
@@ -108,6 +108,69 @@ size_t simdutf_count_utf8(const char *input, size_t length) {
   return simdutf::count_utf8(input, length);
 }
 
+size_t simdutf_to_lower_ascii_utf8(const char *input, size_t length,
+                                   char *output) {
+  return simdutf::to_lower_ascii_utf8(input, length, output);
+}
+size_t simdutf_to_upper_ascii_utf8(const char *input, size_t length,
+                                   char *output) {
+  return simdutf::to_upper_ascii_utf8(input, length, output);
+}
+bool simdutf_equals_ignore_case_utf8(const char *input1, size_t length1,
+                                     const char *input2, size_t length2) {
+  return simdutf::equals_ignore_case_utf8(input1, length1, input2, length2);
+}
+
+simdutf_nfc_quick_check_result simdutf_is_nfc_quick_utf8(const char *input,
+                                                         size_t length) {
+  return static_cast<simdutf_nfc_quick_check_result>(
+      simdutf::is_nfc_quick_utf8(input, length));
+}
+simdutf_nfc_quick_check_result
+simdutf_is_nfc_quick_utf16(const char16_t *input, size_t length) {
+  return static_cast<simdutf_nfc_quick_check_result>(
+      simdutf::is_nfc_quick_utf16(input, length));
+}
+simdutf_nfc_quick_check_result
+simdutf_is_nfc_quick_utf16le(const char16_t *input, size_t length) {
+  return static_cast<simdutf_nfc_quick_check_result>(
+      simdutf::is_nfc_quick_utf16le(input, length));
+}
+simdutf_nfc_quick_check_result
+simdutf_is_nfc_quick_utf16be(const char16_t *input, size_t length) {
+  return static_cast<simdutf_nfc_quick_check_result>(
+      simdutf::is_nfc_quick_utf16be(input, length));
+}
+
+size_t simdutf_display_width_utf8(const char *input, size_t length) {
+  return simdutf::display_width_utf8(input, length);
+}
+size_t simdutf_display_width_utf16(const char16_t *input, size_t length) {
+  return simdutf::display_width_utf16(input, length);
+}
+size_t simdutf_display_width_utf16le(const char16_t *input, size_t length) {
+  return simdutf::display_width_utf16le(input, length);
+}
+size_t simdutf_display_width_utf16be(const char16_t *input, size_t length) {
+  return simdutf::display_width_utf16be(input, length);
+}
+
+size_t simdutf_count_graphemes_utf8(const char *input, size_t length) {
+  return simdutf::count_graphemes_utf8(input, length);
+}
+size_t simdutf_next_grapheme_boundary_utf8(const char *input, size_t length) {
+  return simdutf::next_grapheme_boundary_utf8(input, length);
+}
+
+simdutf_result simdutf_escape_html_utf8(const char *input, size_t length,
+                                        char *output) {
+  return to_c_result(simdutf::escape_html_utf8(input, length, output));
+}
+simdutf_result simdutf_escape_xml_utf8(const char *input, size_t length,
+                                       char *output) {
+  return to_c_result(simdutf::escape_xml_utf8(input, length, output));
+}
+
 size_t simdutf_utf8_length_from_latin1(const char *input, size_t length) {
   return simdutf::utf8_length_from_latin1(input, length);
 }
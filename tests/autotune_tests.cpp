@@ -0,0 +1,200 @@
+#include "simdutf.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+// The choice of autotuning is made once per process, so this program checks
+// either a profile (without arguments), the timing (with --timing), or the
+// profile named by the SIMDUTF_AUTOTUNE environment variable (with
+// --first-use and the content of the profile before the first use).
+
+namespace {
+const char *profile_filename = "simdutf_autotune_tests_profile.txt";
+const char *timing_profile_filename = "simdutf_autotune_timing_profile.txt";
+
+#define CHECK(condition)                                                       \
+  do {                                                                         \
+    if (!(condition)) {                                                        \
+      printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition);     \
+      std::remove(profile_filename);                                           \
+      exit(EXIT_FAILURE);                                                      \
+    }                                                                          \
+  } while (0)
+
+// Whether simdutf was built with SIMDUTF_AUTOTUNE, which does nothing with a
+// single implementation.
+bool compiled_in() {
+#if defined(SIMDUTF_AUTOTUNE) && SIMDUTF_AUTOTUNE
+  return simdutf::get_available_implementations().size() > 1;
+#else
+  return false;
+#endif
+}
+
+void write_profile(const std::string &content) {
+  std::FILE *file = std::fopen(profile_filename, "w");
+  CHECK(file != nullptr);
+  CHECK(std::fwrite(content.data(), 1, content.size(), file) ==
+        content.size());
+  std::fclose(file);
+}
+
+std::string read_profile() {
+  std::string content;
+  std::FILE *file = std::fopen(profile_filename, "r");
+  CHECK(file != nullptr);
+  char buffer[256];
+  size_t count;
+  while ((count = std::fread(buffer, 1, sizeof(buffer), file)) > 0) {
+    content.append(buffer, count);
+  }
+  std::fclose(file);
+  return content;
+}
+
+const simdutf::implementation *chosen_for(const char *function) {
+  simdutf::function_dispatch report[64];
+  const size_t count = simdutf::get_dispatch_report(report, 64);
+  for (size_t i = 0; i < count && i < 64; i++) {
+    if (std::strcmp(report[i].name, function) == 0) {
+      return report[i].chosen;
+    }
+  }
+  return nullptr;
+}
+
+// The free functions must give the same results whichever implementation
+// runs them.
+void check_free_functions() {
+  const simdutf::implementation &implementation =
+      *simdutf::get_active_implementation();
+  const std::string input =
+      "autotuning picks an implementation per function: d\xc3\xa9j\xc3\xa0 "
+      "vu, \xe4\xb8\xad\xe6\x96\x87, and a long enough ASCII tail to leave "
+      "the short input thresholds behind.";
+  CHECK(simdutf::validate_utf8(input.data(), input.size()) ==
+        implementation.validate_utf8(input.data(), input.size()));
+  CHECK(simdutf::count_utf8(input.data(), input.size()) ==
+        implementation.count_utf8(input.data(), input.size()));
+  std::u16string utf16(input.size(), u'\0');
+  const size_t utf16_length =
+      simdutf::convert_utf8_to_utf16le(input.data(), input.size(), &utf16[0]);
+  CHECK(utf16_length ==
+        implementation.utf16_length_from_utf8(input.data(), input.size()));
+  std::string utf8(input.size(), '\0');
+  CHECK(simdutf::convert_utf16le_to_utf8(utf16.data(), utf16_length,
+                                         &utf8[0]) == input.size());
+  CHECK(utf8 == input);
+}
+
+void check_profile() {
+  // the failed loads leave the choice to be made
+  write_profile("validate_utf8\n");
+  CHECK(!simdutf::load_autotune_profile(profile_filename));
+  std::remove(profile_filename);
+  CHECK(!simdutf::load_autotune_profile(profile_filename));
+
+  // unknown functions and implementations are skipped, the lines may end
+  // with "\r\n", and the last one may end the file
+  write_profile("validate_utf8 fallback\r\n"
+                "convert_utf8_to_utf16 fallback\r\n"
+                "no_such_function fallback\n"
+                "count_utf8 no_such_implementation");
+  CHECK(simdutf::load_autotune_profile(profile_filename) == compiled_in());
+  check_free_functions();
+  if (!compiled_in()) {
+    std::remove(profile_filename);
+    return;
+  }
+  const simdutf::implementation *fallback =
+      simdutf::get_available_implementations()["fallback"];
+  if (fallback != nullptr && fallback->supported_by_runtime_system()) {
+    CHECK(chosen_for("validate_utf8") == fallback);
+  }
+
+  // the choice is made once
+  CHECK(!simdutf::autotune());
+  CHECK(!simdutf::load_autotune_profile(profile_filename));
+  CHECK(simdutf::save_autotune_profile(profile_filename));
+  const std::string profile = read_profile();
+  if (fallback != nullptr && fallback->supported_by_runtime_system()) {
+    CHECK(profile.find("validate_utf8 fallback\n") != std::string::npos);
+  }
+  check_free_functions();
+  std::remove(profile_filename);
+}
+
+void check_timing() {
+  CHECK(simdutf::autotune() == compiled_in());
+  check_free_functions();
+  if (!compiled_in()) {
+    return;
+  }
+  // the choice is made once
+  CHECK(!simdutf::autotune());
+  CHECK(simdutf::save_autotune_profile(profile_filename));
+  CHECK(!simdutf::load_autotune_profile(profile_filename));
+  CHECK(read_profile().find("validate_utf8 ") != std::string::npos);
+  check_free_functions();
+  std::remove(profile_filename);
+}
+// The profile named by SIMDUTF_AUTOTUNE is loaded on first use when it
+// exists, even if its last line has no newline, and written when it does not
+// exist. A malformed profile is never written over.
+void check_first_use(const char *profile) {
+  const bool missing = std::strcmp(profile, "missing") == 0;
+  const bool unterminated = std::strcmp(profile, "unterminated") == 0;
+  const std::string content =
+      unterminated ? "validate_utf8 fallback" : "validate_utf8\nfallback\n";
+  std::remove(profile_filename);
+  if (!missing) {
+    write_profile(content);
+  }
+  check_free_functions(); // the first use
+  CHECK(!simdutf::autotune());
+  if (!compiled_in()) {
+    std::remove(profile_filename);
+    return;
+  }
+  if (missing) {
+    CHECK(read_profile().find("validate_utf8 ") != std::string::npos);
+  } else {
+    CHECK(read_profile() == content);
+  }
+  const simdutf::implementation *fallback =
+      simdutf::get_available_implementations()["fallback"];
+  if (unterminated && fallback != nullptr &&
+      fallback->supported_by_runtime_system()) {
+    CHECK(chosen_for("validate_utf8") == fallback);
+  }
+  std::remove(profile_filename);
+}
+} // namespace
+
+int main(int argc, char *argv[]) {
+  const char *setting = std::getenv("SIMDUTF_AUTOTUNE");
+  const bool is_set = setting != nullptr && setting[0] != '\0';
+  if (argc > 2 && std::strcmp(argv[1], "--first-use") == 0) {
+    if (!is_set || std::strcmp(setting, "1") == 0) {
+      printf("SIMDUTF_AUTOTUNE must name a profile\n");
+      return EXIT_FAILURE;
+    }
+    profile_filename = setting;
+    check_first_use(argv[2]);
+    return EXIT_SUCCESS;
+  }
+  if (is_set) {
+    printf("SIMDUTF_AUTOTUNE is set, the choice is made on first use\n");
+    return EXIT_SUCCESS;
+  }
+  if (argc > 1 && std::strcmp(argv[1], "--timing") == 0) {
+    // ctest may run both checks at once
+    profile_filename = timing_profile_filename;
+    check_timing();
+  } else {
+    check_profile();
+  }
+  return EXIT_SUCCESS;
+}
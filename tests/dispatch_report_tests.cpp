@@ -0,0 +1,89 @@
+#include "simdutf.h"
+
+#include <cstring>
+#include <vector>
+
+#include <tests/helpers/test.h>
+
+TEST(detected_instruction_sets) {
+  const uint32_t detected = simdutf::get_detected_instruction_sets();
+  for (uint32_t bit = 1; bit != 0; bit <<= 1) {
+    if (detected & bit) {
+      ASSERT_TRUE(simdutf::instruction_set_name(bit) != nullptr);
+    }
+  }
+  ASSERT_TRUE(simdutf::instruction_set_name(0) == nullptr);
+  ASSERT_TRUE(std::strcmp(simdutf::instruction_set_name(
+                              simdutf::internal::instruction_set::AVX512VBMI2),
+                          "AVX512VBMI2") == 0);
+  // the bits shared by several architectures were split
+  ASSERT_TRUE(std::strcmp(
+                  simdutf::instruction_set_name(
+                      simdutf::internal::instruction_set::AVX512VPOPCNTDQ),
+                  "AVX512VPOPCNTDQ") == 0);
+  for (const simdutf::implementation *impl :
+       simdutf::get_available_implementations()) {
+    const uint32_t required = impl->required_instruction_sets();
+    ASSERT_EQUAL((detected & required) == required,
+                 impl->supported_by_runtime_system());
+  }
+}
+
+TEST(dispatch_report) {
+  std::vector<simdutf::function_dispatch> report(1);
+  const size_t count = simdutf::get_dispatch_report(report.data(), 0);
+  report.resize(count);
+  ASSERT_EQUAL(simdutf::get_dispatch_report(report.data(), count), count);
+  const simdutf::implementation *best =
+      simdutf::get_available_implementations().detect_best_supported();
+  for (const simdutf::function_dispatch &entry : report) {
+    // another implementation only gets the function when the tested one was
+    // detected
+    ASSERT_TRUE(entry.chosen == &implementation || &implementation == best);
+    ASSERT_TRUE(simdutf::get_dispatch_reason(entry.name, entry.chosen) ==
+                simdutf::dispatch_reason::chosen);
+    if (entry.short_inputs != nullptr) {
+      ASSERT_TRUE(entry.below > 0);
+      ASSERT_TRUE(
+          simdutf::get_dispatch_reason(entry.name, entry.short_inputs) ==
+          simdutf::dispatch_reason::chosen_for_short_inputs);
+    }
+    for (const simdutf::implementation *impl :
+         simdutf::get_available_implementations()) {
+      if (impl == entry.chosen || impl == entry.short_inputs) {
+        continue;
+      }
+      const simdutf::dispatch_reason reason =
+          simdutf::get_dispatch_reason(entry.name, impl);
+      if (!impl->supported_by_runtime_system()) {
+        ASSERT_TRUE(reason == simdutf::dispatch_reason::unsupported);
+      } else if (&implementation != best) {
+        ASSERT_TRUE(reason == simdutf::dispatch_reason::overridden);
+      } else {
+        ASSERT_TRUE(reason == simdutf::dispatch_reason::lower_priority ||
+                    reason == simdutf::dispatch_reason::slower_when_tuned);
+      }
+    }
+  }
+  // the other functions run on the active implementation
+  ASSERT_TRUE(simdutf::get_dispatch_reason("to_well_formed_utf16le",
+                                           &implementation) ==
+              simdutf::dispatch_reason::chosen);
+}
+
+TEST(dispatch_report_scoped) {
+  for (const simdutf::implementation *impl :
+       simdutf::get_available_implementations()) {
+    if (!impl->supported_by_runtime_system()) {
+      continue;
+    }
+    simdutf::scoped_implementation guard(impl);
+    simdutf::function_dispatch entry;
+    ASSERT_EQUAL(simdutf::get_dispatch_report(&entry, 1), 18);
+    ASSERT_TRUE(std::strcmp(entry.name, "validate_utf8") == 0);
+    ASSERT_TRUE(simdutf::get_dispatch_reason(entry.name, entry.chosen) ==
+                simdutf::dispatch_reason::chosen);
+  }
+}
+
+TEST_MAIN
@@ -0,0 +1,119 @@
+#include "simdutf.h"
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include <tests/helpers/test.h>
+
+namespace {
+constexpr uint64_t seed = 0x123456789ABCDEF0;
+
+// pairs of (character, display width)
+const std::vector<std::pair<std::string, size_t>> characters = {
+    {"a", 1},
+    {" ", 1},
+    {"\t", 0},
+    {"\x7f", 0},
+    {"\xc2\x85", 0},             // U+0085, C1 control
+    {"\xc2\xa0", 1},             // U+00A0
+    {"\xc2\xad", 1},             // U+00AD, soft hyphen
+    {"\xc3\xa9", 1},             // U+00E9
+    {"\xcc\x81", 0},             // U+0301, combining mark
+    {"\xd0\x96", 1},             // U+0416
+    {"\xe1\x84\x80", 2},         // U+1100, Hangul Jamo leading consonant
+    {"\xe1\x85\xa1", 0},         // U+1161, Hangul Jamo vowel
+    {"\xe2\x80\x8b", 0},         // U+200B, format character
+    {"\xe2\x82\xac", 1},         // U+20AC
+    {"\xe3\x81\x82", 2},         // U+3042
+    {"\xe4\xb8\xad", 2},         // U+4E2D
+    {"\xe6\x96\x87", 2},         // U+6587
+    {"\xea\xb0\x80", 2},         // U+AC00
+    {"\xee\x80\x80", 1},         // U+E000
+    {"\xef\xbc\xa1", 2},         // U+FF21, fullwidth
+    {"\xf0\x90\x90\x80", 1},     // U+10400
+    {"\xf0\x9f\x98\x80", 2},     // U+1F600
+    {"\xf0\xa0\x80\x80", 2},     // U+20000
+    {"\xf3\xa0\x80\x81", 0},     // U+E0001, format character
+};
+
+// Checks the UTF-8 string and its UTF-16LE and UTF-16BE conversions.
+void check(const simdutf::implementation &implementation,
+           const std::string &utf8, size_t expected) {
+  ASSERT_EQUAL(implementation.display_width_utf8(utf8.data(), utf8.size()),
+               expected);
+  std::vector<char16_t> utf16(utf8.size());
+  size_t length = implementation.convert_utf8_to_utf16le(
+      utf8.data(), utf8.size(), utf16.data());
+  ASSERT_TRUE(length > 0 || utf8.empty());
+  ASSERT_EQUAL(implementation.display_width_utf16le(utf16.data(), length),
+               expected);
+  length = implementation.convert_utf8_to_utf16be(utf8.data(), utf8.size(),
+                                                  utf16.data());
+  ASSERT_EQUAL(implementation.display_width_utf16be(utf16.data(), length),
+               expected);
+}
+} // namespace
+
+TEST(display_width_simple) {
+  check(implementation, "", 0);
+  check(implementation, "hello, world", 12);
+  check(implementation, "line\r\n", 4);
+  for (const auto &c : characters) {
+    check(implementation, c.first, c.second);
+    check(implementation, "x" + c.first + "y", c.second + 2);
+  }
+}
+
+TEST(display_width_ascii) {
+  for (size_t length = 0; length < 300; length++) {
+    std::string input(length, '\0');
+    size_t expected = 0;
+    for (size_t i = 0; i < length; i++) {
+      input[i] = char(i % 128);
+      expected += (i % 128 >= 0x20 && i % 128 != 0x7f);
+    }
+    check(implementation, input, expected);
+  }
+}
+
+TEST(display_width_every_position) {
+  // each character at every position of a block, including the C1 controls
+  // straddling two blocks
+  for (const auto &c : characters) {
+    for (size_t prefix = 0; prefix < 130; prefix++) {
+      const std::string input = std::string(prefix, 'x') + c.first + "yz";
+      check(implementation, input, prefix + c.second + 2);
+    }
+  }
+}
+
+TEST(display_width_random) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<size_t> char_dist(0, characters.size() - 1);
+  for (size_t trial = 0; trial < 1000; trial++) {
+    std::string input;
+    size_t expected = 0;
+    const size_t count = trial % 300;
+    for (size_t i = 0; i < count; i++) {
+      const auto &c = characters[char_dist(gen)];
+      input += c.first;
+      expected += c.second;
+    }
+    check(implementation, input, expected);
+  }
+}
+
+TEST(display_width_unpaired_surrogates) {
+  for (size_t prefix = 0; prefix < 70; prefix++) {
+    std::vector<char16_t> input(prefix, u'x');
+    input.push_back(char16_t(0xD800)); // width 1
+    input.push_back(u'y');
+    input.push_back(char16_t(0xDC00)); // width 0
+    ASSERT_EQUAL(
+        implementation.display_width_utf16le(input.data(), input.size()),
+        prefix + 2);
+  }
+}
+
+TEST_MAIN
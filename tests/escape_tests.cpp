@@ -0,0 +1,156 @@
+#include "simdutf.h"
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include <tests/helpers/test.h>
+
+namespace {
+constexpr uint64_t seed = 0x123456789ABCDEF0;
+
+// Pieces of input: plain ASCII, special characters, multi-byte characters
+// (including U+FFFD, which shares its leading byte with U+FFFE and U+FFFF)
+// and the whitespace allowed in XML.
+const std::vector<std::string> pieces = {
+    "a",          "Z",         " ",           "&",
+    "<",          ">",         "\"",          "'",
+    "\t",         "\n",        "\r",          "\xc3\xa9",
+    "\xd0\x96",   "\xe4\xb8\xad", "\xef\xbf\xbd", "\xef\xbc\xa1",
+    "\xf0\x9f\x98\x80",
+};
+
+std::string reference_escape(const std::string &input, bool xml) {
+  std::string out;
+  for (char c : input) {
+    switch (c) {
+    case '&':
+      out += "&amp;";
+      break;
+    case '<':
+      out += "&lt;";
+      break;
+    case '>':
+      out += "&gt;";
+      break;
+    case '"':
+      out += "&quot;";
+      break;
+    case '\'':
+      out += xml ? "&apos;" : "&#39;";
+      break;
+    default:
+      out += c;
+    }
+  }
+  return out;
+}
+
+simdutf::result escape(const simdutf::implementation &implementation,
+                       const std::string &input, bool xml, std::string &out) {
+  std::vector<char> buffer(6 * input.size() + 1);
+  const simdutf::result r =
+      xml ? implementation.escape_xml_utf8(input.data(), input.size(),
+                                           buffer.data())
+          : implementation.escape_html_utf8(input.data(), input.size(),
+                                            buffer.data());
+  if (r.error == simdutf::error_code::SUCCESS) {
+    out.assign(buffer.data(), r.count);
+  }
+  return r;
+}
+
+void check_valid(const simdutf::implementation &implementation,
+                 const std::string &input) {
+  for (bool xml : {false, true}) {
+    std::string out;
+    const simdutf::result r = escape(implementation, input, xml, out);
+    ASSERT_EQUAL(r.error, simdutf::error_code::SUCCESS);
+    ASSERT_TRUE(out == reference_escape(input, xml));
+  }
+}
+} // namespace
+
+TEST(escape_simple) {
+  check_valid(implementation, "");
+  check_valid(implementation, "plain text");
+  std::string out;
+  ASSERT_EQUAL(escape(implementation, "<a href=\"x\">'&'</a>", false, out)
+                   .error,
+               simdutf::error_code::SUCCESS);
+  ASSERT_TRUE(out ==
+              "&lt;a href=&quot;x&quot;&gt;&#39;&amp;&#39;&lt;/a&gt;");
+  ASSERT_EQUAL(escape(implementation, "'", true, out).error,
+               simdutf::error_code::SUCCESS);
+  ASSERT_TRUE(out == "&apos;");
+}
+
+TEST(escape_every_position) {
+  for (const std::string &piece : pieces) {
+    for (size_t prefix = 0; prefix < 140; prefix++) {
+      check_valid(implementation, std::string(prefix, 'x') + piece +
+                                      std::string(70, 'y'));
+      check_valid(implementation, std::string(prefix, 'x') + piece);
+    }
+  }
+}
+
+TEST(escape_random) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<size_t> piece_dist(0, pieces.size() - 1);
+  std::uniform_int_distribution<size_t> plain_run(0, 20);
+  for (size_t trial = 0; trial < 1000; trial++) {
+    std::string input;
+    const size_t count = trial % 500;
+    for (size_t i = 0; i < count; i++) {
+      // mostly plain text, so that many blocks need no escaping
+      input += plain_run(gen) == 0 ? pieces[piece_dist(gen)] : "p";
+    }
+    check_valid(implementation, input);
+  }
+}
+
+TEST(escape_invalid_utf8) {
+  const std::vector<std::string> invalid = {"\xff", "\xc3", "\xed\xa0\x80",
+                                            "\x80", "\xe4\xb8"};
+  for (const std::string &bad : invalid) {
+    for (size_t prefix = 0; prefix < 140; prefix++) {
+      const std::string input =
+          std::string(prefix, '&') + bad + std::string(70, 'z');
+      const simdutf::result expected =
+          simdutf::validate_utf8_with_errors(input.data(), input.size());
+      for (bool xml : {false, true}) {
+        std::string out;
+        const simdutf::result r = escape(implementation, input, xml, out);
+        ASSERT_EQUAL(r.error, expected.error);
+        ASSERT_EQUAL(r.count, expected.count);
+      }
+    }
+  }
+}
+
+TEST(escape_xml_forbidden) {
+  std::vector<std::string> forbidden = {"\xef\xbf\xbe", "\xef\xbf\xbf",
+                                        std::string(1, '\0'), "\x7f\x01"};
+  for (char c = 1; c < 0x20; c++) {
+    if (c != '\t' && c != '\n' && c != '\r') {
+      forbidden.push_back(std::string(1, c));
+    }
+  }
+  for (const std::string &bad : forbidden) {
+    for (size_t prefix = 0; prefix < 140; prefix++) {
+      std::string input = std::string(prefix, '<') + bad + std::string(70, 'z');
+      std::string out;
+      simdutf::result r = escape(implementation, input, true, out);
+      ASSERT_EQUAL(r.error, simdutf::error_code::INVALID_XML_CHARACTER);
+      // U+007F is allowed
+      ASSERT_EQUAL(r.count, bad[0] == '\x7f' ? prefix + 1 : prefix);
+      // HTML escaping does not reject any valid character
+      r = escape(implementation, input, false, out);
+      ASSERT_EQUAL(r.error, simdutf::error_code::SUCCESS);
+      ASSERT_TRUE(out == reference_escape(input, false));
+    }
+  }
+}
+
+TEST_MAIN
@@ -0,0 +1,112 @@
+#include "simdutf.h"
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <tests/helpers/test.h>
+
+namespace {
+constexpr uint64_t seed = 0x123456789ABCDEF0;
+
+// Checks validate_utf8_fixed<N> against validate_utf8 on ASCII, non-ASCII
+// and invalid strings of N bytes.
+template <size_t N> void check_validate_utf8(std::mt19937 &gen) {
+  for (size_t trial = 0; trial < 100; trial++) {
+    std::string input(N, 'a');
+    for (char &c : input) {
+      c = char('!' + gen() % 90);
+    }
+    if (N > 0 && trial % 3 == 1) {
+      input[gen() % N] = char(0xff);
+    }
+    if (N >= 2 && trial % 3 == 2) {
+      const size_t i = gen() % (N - 1);
+      input[i] = char(0xc3); // é
+      input[i + 1] = char(0xa9);
+    }
+    ASSERT_EQUAL(simdutf::validate_utf8_fixed<N>(input.data()),
+                 simdutf::validate_utf8(input.data(), N));
+  }
+}
+
+// Checks base64_to_binary_fixed<N> against base64_to_binary on valid,
+// padded, invalid and spaced inputs of N characters.
+template <size_t N> void check_base64_to_binary(std::mt19937 &gen) {
+  const simdutf::base64_options all_options[] = {
+      simdutf::base64_default, simdutf::base64_url,
+      simdutf::base64_default_or_url};
+  const simdutf::last_chunk_handling_options all_last_chunk_options[] = {
+      simdutf::loose, simdutf::strict,
+      simdutf::last_chunk_handling_options::stop_before_partial};
+  for (size_t trial = 0; trial < 100; trial++) {
+    const simdutf::base64_options options = all_options[trial % 3];
+    // the binary length that gives N characters once encoded, with padding
+    const size_t binary_length = N / 4 * 3 - (trial % 4 == 0 ? 0 : trial % 3);
+    std::string binary(binary_length, '\0');
+    for (char &c : binary) {
+      c = char(gen());
+    }
+    std::string input(N, '\0');
+    const size_t encoded = simdutf::binary_to_base64(
+        binary.data(), binary.size(), &input[0],
+        options == simdutf::base64_url ? simdutf::base64_url
+                                       : simdutf::base64_default);
+    input.resize(encoded);
+    // pad up to N, e.g., for base64_url or when the padding was cut short
+    while (input.size() < N) {
+      input += '=';
+    }
+    if (trial % 5 == 1) {
+      input[gen() % N] = '*';
+    } else if (trial % 5 == 2) {
+      input[gen() % N] = ' ';
+    } else if (trial % 5 == 3 && input[N - 1] == '=') {
+      // leftover bits, rejected by the strict mode
+      input[N - 2] = input[N - 2] == '=' ? '=' : 'B';
+    }
+    for (simdutf::last_chunk_handling_options last_chunk_options :
+         all_last_chunk_options) {
+      std::vector<char> output(N), expected(N);
+      const simdutf::result r = simdutf::base64_to_binary_fixed<N>(
+          input.data(), output.data(), options, last_chunk_options);
+      const simdutf::result e = simdutf::base64_to_binary(
+          input.data(), N, expected.data(), options, last_chunk_options);
+      ASSERT_EQUAL(r.error, e.error);
+      ASSERT_EQUAL(r.count, e.count);
+      if (r.error == simdutf::error_code::SUCCESS) {
+        ASSERT_TRUE(std::equal(output.begin(), output.begin() + r.count,
+                               expected.begin()));
+      }
+    }
+  }
+}
+} // namespace
+
+TEST(validate_utf8_fixed) {
+  std::mt19937 gen(seed);
+  check_validate_utf8<0>(gen);
+  check_validate_utf8<1>(gen);
+  check_validate_utf8<7>(gen);
+  check_validate_utf8<8>(gen);
+  check_validate_utf8<16>(gen);
+  check_validate_utf8<36>(gen);
+  check_validate_utf8<63>(gen);
+  check_validate_utf8<64>(gen);
+  check_validate_utf8<65>(gen);
+  check_validate_utf8<100>(gen);
+}
+
+TEST(base64_to_binary_fixed) {
+  std::mt19937 gen(seed);
+  check_base64_to_binary<4>(gen);
+  check_base64_to_binary<8>(gen);
+  check_base64_to_binary<24>(gen);
+  check_base64_to_binary<44>(gen);
+  check_base64_to_binary<88>(gen);
+  check_base64_to_binary<256>(gen);
+  check_base64_to_binary<300>(gen);
+}
+
+TEST_MAIN
@@ -0,0 +1,129 @@
+#include "simdutf.h"
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include <tests/helpers/test.h>
+
+namespace {
+constexpr uint64_t seed = 0x123456789ABCDEF0;
+
+// Each string is a single extended grapheme cluster, and none of them joins
+// with the previous one.
+const std::vector<std::string> clusters = {
+    "a",
+    "x",
+    " ",
+    "\t",
+    "\r\n",
+    "\n",
+    "\xc3\xa9",                 // U+00E9
+    "e\xcc\x81",                // e U+0301
+    "a\xcc\x81\xcc\x96",        // a U+0301 U+0316
+    "a\xe2\x80\x8d",            // a ZWJ
+    "\xce\xa9",                 // U+03A9
+    "\xd0\x96",                 // U+0416
+    "\xe2\x82\xac",             // U+20AC
+    "\xe4\xb8\xad",             // U+4E2D
+    "\xe0\xa4\x95\xe0\xa4\xbf", // U+0915 U+093F (SpacingMark)
+    "\xd8\x80"
+    "1", // U+0600 (Prepend) 1
+    // Hangul L V T, LV T and LVT
+    "\xe1\x84\x80\xe1\x85\xa1\xe1\x86\xa8",
+    "\xea\xb0\x80\xe1\x86\xa8",
+    "\xea\xb0\x81",
+    // a flag (two regional indicators)
+    "\xf0\x9f\x87\xab\xf0\x9f\x87\xb7",
+    // U+1F44D with a skin tone modifier
+    "\xf0\x9f\x91\x8d\xf0\x9f\x8f\xbd",
+    // an emoji ZWJ sequence
+    "\xf0\x9f\x91\xa8\xe2\x80\x8d\xf0\x9f\x91\xa9\xe2\x80\x8d"
+    "\xf0\x9f\x91\xa7",
+    // U+00A9 ZWJ U+00AE
+    "\xc2\xa9\xe2\x80\x8d\xc2\xae",
+};
+
+// Checks the count and the boundaries of a string made of the given
+// clusters.
+void check(const simdutf::implementation &implementation,
+           const std::vector<std::string> &parts) {
+  std::string input;
+  for (const std::string &part : parts) {
+    input += part;
+  }
+  ASSERT_EQUAL(implementation.count_graphemes_utf8(input.data(), input.size()),
+               parts.size());
+  size_t pos = 0;
+  for (const std::string &part : parts) {
+    ASSERT_EQUAL(simdutf::next_grapheme_boundary_utf8(input.data() + pos,
+                                                      input.size() - pos),
+                 part.size());
+    pos += part.size();
+  }
+  ASSERT_EQUAL(simdutf::next_grapheme_boundary_utf8(input.data() + pos, 0),
+               0);
+}
+} // namespace
+
+TEST(grapheme_simple) {
+  check(implementation, {});
+  for (const std::string &cluster : clusters) {
+    check(implementation, {cluster});
+    check(implementation, {"a", cluster, "b"});
+    check(implementation, {cluster, cluster});
+  }
+}
+
+TEST(grapheme_regional_indicators) {
+  const std::string ri = "\xf0\x9f\x87\xab"; // U+1F1EB
+  check(implementation, {ri});
+  check(implementation, {ri + ri, ri});
+  check(implementation, {ri + ri, ri + ri, ri});
+  check(implementation, {"a", ri + ri, ri + ri});
+}
+
+TEST(grapheme_every_position) {
+  // each cluster at every position of a block, after ASCII, Cyrillic or CJK
+  const std::vector<std::string> fillers = {"x", "\xd0\x96", "\xe4\xb8\xad"};
+  for (const std::string &filler : fillers) {
+    for (const std::string &cluster : clusters) {
+      std::vector<std::string> parts;
+      for (size_t prefix = 0; prefix < 100; prefix++) {
+        std::vector<std::string> with_cluster = parts;
+        with_cluster.push_back(cluster);
+        for (size_t i = 0; i < 70; i++) {
+          with_cluster.push_back(filler);
+        }
+        check(implementation, with_cluster);
+        parts.push_back(filler);
+      }
+    }
+  }
+}
+
+TEST(grapheme_random) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<size_t> cluster_dist(0, clusters.size() - 1);
+  std::uniform_int_distribution<size_t> ascii_run(0, 50);
+  for (size_t trial = 0; trial < 1000; trial++) {
+    std::vector<std::string> parts;
+    const size_t count = trial % 400;
+    for (size_t i = 0; i < count; i++) {
+      // long ASCII runs exercise the block fast path
+      parts.push_back(ascii_run(gen) == 0 ? clusters[cluster_dist(gen)]
+                                          : clusters[gen() % 6]);
+    }
+    check(implementation, parts);
+  }
+}
+
+TEST(grapheme_invalid) {
+  // each invalid byte is a cluster by itself
+  const std::string input = "a\xff\xc3";
+  ASSERT_EQUAL(simdutf::next_grapheme_boundary_utf8(input.data(), 3), 1);
+  ASSERT_EQUAL(simdutf::next_grapheme_boundary_utf8(input.data() + 1, 2), 1);
+  ASSERT_EQUAL(simdutf::next_grapheme_boundary_utf8(input.data() + 2, 1), 1);
+}
+
+TEST_MAIN
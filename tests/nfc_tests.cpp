@@ -0,0 +1,138 @@
+#include "simdutf.h"
+
+#include <string>
+#include <vector>
+
+#include <tests/helpers/test.h>
+
+namespace {
+// Checks the UTF-8 string and its UTF-16LE and UTF-16BE conversions.
+void check(const simdutf::implementation &implementation,
+           const std::string &utf8, simdutf::nfc_quick_check_result expected) {
+  ASSERT_EQUAL(implementation.is_nfc_quick_utf8(utf8.data(), utf8.size()),
+               expected);
+  std::vector<char16_t> utf16(utf8.size());
+  size_t length = implementation.convert_utf8_to_utf16le(
+      utf8.data(), utf8.size(), utf16.data());
+  ASSERT_TRUE(length > 0 || utf8.empty());
+  ASSERT_EQUAL(implementation.is_nfc_quick_utf16le(utf16.data(), length),
+               expected);
+  length = implementation.convert_utf8_to_utf16be(utf8.data(), utf8.size(),
+                                                  utf16.data());
+  ASSERT_EQUAL(implementation.is_nfc_quick_utf16be(utf16.data(), length),
+               expected);
+}
+
+const std::string e_acute = "\xc3\xa9";              // U+00E9
+const std::string combining_acute = "\xcc\x81";      // U+0301, ccc=230, Maybe
+const std::string combining_grave_below = "\xcc\x96"; // U+0316, ccc=220
+const std::string grave_tone_mark = "\xcd\x80";      // U+0340, NFC_QC=No
+const std::string cyrillic_zhe = "\xd0\x96";         // U+0416
+const std::string cjk_compatibility = "\xef\xa4\x80"; // U+F900, NFC_QC=No
+const std::string hangul_syllable = "\xea\xb0\x80";   // U+AC00
+const std::string hangul_jamo_l = "\xe1\x84\x80";     // U+1100
+const std::string hangul_jamo_v = "\xe1\x85\xa1";     // U+1161, Maybe
+const std::string musical_symbol = "\xf0\x9d\x85\x9e"; // U+1D15E, No
+} // namespace
+
+TEST(nfc_quick_check_simple) {
+  check(implementation, "", simdutf::nfc_quick_check_yes);
+  check(implementation, "hello", simdutf::nfc_quick_check_yes);
+  check(implementation, "caf" + e_acute, simdutf::nfc_quick_check_yes);
+  check(implementation, "cafe" + combining_acute,
+        simdutf::nfc_quick_check_maybe);
+  check(implementation, "a" + grave_tone_mark, simdutf::nfc_quick_check_no);
+  check(implementation, cjk_compatibility, simdutf::nfc_quick_check_no);
+  check(implementation, musical_symbol, simdutf::nfc_quick_check_no);
+  check(implementation, hangul_syllable, simdutf::nfc_quick_check_yes);
+  check(implementation, hangul_jamo_l + hangul_jamo_v,
+        simdutf::nfc_quick_check_maybe);
+  check(implementation, cyrillic_zhe + cyrillic_zhe,
+        simdutf::nfc_quick_check_yes);
+}
+
+TEST(nfc_quick_check_canonical_order) {
+  check(implementation, "a" + combining_grave_below + combining_acute,
+        simdutf::nfc_quick_check_maybe);
+  check(implementation, "a" + combining_acute + combining_grave_below,
+        simdutf::nfc_quick_check_no);
+  // the combining class is reset by a starter
+  check(implementation,
+        "a" + combining_acute + "b" + combining_grave_below,
+        simdutf::nfc_quick_check_maybe);
+  check(implementation,
+        "a" + combining_acute + cyrillic_zhe + combining_grave_below,
+        simdutf::nfc_quick_check_maybe);
+}
+
+TEST(nfc_quick_check_every_position) {
+  const std::vector<std::string> fillers = {"x", e_acute, cyrillic_zhe,
+                                            hangul_syllable};
+  for (const std::string &filler : fillers) {
+    std::string prefix;
+    for (size_t i = 0; prefix.size() < 200; i++) {
+      std::string suffix;
+      for (size_t j = 0; j < 40; j++) {
+        suffix += filler;
+      }
+      check(implementation, prefix + suffix, simdutf::nfc_quick_check_yes);
+      check(implementation, prefix + "a" + combining_acute + suffix,
+            simdutf::nfc_quick_check_maybe);
+      check(implementation, prefix + grave_tone_mark + suffix,
+            simdutf::nfc_quick_check_no);
+      check(implementation,
+            prefix + "a" + combining_acute + combining_grave_below + suffix,
+            simdutf::nfc_quick_check_no);
+      prefix += filler;
+    }
+  }
+}
+
+TEST(nfc_quick_check_long_runs) {
+  // a run of combining marks crossing several blocks
+  std::string input = "a";
+  for (size_t i = 0; i < 100; i++) {
+    input += combining_acute;
+  }
+  check(implementation, input, simdutf::nfc_quick_check_maybe);
+  check(implementation, input + combining_grave_below,
+        simdutf::nfc_quick_check_no);
+  std::string cyrillic;
+  for (size_t i = 0; i < 100; i++) {
+    cyrillic += cyrillic_zhe;
+  }
+  check(implementation, cyrillic, simdutf::nfc_quick_check_yes);
+  check(implementation, cyrillic + cjk_compatibility,
+        simdutf::nfc_quick_check_no);
+}
+
+TEST(nfc_quick_check_invalid) {
+  std::string input(100, 'a');
+  ASSERT_EQUAL(implementation.is_nfc_quick_utf8(input.data(), input.size()),
+               simdutf::nfc_quick_check_yes);
+  for (size_t i = 0; i < input.size(); i++) {
+    std::string invalid = input;
+    invalid[i] = char(0xC3); // truncated two-byte character
+    ASSERT_EQUAL(
+        implementation.is_nfc_quick_utf8(invalid.data(), invalid.size()),
+        simdutf::nfc_quick_check_no);
+    invalid[i] = char(0xFF);
+    ASSERT_EQUAL(
+        implementation.is_nfc_quick_utf8(invalid.data(), invalid.size()),
+        simdutf::nfc_quick_check_no);
+  }
+  std::vector<char16_t> utf16(100, u'a');
+  for (size_t i = 0; i < utf16.size(); i++) {
+    std::vector<char16_t> invalid = utf16;
+    invalid[i] = char16_t(0xD800);
+    ASSERT_EQUAL(
+        implementation.is_nfc_quick_utf16le(invalid.data(), invalid.size()),
+        simdutf::nfc_quick_check_no);
+    invalid[i] = char16_t(0x00DC); // U+DC00 in big endian
+    ASSERT_EQUAL(
+        implementation.is_nfc_quick_utf16be(invalid.data(), invalid.size()),
+        simdutf::nfc_quick_check_no);
+  }
+}
+
+TEST_MAIN
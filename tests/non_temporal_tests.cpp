@@ -0,0 +1,74 @@
+#include "simdutf.h"
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <tests/helpers/test.h>
+
+namespace {
+constexpr uint64_t seed = 0x123456789ABCDEF0;
+
+// Characters of every length, so that many of them straddle the chunks of
+// the _nt conversions.
+const std::vector<std::string> pieces = {
+    "a", "\xc3\xa9", "\xe4\xb8\xad", "\xf0\x9f\x98\x80",
+};
+
+std::string make_utf8(std::mt19937 &gen, size_t length) {
+  std::string input;
+  while (input.size() < length) {
+    input += pieces[gen() % pieces.size()];
+  }
+  return input;
+}
+} // namespace
+
+TEST(convert_latin1_to_utf8_nt) {
+  simdutf::scoped_implementation guard(&implementation);
+  std::mt19937 gen(seed);
+  for (size_t length : {size_t(1000), simdutf::non_temporal_threshold,
+                        simdutf::non_temporal_threshold + 12345}) {
+    std::string input(length, '\0');
+    for (char &c : input) {
+      c = char(gen());
+    }
+    // an odd output address, for the unaligned head of the stores
+    std::vector<char> output(2 * length + 1), expected(2 * length);
+    const size_t written = simdutf::convert_latin1_to_utf8_nt(
+        input.data(), length, output.data() + 1);
+    ASSERT_EQUAL(written, implementation.convert_latin1_to_utf8(
+                              input.data(), length, expected.data()));
+    ASSERT_TRUE(std::equal(expected.begin(), expected.begin() + written,
+                           output.begin() + 1));
+  }
+}
+
+TEST(convert_utf8_to_utf16le_nt) {
+  simdutf::scoped_implementation guard(&implementation);
+  std::mt19937 gen(seed);
+  for (size_t length : {size_t(1000), simdutf::non_temporal_threshold,
+                        simdutf::non_temporal_threshold + 12345}) {
+    std::string input = make_utf8(gen, length);
+    std::vector<char16_t> output(input.size() + 1), expected(input.size());
+    const size_t written = simdutf::convert_utf8_to_utf16le_nt(
+        input.data(), input.size(), output.data() + 1);
+    ASSERT_EQUAL(written, implementation.convert_utf8_to_utf16le(
+                              input.data(), input.size(), expected.data()));
+    ASSERT_TRUE(std::equal(expected.begin(), expected.begin() + written,
+                           output.begin() + 1));
+
+    // errors in any chunk, including truncated characters
+    for (size_t position : {size_t(0), input.size() / 2, input.size() - 1}) {
+      std::string invalid = input;
+      invalid[position] = char(0xf0);
+      ASSERT_EQUAL(simdutf::convert_utf8_to_utf16le_nt(
+                       invalid.data(), invalid.size(), output.data()),
+                   implementation.convert_utf8_to_utf16le(
+                       invalid.data(), invalid.size(), expected.data()));
+    }
+  }
+}
+
+TEST_MAIN
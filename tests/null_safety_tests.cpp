@@ -57,13 +57,26 @@ TEST(test_empty) {
     ASSERT_EQUAL(0, implementation.convert_valid_utf8_to_utf16be(i8, 0, o16));
     ASSERT_EQUAL(0, implementation.convert_valid_utf8_to_utf16le(i8, 0, o16));
     ASSERT_EQUAL(0, implementation.convert_valid_utf8_to_utf32(i8, 0, o32));
+    ASSERT_EQUAL(0, implementation.count_graphemes_utf8(i8, 0));
     ASSERT_EQUAL(0, implementation.count_utf16be(i16, 0));
     ASSERT_EQUAL(0, implementation.count_utf16le(i16, 0));
     ASSERT_EQUAL(0, implementation.count_utf8(i8, 0));
+    ASSERT_EQUAL(0, implementation.display_width_utf16be(i16, 0));
+    ASSERT_EQUAL(0, implementation.display_width_utf16le(i16, 0));
+    ASSERT_EQUAL(0, implementation.display_width_utf8(i8, 0));
+    ASSERT_TRUE(implementation.equals_ignore_case_utf8(i8, 0, i8, 0));
+    ASSERT_EQUAL(simdutf::nfc_quick_check_yes,
+                 implementation.is_nfc_quick_utf16be(i16, 0));
+    ASSERT_EQUAL(simdutf::nfc_quick_check_yes,
+                 implementation.is_nfc_quick_utf16le(i16, 0));
+    ASSERT_EQUAL(simdutf::nfc_quick_check_yes,
+                 implementation.is_nfc_quick_utf8(i8, 0));
     ASSERT_EQUAL(0, implementation.latin1_length_from_utf16(0));
     ASSERT_EQUAL(0, implementation.latin1_length_from_utf32(0));
     ASSERT_EQUAL(0, implementation.latin1_length_from_utf8(i8, 0));
     ASSERT_EQUAL(0, implementation.maximal_binary_length_from_base64(i16, 0));
+    ASSERT_EQUAL(0, implementation.to_lower_ascii_utf8(i8, 0, o8));
+    ASSERT_EQUAL(0, implementation.to_upper_ascii_utf8(i8, 0, o8));
     ASSERT_EQUAL(0, implementation.utf16_length_from_latin1(0));
     ASSERT_EQUAL(0, implementation.utf16_length_from_utf32(i32, 0));
     ASSERT_EQUAL(0, implementation.utf16_length_from_utf8(i8, 0));
@@ -80,6 +93,8 @@ TEST(test_empty) {
       return r.count == 0 && r.error == simdutf::error_code::SUCCESS;
     };
 
+    ASSERT_TRUE(is_valid(implementation.escape_html_utf8(i8, 0, o8)));
+    ASSERT_TRUE(is_valid(implementation.escape_xml_utf8(i8, 0, o8)));
     ASSERT_TRUE(implementation.validate_utf16be(i16, 0));
     ASSERT_TRUE(is_valid(implementation.validate_utf16be_with_errors(i16, 0)));
     ASSERT_TRUE(implementation.validate_utf16le(i16, 0));
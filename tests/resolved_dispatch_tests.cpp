@@ -0,0 +1,117 @@
+#include "simdutf.h"
+
+#include <string>
+#include <vector>
+
+#include <tests/helpers/test.h>
+
+namespace {
+const std::vector<std::string> inputs = {
+    "",
+    "a",
+    "plain ASCII text, long enough to fill a few SIMD registers and more.",
+    "d\xc3\xa9j\xc3\xa0 vu, \xce\xb1\xce\xb2\xce\xb3, \xe4\xb8\xad\xe6\x96\x87,"
+    " \xf0\x9f\x98\x80",
+    "invalid \xff byte",
+    "truncated \xe4\xb8",
+};
+} // namespace
+
+TEST(resolved_dispatch_is_stable) {
+  ASSERT_TRUE(&simdutf::resolved_dispatch() == &simdutf::resolved_dispatch());
+}
+
+TEST(resolved_dispatch_utf8) {
+  const simdutf::resolved_functions &functions = simdutf::resolved_dispatch();
+  for (const std::string &input : inputs) {
+    const char *data = input.data();
+    const size_t size = input.size();
+    ASSERT_EQUAL(functions.validate_utf8(data, size),
+                 implementation.validate_utf8(data, size));
+    const simdutf::result r = functions.validate_utf8_with_errors(data, size);
+    const simdutf::result expected =
+        implementation.validate_utf8_with_errors(data, size);
+    ASSERT_EQUAL(r.error, expected.error);
+    ASSERT_EQUAL(r.count, expected.count);
+    ASSERT_EQUAL(functions.validate_ascii(data, size),
+                 implementation.validate_ascii(data, size));
+    if (!implementation.validate_utf8(data, size)) {
+      continue;
+    }
+    ASSERT_EQUAL(functions.count_utf8(data, size),
+                 implementation.count_utf8(data, size));
+    ASSERT_EQUAL(functions.utf16_length_from_utf8(data, size),
+                 implementation.utf16_length_from_utf8(data, size));
+    ASSERT_EQUAL(functions.utf32_length_from_utf8(data, size),
+                 implementation.utf32_length_from_utf8(data, size));
+
+    std::u16string utf16(size, u'\0');
+    const size_t utf16_length =
+        functions.convert_utf8_to_utf16le(data, size, &utf16[0]);
+    ASSERT_EQUAL(utf16_length,
+                 implementation.utf16_length_from_utf8(data, size));
+    ASSERT_EQUAL(functions.convert_valid_utf8_to_utf16le(data, size, &utf16[0]),
+                 utf16_length);
+    ASSERT_TRUE(functions.validate_utf16le(utf16.data(), utf16_length));
+    ASSERT_EQUAL(functions.count_utf16le(utf16.data(), utf16_length),
+                 implementation.count_utf8(data, size));
+    ASSERT_EQUAL(functions.utf8_length_from_utf16le(utf16.data(), utf16_length),
+                 size);
+    std::string utf8(size, '\0');
+    ASSERT_EQUAL(
+        functions.convert_utf16le_to_utf8(utf16.data(), utf16_length, &utf8[0]),
+        size);
+    ASSERT_TRUE(utf8 == input);
+    ASSERT_EQUAL(functions.convert_valid_utf16le_to_utf8(
+                     utf16.data(), utf16_length, &utf8[0]),
+                 size);
+    ASSERT_TRUE(utf8 == input);
+
+    std::u32string utf32(size, U'\0');
+    const size_t utf32_length =
+        functions.convert_utf8_to_utf32(data, size, &utf32[0]);
+    ASSERT_EQUAL(utf32_length, implementation.count_utf8(data, size));
+    ASSERT_TRUE(functions.validate_utf32(utf32.data(), utf32_length));
+    ASSERT_EQUAL(functions.utf8_length_from_utf32(utf32.data(), utf32_length),
+                 size);
+    ASSERT_EQUAL(
+        functions.convert_utf32_to_utf8(utf32.data(), utf32_length, &utf8[0]),
+        size);
+    ASSERT_TRUE(utf8 == input);
+  }
+}
+
+TEST(resolved_dispatch_latin1) {
+  const simdutf::resolved_functions &functions = simdutf::resolved_dispatch();
+  const std::string latin1 = "caf\xe9 cr\xe8me br\xfbl\xe9";
+  ASSERT_EQUAL(functions.utf8_length_from_latin1(latin1.data(), latin1.size()),
+               latin1.size() + 4);
+  std::string utf8(2 * latin1.size(), '\0');
+  const size_t utf8_length =
+      functions.convert_latin1_to_utf8(latin1.data(), latin1.size(), &utf8[0]);
+  ASSERT_EQUAL(utf8_length, latin1.size() + 4);
+  std::string back(latin1.size(), '\0');
+  ASSERT_EQUAL(
+      functions.convert_utf8_to_latin1(utf8.data(), utf8_length, &back[0]),
+      latin1.size());
+  ASSERT_TRUE(back == latin1);
+}
+
+TEST(resolved_dispatch_base64) {
+  const simdutf::resolved_functions &functions = simdutf::resolved_dispatch();
+  const std::string binary = "any carnal pleasure.";
+  std::string base64(simdutf::base64_length_from_binary(binary.size()), '\0');
+  ASSERT_EQUAL(functions.binary_to_base64(binary.data(), binary.size(),
+                                          &base64[0], simdutf::base64_default),
+               base64.size());
+  ASSERT_TRUE(base64 == "YW55IGNhcm5hbCBwbGVhc3VyZS4=");
+  std::string decoded(binary.size(), '\0');
+  const simdutf::result r = functions.base64_to_binary(
+      base64.data(), base64.size(), &decoded[0], simdutf::base64_default,
+      simdutf::last_chunk_handling_options::loose);
+  ASSERT_EQUAL(r.error, simdutf::error_code::SUCCESS);
+  ASSERT_EQUAL(r.count, binary.size());
+  ASSERT_TRUE(decoded == binary);
+}
+
+TEST_MAIN
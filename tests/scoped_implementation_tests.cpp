@@ -0,0 +1,60 @@
+#include "simdutf.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <tests/helpers/test.h>
+
+// The table of resolved_dispatch() tells which implementation the free
+// functions of the calling thread run on.
+TEST(scoped_implementation_nesting) {
+  const simdutf::resolved_functions *global = &simdutf::resolved_dispatch();
+  const simdutf::implementation *active = simdutf::get_active_implementation();
+  {
+    simdutf::scoped_implementation guard(&implementation);
+    const simdutf::resolved_functions *scoped = &simdutf::resolved_dispatch();
+    ASSERT_TRUE(simdutf::get_active_implementation() == active);
+    {
+      simdutf::scoped_implementation inner(nullptr);
+      ASSERT_TRUE(&simdutf::resolved_dispatch() == global);
+    }
+    ASSERT_TRUE(&simdutf::resolved_dispatch() == scoped);
+
+    const std::string valid = "d\xc3\xa9j\xc3\xa0 vu";
+    const std::string invalid = "d\xc3j\xc3\xa0 vu";
+    ASSERT_TRUE(simdutf::validate_utf8(valid.data(), valid.size()));
+    ASSERT_FALSE(simdutf::validate_utf8(invalid.data(), invalid.size()));
+    ASSERT_EQUAL(simdutf::count_utf8(valid.data(), valid.size()), 7);
+  }
+  ASSERT_TRUE(&simdutf::resolved_dispatch() == global);
+}
+
+TEST(scoped_implementation_per_thread) {
+  const simdutf::resolved_functions *global = &simdutf::resolved_dispatch();
+  simdutf::scoped_implementation guard(&implementation);
+  const simdutf::resolved_functions *scoped = &simdutf::resolved_dispatch();
+  const simdutf::resolved_functions *other = nullptr;
+  std::thread thread([&other] { other = &simdutf::resolved_dispatch(); });
+  thread.join();
+  ASSERT_TRUE(other == global);
+  ASSERT_TRUE(&simdutf::resolved_dispatch() == scoped);
+}
+
+TEST(scoped_implementation_distinct) {
+  // each supported implementation has its own table
+  std::vector<const simdutf::resolved_functions *> tables;
+  for (const simdutf::implementation *impl :
+       simdutf::get_available_implementations()) {
+    if (!impl->supported_by_runtime_system()) {
+      continue;
+    }
+    simdutf::scoped_implementation guard(impl);
+    for (const simdutf::resolved_functions *table : tables) {
+      ASSERT_TRUE(table != &simdutf::resolved_dispatch());
+    }
+    tables.push_back(&simdutf::resolved_dispatch());
+  }
+}
+
+TEST_MAIN
@@ -37,6 +37,57 @@ TEST(count_utf8_c) {
   ASSERT_EQUAL(cnt, hello_len);
 }
 
+TEST(case_mapping_c) {
+  char upper[16];
+  char lower[16];
+  size_t n = simdutf_to_upper_ascii_utf8(hello, hello_len, upper);
+  ASSERT_EQUAL(n, hello_len);
+  ASSERT_TRUE(memcmp(upper, "HELLO", n) == 0);
+  n = simdutf_to_lower_ascii_utf8(upper, n, lower);
+  ASSERT_EQUAL(n, hello_len);
+  ASSERT_TRUE(memcmp(lower, hello, n) == 0);
+  ASSERT_TRUE(simdutf_equals_ignore_case_utf8(hello, hello_len, "HeLLo", 5));
+  ASSERT_FALSE(simdutf_equals_ignore_case_utf8(hello, hello_len, "help", 4));
+}
+
+TEST(nfc_quick_check_c) {
+  ASSERT_EQUAL(simdutf_is_nfc_quick_utf8(hello, hello_len),
+               SIMDUTF_NFC_QUICK_CHECK_YES);
+  const char *decomposed = "e\xcc\x81"; // e + U+0301
+  ASSERT_EQUAL(simdutf_is_nfc_quick_utf8(decomposed, 3),
+               SIMDUTF_NFC_QUICK_CHECK_MAYBE);
+  const char16_t tone_mark[] = {u'a', 0x0340};
+  ASSERT_EQUAL(simdutf_is_nfc_quick_utf16(tone_mark, 2),
+               SIMDUTF_NFC_QUICK_CHECK_NO);
+}
+
+TEST(display_width_c) {
+  ASSERT_EQUAL(simdutf_display_width_utf8(hello, hello_len), hello_len);
+  const char *cjk = "\xe4\xb8\xad\xe6\x96\x87"; // U+4E2D U+6587
+  ASSERT_EQUAL(simdutf_display_width_utf8(cjk, 6), 4);
+  const char16_t combining[] = {u'e', 0x0301};
+  ASSERT_EQUAL(simdutf_display_width_utf16(combining, 2), 1);
+}
+
+TEST(grapheme_c) {
+  ASSERT_EQUAL(simdutf_count_graphemes_utf8(hello, hello_len), hello_len);
+  const char *decomposed = "e\xcc\x81x"; // e + U+0301, x
+  ASSERT_EQUAL(simdutf_count_graphemes_utf8(decomposed, 4), 2);
+  ASSERT_EQUAL(simdutf_next_grapheme_boundary_utf8(decomposed, 4), 3);
+}
+
+TEST(escape_c) {
+  char out[64];
+  const char *text = "a<'b'>";
+  simdutf_result r = simdutf_escape_html_utf8(text, 6, out);
+  ASSERT_EQUAL(r.error, SIMDUTF_ERROR_SUCCESS);
+  ASSERT_EQUAL(r.count, 20);
+  ASSERT_TRUE(std::memcmp(out, "a&lt;&#39;b&#39;&gt;", 20) == 0);
+  r = simdutf_escape_xml_utf8("a\x01", 2, out);
+  ASSERT_EQUAL(r.error, SIMDUTF_ERROR_INVALID_XML_CHARACTER);
+  ASSERT_EQUAL(r.count, 1);
+}
+
 TEST(find_c) {
   const char *f = simdutf_find(hello, hello + hello_len, 'e');
   ASSERT_EQUAL(f, hello + 1);
@@ -0,0 +1,256 @@
+#include "simdutf.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// Checks the size-aware dispatch (see SIMDUTF_SIZE_AWARE_DISPATCH) as
+// applications get it: the implementation is detected on first use, which
+// installs its thresholds. The tests built with tests/helpers/test.h select
+// each implementation by hand beforehand, which leaves the thresholds out.
+
+namespace {
+
+// Mostly ASCII UTF-8 of exactly length bytes, with Latin 1 letters and,
+// unless latin1_only, CJK characters. The invalid inputs get a 0xFF byte in
+// the middle.
+std::string make_utf8(size_t length, bool invalid, bool latin1_only) {
+  static const char *const pieces[] = {"x", "\xc3\xa9", "y", "\xe4\xb8\xad"};
+  std::string input;
+  for (size_t i = 0; input.size() < length; i++) {
+    std::string piece = pieces[i % (latin1_only ? 2 : 4)];
+    if (input.size() + piece.size() > length) {
+      piece = "z";
+    }
+    input += piece;
+  }
+  if (invalid && length > 0) {
+    input[length / 2] = char(0xff);
+  }
+  return input;
+}
+
+// The same characters in UTF-16, with a lone surrogate when invalid.
+std::u16string make_utf16(size_t length, bool invalid) {
+  static const char16_t units[] = {u'x', 0x00e9, u'y', 0x4e2d};
+  std::u16string input;
+  for (size_t i = 0; i < length; i++) {
+    input += units[i % 4];
+  }
+  if (invalid && length > 0) {
+    input[length / 2] = char16_t(0xd800);
+  }
+  return input;
+}
+
+// The same characters in UTF-32, with a code point above U+10FFFF when
+// invalid.
+std::u32string make_utf32(size_t length, bool invalid) {
+  static const char32_t units[] = {U'x', 0x00e9, U'y', 0x4e2d};
+  std::u32string input;
+  for (size_t i = 0; i < length; i++) {
+    input += units[i % 4];
+  }
+  if (invalid && length > 0) {
+    input[length / 2] = char32_t(0x110000);
+  }
+  return input;
+}
+
+template <typename T> std::string bytes_of(const T *data, size_t count) {
+  return std::string(reinterpret_cast<const char *>(data), count * sizeof(T));
+}
+
+// Runs a function of get_dispatch_report() on an input of length code units,
+// through the free functions when impl is null, and stores its result and
+// output in outcome. Returns false when the function is not checked on such
+// an input: the counting and length functions, and the conversions of valid
+// inputs, only take valid inputs.
+bool run(const std::string &function, const simdutf::implementation *impl,
+         size_t length, bool invalid, std::string *outcome) {
+#define CALL(name, ...)                                                        \
+  (impl != nullptr ? impl->name(__VA_ARGS__) : simdutf::name(__VA_ARGS__))
+  const std::string utf8 = make_utf8(length, invalid, false);
+  const std::string latin1_utf8 = make_utf8(length, invalid, true);
+  const std::u16string utf16 = make_utf16(length, invalid);
+  const std::u32string utf32 = make_utf32(length, invalid);
+  std::vector<char> out8(4 * length + 4);
+  std::vector<char16_t> out16(length + 4);
+  std::vector<char32_t> out32(length + 4);
+  size_t value;
+  std::string output;
+  if (function == "validate_utf8") {
+    value = CALL(validate_utf8, utf8.data(), length);
+  } else if (function == "validate_ascii") {
+    std::string ascii(length, 'a');
+    if (invalid && length > 0) {
+      ascii[length / 2] = char(0x80);
+    }
+    value = CALL(validate_ascii, ascii.data(), length);
+  } else if (function == "utf8_length_from_latin1") {
+    value = CALL(utf8_length_from_latin1, utf8.data(), length);
+  } else if (function == "convert_latin1_to_utf8") {
+    value = CALL(convert_latin1_to_utf8, utf8.data(), length, out8.data());
+    output = bytes_of(out8.data(), value);
+  } else if (function == "convert_utf8_to_latin1") {
+    value = CALL(convert_utf8_to_latin1, latin1_utf8.data(), length,
+                 out8.data());
+    output = bytes_of(out8.data(), value);
+  } else if (function == "convert_utf8_to_utf16") {
+    value = CALL(convert_utf8_to_utf16le, utf8.data(), length, out16.data());
+    output = bytes_of(out16.data(), value);
+  } else if (function == "convert_utf8_to_utf32") {
+    value = CALL(convert_utf8_to_utf32, utf8.data(), length, out32.data());
+    output = bytes_of(out32.data(), value);
+  } else if (function == "convert_utf16_to_utf8") {
+    value = CALL(convert_utf16le_to_utf8, utf16.data(), length, out8.data());
+    output = bytes_of(out8.data(), value);
+  } else if (function == "convert_utf32_to_utf8") {
+    value = CALL(convert_utf32_to_utf8, utf32.data(), length, out8.data());
+    output = bytes_of(out8.data(), value);
+  } else if (function == "convert_utf16_to_utf32") {
+    value = CALL(convert_utf16le_to_utf32, utf16.data(), length, out32.data());
+    output = bytes_of(out32.data(), value);
+  } else if (invalid) {
+    return false;
+  } else if (function == "count_utf8") {
+    value = CALL(count_utf8, utf8.data(), length);
+  } else if (function == "count_utf16") {
+    value = CALL(count_utf16le, utf16.data(), length);
+  } else if (function == "utf16_length_from_utf8") {
+    value = CALL(utf16_length_from_utf8, utf8.data(), length);
+  } else if (function == "utf8_length_from_utf16") {
+    value = CALL(utf8_length_from_utf16le, utf16.data(), length);
+  } else if (function == "convert_valid_utf8_to_utf16") {
+    value = CALL(convert_valid_utf8_to_utf16le, utf8.data(), length,
+                 out16.data());
+    output = bytes_of(out16.data(), value);
+  } else if (function == "convert_valid_utf16_to_utf8") {
+    value = CALL(convert_valid_utf16le_to_utf8, utf16.data(), length,
+                 out8.data());
+    output = bytes_of(out8.data(), value);
+  } else {
+    return false;
+  }
+#undef CALL
+  *outcome = std::to_string(value) + ":" + output;
+  return true;
+}
+
+bool is_size_aware(const simdutf::implementation *impl) {
+#if defined(SIMDUTF_SIZE_AWARE_DISPATCH) && !SIMDUTF_SIZE_AWARE_DISPATCH
+  (void)impl;
+  return false;
+#else
+  // the implementations with thresholds (see src/implementation.cpp), which
+  // are left out when a single implementation is compiled in
+  return std::getenv("SIMDUTF_FORCE_IMPLEMENTATION") == nullptr &&
+         simdutf::get_available_implementations().size() > 1 &&
+         (impl->name() == "icelake" || impl->name() == "haswell" ||
+          impl->name() == "westmere");
+#endif
+}
+
+} // namespace
+
+int main() {
+  // the first call detects the implementation
+  if (!simdutf::validate_utf8("", 0)) {
+    return EXIT_FAILURE;
+  }
+  const simdutf::implementation *active = simdutf::get_active_implementation();
+  printf("detected: %.*s\n", int(active->name().size()),
+         active->name().data());
+
+  std::vector<simdutf::function_dispatch> report(
+      simdutf::get_dispatch_report(nullptr, 0));
+  simdutf::get_dispatch_report(report.data(), report.size());
+  size_t thresholds = 0;
+  for (const simdutf::function_dispatch &entry : report) {
+    if (std::strcmp(entry.name, "convert_utf8_to_utf32") == 0 &&
+        is_size_aware(active) && entry.short_inputs == nullptr) {
+      printf("convert_utf8_to_utf32 has no implementation for short inputs\n");
+      return EXIT_FAILURE;
+    }
+    if (entry.short_inputs == nullptr) {
+      continue;
+    }
+    thresholds++;
+    printf("%s: below %zu code units on %.*s\n", entry.name, entry.below,
+           int(entry.short_inputs->name().size()),
+           entry.short_inputs->name().data());
+    const size_t lengths[] = {entry.below - 1, entry.below, entry.below + 1};
+    for (const size_t length : lengths) {
+      for (const bool invalid : {false, true}) {
+        std::string narrow, wide, through_free;
+        if (!run(entry.name, entry.short_inputs, length, invalid, &narrow)) {
+          if (invalid) {
+            continue;
+          }
+          printf("%s is not checked by this test\n", entry.name);
+          return EXIT_FAILURE;
+        }
+        run(entry.name, entry.chosen, length, invalid, &wide);
+        run(entry.name, nullptr, length, invalid, &through_free);
+        if (narrow != wide || through_free != wide) {
+          printf("%s differs on %zu code units (%s)\n", entry.name, length,
+                 invalid ? "invalid" : "valid");
+          return EXIT_FAILURE;
+        }
+      }
+    }
+  }
+  if (is_size_aware(active) && thresholds == 0) {
+    printf("no size-aware dispatch was installed\n");
+    return EXIT_FAILURE;
+  }
+
+  // A scoped_implementation runs the short inputs too, even when it names the
+  // detected implementation.
+  {
+    simdutf::scoped_implementation guard(active);
+    std::vector<simdutf::function_dispatch> scoped(report.size());
+    simdutf::get_dispatch_report(scoped.data(), scoped.size());
+    for (size_t i = 0; i < scoped.size(); i++) {
+      const simdutf::function_dispatch &entry = scoped[i];
+      if (entry.short_inputs != nullptr || entry.chosen != active) {
+        printf("%s is not run by the scoped implementation\n", entry.name);
+        return EXIT_FAILURE;
+      }
+      if (report[i].short_inputs == nullptr) {
+        continue;
+      }
+      if (simdutf::get_dispatch_reason(entry.name, report[i].short_inputs) !=
+          simdutf::dispatch_reason::overridden) {
+        printf("%s still sends short inputs to %.*s\n", entry.name,
+               int(report[i].short_inputs->name().size()),
+               report[i].short_inputs->name().data());
+        return EXIT_FAILURE;
+      }
+      for (const bool invalid : {false, true}) {
+        std::string wide, through_free;
+        if (!run(entry.name, active, report[i].below - 1, invalid, &wide)) {
+          continue;
+        }
+        run(entry.name, nullptr, report[i].below - 1, invalid, &through_free);
+        if (through_free != wide) {
+          printf("%s differs under the scoped implementation (%s)\n",
+                 entry.name, invalid ? "invalid" : "valid");
+          return EXIT_FAILURE;
+        }
+      }
+    }
+  }
+  std::vector<simdutf::function_dispatch> restored(report.size());
+  simdutf::get_dispatch_report(restored.data(), restored.size());
+  for (size_t i = 0; i < restored.size(); i++) {
+    if (restored[i].short_inputs != report[i].short_inputs) {
+      printf("%s lost its threshold after the scoped implementation\n",
+             restored[i].name);
+      return EXIT_FAILURE;
+    }
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,111 @@
+#include "simdutf.h"
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include <tests/helpers/test.h>
+
+namespace {
+constexpr uint64_t seed = 0x123456789ABCDEF0;
+
+// The short inputs of the free functions may run on a narrower
+// implementation (see SIMDUTF_SIZE_AWARE_DISPATCH): their results must not
+// differ from those of any implementation.
+const std::vector<std::string> pieces = {
+    "a", "Z", " ", "\xc3\xa9", "\xe4\xb8\xad", "\xf0\x9f\x98\x80",
+};
+
+std::string make_input(std::mt19937 &gen, size_t length, bool invalid) {
+  std::uniform_int_distribution<size_t> piece_dist(0, pieces.size() - 1);
+  std::string input;
+  while (input.size() < length) {
+    // mostly ASCII, as in the calibration
+    input += gen() % 4 == 0 ? pieces[piece_dist(gen)] : "x";
+  }
+  input.resize(length);
+  if (invalid && length > 0) {
+    input[gen() % length] = char(0xff);
+  }
+  return input;
+}
+} // namespace
+
+TEST(size_aware_utf8) {
+  std::mt19937 gen(seed);
+  for (size_t length = 0; length <= 128; length++) {
+    for (int trial = 0; trial < 10; trial++) {
+      // the truncation may leave an invalid input
+      const std::string input = make_input(gen, length, trial % 3 == 0);
+      const char *data = input.data();
+      ASSERT_EQUAL(simdutf::validate_utf8(data, length),
+                   implementation.validate_utf8(data, length));
+      ASSERT_EQUAL(simdutf::validate_ascii(data, length),
+                   implementation.validate_ascii(data, length));
+      const bool valid = implementation.validate_utf8(data, length);
+      if (valid) {
+        ASSERT_EQUAL(simdutf::count_utf8(data, length),
+                     implementation.count_utf8(data, length));
+        ASSERT_EQUAL(simdutf::utf16_length_from_utf8(data, length),
+                     implementation.utf16_length_from_utf8(data, length));
+      }
+      ASSERT_EQUAL(simdutf::utf8_length_from_latin1(data, length),
+                   implementation.utf8_length_from_latin1(data, length));
+
+      std::vector<char> latin1(length + 1), expected_latin1(length + 1);
+      const size_t latin1_length =
+          implementation.convert_utf8_to_latin1(data, length,
+                                                expected_latin1.data());
+      ASSERT_EQUAL(
+          simdutf::convert_utf8_to_latin1(data, length, latin1.data()),
+          latin1_length);
+      // the output is unspecified on error
+      ASSERT_TRUE(latin1_length == 0 || latin1 == expected_latin1);
+      std::vector<char> utf8(2 * length + 1), expected_utf8(2 * length + 1);
+      ASSERT_EQUAL(
+          simdutf::convert_latin1_to_utf8(data, length, utf8.data()),
+          implementation.convert_latin1_to_utf8(data, length,
+                                                expected_utf8.data()));
+      ASSERT_TRUE(utf8 == expected_utf8);
+
+      std::vector<char16_t> utf16(length + 1), expected_utf16(length + 1);
+      ASSERT_EQUAL(
+          simdutf::convert_utf8_to_utf16le(data, length, utf16.data()),
+          implementation.convert_utf8_to_utf16le(data, length,
+                                                 expected_utf16.data()));
+      ASSERT_TRUE(!valid || utf16 == expected_utf16);
+      std::vector<char32_t> utf32(length + 1), expected_utf32(length + 1);
+      ASSERT_EQUAL(
+          simdutf::convert_utf8_to_utf32(data, length, utf32.data()),
+          implementation.convert_utf8_to_utf32(data, length,
+                                               expected_utf32.data()));
+      ASSERT_TRUE(!valid || utf32 == expected_utf32);
+      if (!valid) {
+        continue;
+      }
+      const size_t utf16_length = implementation.convert_utf8_to_utf16le(
+          data, length, expected_utf16.data());
+      ASSERT_EQUAL(
+          simdutf::utf8_length_from_utf16le(expected_utf16.data(),
+                                            utf16_length),
+          length);
+      ASSERT_EQUAL(simdutf::count_utf16le(expected_utf16.data(), utf16_length),
+                   implementation.count_utf16le(expected_utf16.data(),
+                                                utf16_length));
+      std::fill(utf8.begin(), utf8.end(), 0);
+      ASSERT_EQUAL(simdutf::convert_utf16le_to_utf8(expected_utf16.data(),
+                                                    utf16_length, utf8.data()),
+                   length);
+      ASSERT_TRUE(std::string(utf8.data(), length) == input);
+      const size_t utf32_length = implementation.convert_utf8_to_utf32(
+          data, length, expected_utf32.data());
+      std::fill(utf8.begin(), utf8.end(), 0);
+      ASSERT_EQUAL(simdutf::convert_utf32_to_utf8(expected_utf32.data(),
+                                                  utf32_length, utf8.data()),
+                   length);
+      ASSERT_TRUE(std::string(utf8.data(), length) == input);
+    }
+  }
+}
+
+TEST_MAIN
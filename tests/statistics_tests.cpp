@@ -0,0 +1,98 @@
+#include "simdutf.h"
+
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <tests/helpers/test.h>
+
+namespace {
+simdutf::function_statistics get(const char *name) {
+  std::vector<simdutf::function_statistics> all(1);
+  const size_t count = simdutf::get_statistics(all.data(), 0);
+  all.resize(count);
+  ASSERT_EQUAL(simdutf::get_statistics(all.data(), all.size()), count);
+  for (const simdutf::function_statistics &statistics : all) {
+    if (std::strcmp(statistics.name, name) == 0) {
+      return statistics;
+    }
+  }
+  ASSERT_TRUE(false);
+  return {};
+}
+} // namespace
+
+TEST(statistics_counts) {
+  simdutf::reset_statistics();
+  const std::string valid(100, 'a');
+  const std::string invalid = "abc\xff";
+  ASSERT_TRUE(simdutf::validate_utf8(valid.data(), valid.size()));
+  ASSERT_TRUE(simdutf::validate_utf8(valid.data(), 0));
+  ASSERT_FALSE(simdutf::validate_utf8(invalid.data(), invalid.size()));
+  simdutf::function_statistics statistics = get("validate_utf8");
+  ASSERT_EQUAL(statistics.calls, 3);
+  ASSERT_EQUAL(statistics.bytes, valid.size() + invalid.size());
+  ASSERT_EQUAL(statistics.errors, 1);
+  ASSERT_EQUAL(statistics.size_histogram[0], 1); // empty
+  ASSERT_EQUAL(statistics.size_histogram[3], 1); // 4 bytes
+  ASSERT_EQUAL(statistics.size_histogram[7], 1); // 100 bytes
+
+  // UTF-16 inputs count two bytes per code unit
+  std::u16string utf16(valid.size(), u'\0');
+  ASSERT_EQUAL(
+      simdutf::convert_utf8_to_utf16le(valid.data(), valid.size(), &utf16[0]),
+      valid.size());
+  utf16.back() = 0xD800; // a lone surrogate
+  std::string utf8(3 * utf16.size(), '\0');
+  ASSERT_EQUAL(
+      simdutf::convert_utf16le_to_utf8(utf16.data(), utf16.size(), &utf8[0]),
+      0);
+  statistics = get("convert_utf16_to_utf8");
+  ASSERT_EQUAL(statistics.calls, 1);
+  ASSERT_EQUAL(statistics.bytes, 2 * utf16.size());
+  ASSERT_EQUAL(statistics.errors, 1);
+  ASSERT_EQUAL(get("convert_utf8_to_utf16").errors, 0);
+
+  simdutf::reset_statistics();
+  ASSERT_EQUAL(get("validate_utf8").calls, 0);
+  ASSERT_EQUAL(get("convert_utf16_to_utf8").size_histogram[8], 0);
+}
+
+TEST(statistics_zero_is_not_an_error) {
+  simdutf::reset_statistics();
+  // continuation bytes start no character: zero is the right count
+  const std::string continuation = "\x80\x80\x80";
+  ASSERT_EQUAL(simdutf::count_utf8(continuation.data(), 1), 0);
+  ASSERT_EQUAL(
+      simdutf::count_utf8(continuation.data(), continuation.size()), 0);
+  ASSERT_EQUAL(get("count_utf8").calls, 2);
+  ASSERT_EQUAL(get("count_utf8").errors, 0);
+  std::u16string utf16(2, u'\0');
+  ASSERT_EQUAL(simdutf::convert_utf8_to_utf16le(continuation.data(), 1,
+                                                &utf16[0]),
+               0);
+  ASSERT_EQUAL(get("convert_utf8_to_utf16").errors, 1);
+}
+
+TEST(statistics_threads) {
+  simdutf::reset_statistics();
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < 4; t++) {
+    threads.emplace_back([] {
+      size_t total = 0;
+      for (size_t i = 0; i < 1000; i++) {
+        total += simdutf::count_utf8("abc", 3);
+      }
+      ASSERT_EQUAL(total, 3000);
+    });
+  }
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+  // the counters of the threads outlive them
+  ASSERT_EQUAL(get("count_utf8").calls, 4000);
+  ASSERT_EQUAL(get("count_utf8").bytes, 12000);
+}
+
+TEST_MAIN
@@ -0,0 +1,143 @@
+#include "simdutf.h"
+
+#include <cctype>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <tests/helpers/test.h>
+
+namespace {
+constexpr uint64_t seed = 0x123456789ABCDEF0;
+
+// pairs of (upper case, lower case) characters
+const std::vector<std::pair<std::string, std::string>> case_pairs = {
+    {"A", "a"},
+    {"Z", "z"},
+    {"7", "7"},
+    {"@", "@"},
+    {"\xc3\x80", "\xc3\xa0"},                 // U+00C0, U+00E0
+    {"\xce\xa3", "\xcf\x83"},                 // U+03A3, U+03C3
+    {"\xd0\x96", "\xd0\xb6"},                 // U+0416, U+0436
+    {"\xc8\xba", "\xe2\xb1\xa5"},             // U+023A, U+2C65
+    {"\xe2\x82\xac", "\xe2\x82\xac"},         // U+20AC
+    {"\xf0\x90\x90\x80", "\xf0\x90\x90\xa8"}, // U+10400, U+10428
+};
+
+std::string to_lower(const simdutf::implementation &implementation,
+                     const std::string &input) {
+  std::string output(input.size() + input.size() / 2, '\0');
+  output.resize(implementation.to_lower_ascii_utf8(input.data(), input.size(),
+                                                   &output[0]));
+  return output;
+}
+
+std::string to_upper(const simdutf::implementation &implementation,
+                     const std::string &input) {
+  std::string output(input.size() + input.size() / 2, '\0');
+  output.resize(implementation.to_upper_ascii_utf8(input.data(), input.size(),
+                                                   &output[0]));
+  return output;
+}
+
+bool equals_ignore_case(const simdutf::implementation &implementation,
+                        const std::string &a, const std::string &b) {
+  return implementation.equals_ignore_case_utf8(a.data(), a.size(), b.data(),
+                                                b.size());
+}
+} // namespace
+
+TEST(ascii_case_mapping) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> char_dist(0, 127);
+  for (size_t length = 0; length < 300; length++) {
+    std::string input(length, '\0');
+    for (char &c : input) {
+      c = char(char_dist(gen));
+    }
+    std::string expected_lower = input;
+    std::string expected_upper = input;
+    for (size_t i = 0; i < length; i++) {
+      expected_lower[i] = char(std::tolower(input[i]));
+      expected_upper[i] = char(std::toupper(input[i]));
+    }
+    ASSERT_TRUE(to_lower(implementation, input) == expected_lower);
+    ASSERT_TRUE(to_upper(implementation, input) == expected_upper);
+    ASSERT_TRUE(equals_ignore_case(implementation, expected_lower,
+                                   expected_upper));
+    ASSERT_TRUE(equals_ignore_case(implementation, input, expected_upper));
+    if (length > 0) {
+      std::string other = expected_lower;
+      other[gen() % length] ^= 0x40;
+      ASSERT_FALSE(equals_ignore_case(implementation, other, expected_upper));
+      other = input;
+      other.pop_back();
+      ASSERT_FALSE(equals_ignore_case(implementation, other, input));
+    }
+  }
+}
+
+TEST(unicode_case_mapping) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<size_t> pair_dist(0, case_pairs.size() - 1);
+  std::uniform_int_distribution<size_t> ascii_run(0, 100);
+  for (size_t trial = 0; trial < 1000; trial++) {
+    std::string upper;
+    std::string lower;
+    const size_t count = trial % 300;
+    for (size_t i = 0; i < count; i++) {
+      // long ASCII runs exercise the block fast path
+      const auto &pair = ascii_run(gen) == 0 ? case_pairs[pair_dist(gen)]
+                                             : case_pairs[gen() % 4];
+      upper += pair.first;
+      lower += pair.second;
+    }
+    ASSERT_TRUE(to_lower(implementation, upper) == lower);
+    ASSERT_TRUE(to_upper(implementation, lower) == upper);
+    ASSERT_TRUE(equals_ignore_case(implementation, upper, lower));
+    ASSERT_TRUE(equals_ignore_case(implementation, lower, upper));
+    if (count > 0) {
+      std::string other = lower;
+      other += "x";
+      ASSERT_FALSE(equals_ignore_case(implementation, other, upper));
+    }
+  }
+}
+
+TEST(simple_mappings_only) {
+  // U+00DF has no simple upper-case mapping
+  ASSERT_TRUE(to_upper(implementation, "stra\xc3\x9f"
+                                       "e") == "STRA\xc3\x9f"
+                                               "E");
+  // U+0130 lower-cases to U+0069
+  ASSERT_TRUE(to_lower(implementation, "\xc4\xb0") == "i");
+  // U+017F upper-cases to U+0053
+  ASSERT_TRUE(to_upper(implementation, "\xc5\xbf") == "S");
+}
+
+TEST(case_folding) {
+  // U+212A KELVIN SIGN folds to U+006B
+  ASSERT_TRUE(equals_ignore_case(implementation, "\xe2\x84\xaa", "k"));
+  ASSERT_TRUE(equals_ignore_case(implementation, "K", "\xe2\x84\xaa"));
+  // U+00B5 MICRO SIGN and U+039C fold to U+03BC
+  ASSERT_TRUE(equals_ignore_case(implementation, "\xc2\xb5", "\xce\x9c"));
+  ASSERT_FALSE(equals_ignore_case(implementation, "\xc3\xa0", "a"));
+  ASSERT_TRUE(equals_ignore_case(implementation, "", ""));
+  ASSERT_FALSE(equals_ignore_case(implementation, "", "a"));
+}
+
+TEST(invalid_input_is_copied) {
+  const std::string input = "A\xff"
+                            "B\xc3"
+                            "C\xed\xa0\x80"
+                            "D";
+  const std::string lower = "a\xff"
+                            "b\xc3"
+                            "c\xed\xa0\x80"
+                            "d";
+  ASSERT_TRUE(to_lower(implementation, input) == lower);
+  ASSERT_TRUE(equals_ignore_case(implementation, input, lower));
+  ASSERT_FALSE(equals_ignore_case(implementation, "\xff", "\xfe"));
+}
+
+TEST_MAIN